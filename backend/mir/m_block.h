@@ -3,23 +3,22 @@
 
 #include "middleend/module/ir_block.h"
 #include <backend/mir/m_instruction.h>
-#include <deque>
+#include <ilist.h>
 
 namespace BE
 {
     class Block
     {
       public:
-        std::deque<MInstruction*> insts;
-        uint32_t                  blockId;
+        using InstList = IList<MInstruction, Block>;
+        using iterator = InstList::iterator;
+
+        InstList insts;  // 侵入式指令链表：插入/删除为 O(1)，不会使其他指令的迭代器失效
+        uint32_t blockId;
 
       public:
-        Block(uint32_t id) : blockId(id) {}
-        ~Block()
-        {
-            for (auto inst : insts) MInstruction::delInst(inst);
-            insts.clear();
-        }
+        Block(uint32_t id) : insts(this), blockId(id) {}
+        ~Block() { insts.clearAndDispose([](MInstruction* inst) { MInstruction::delInst(inst); }); }
     };
 }  // namespace BE
 
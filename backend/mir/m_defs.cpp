@@ -18,12 +18,6 @@ namespace BE
     DataType* PTR   = &PTRINSTANCE;
     DataType* TOKEN = &TOKENINSTANCE;
 
-    Register getVReg(DataType* dt)
-    {
-        static uint32_t vreg_count = 0;
-        return Register(vreg_count++, dt, true);
-    }
-
     MoveInst* createMove(Operand* dst, Operand* src, const std::string& c) { return new MoveInst(src, dst, c); }
 
     MoveInst* createMove(Operand* dst, int imme, const std::string& c)
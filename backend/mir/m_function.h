@@ -19,10 +19,11 @@ namespace BE
         int                        paramSize     = 0;
         std::vector<MInstruction*> allocInsts;
         MFrameInfo                 frameInfo;
+        uint32_t                   vregCount = 0;  // 虚拟寄存器按函数编号，各函数可以独立（并行）地下降
 
       public:
         Function(const std::string& name)
-            : name(name), params(), blocks(), stackSize(0), hasStackParam(false), paramSize(0), frameInfo()
+            : name(name), params(), blocks(), stackSize(0), hasStackParam(false), paramSize(0), frameInfo(), vregCount(0)
         {}
         ~Function()
         {
@@ -33,6 +34,8 @@ namespace BE
             }
             blocks.clear();
         }
+
+        Register getVReg(DataType* dt) { return Register(vregCount++, dt, true); }
     };
 }  // namespace BE
 
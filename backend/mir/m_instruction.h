@@ -2,11 +2,15 @@
 #define __BACKEND_MIR_M_INSTRUCTION_H__
 
 #include <backend/mir/m_defs.h>
+#include <ilist.h>
 #include <map>
 
 namespace BE
 {
-    class MInstruction
+    class Block;
+
+    // 挂在所属 Block 的侵入式指令链表上，getParent() 返回所在的块
+    class MInstruction : public IListNode<MInstruction, Block>
     {
       public:
         InstKind    kind;
@@ -3,6 +3,7 @@
 
 #include <backend/mir/m_function.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace BE
@@ -14,11 +15,19 @@ namespace BE
         DataType*        type;
         std::vector<int> dims;
 
-        std::vector<int> initVals;
+        // 按行优先展开的 (下标, 值)，下标递增，只含非零元素；浮点数存比特模式
+        std::vector<std::pair<size_t, int>> initVals;
 
         GlobalVariable(DataType* t, const std::string& n) : name(n), type(t), dims(), initVals() {}
 
-        bool isScalar() const { return dims.empty(); }
+        bool   isScalar() const { return dims.empty(); }
+        bool   isZeroInit() const { return initVals.empty(); }
+        size_t numElements() const
+        {
+            size_t n = 1;
+            for (int d : dims) n *= static_cast<size_t>(d);
+            return n;
+        }
     };
     class Module
     {
@@ -12,29 +12,21 @@
 
 #include <map>
 #include <set>
-#include <unordered_map>
 #include <deque>
 #include <algorithm>
 
 namespace BE::RA
 {
-// RA ????????????????
-static const BE::Targeting::TargetInstrAdapter* s_raAdapter = nullptr;
-
-void setTargetInstrAdapter(const BE::Targeting::TargetInstrAdapter* adapter)
-{
-    s_raAdapter = adapter;
-}
-
 /*
  * ɨĴ (Linear Scan Register Allocation)
  *
  * 㷨:
- * 1. Ծ (Live Interval Analysis): ÿĴĻԾΧ (USE/DEF)
- * 2. Ծ乹: ݻԾԾ䡣
- * 3. ɨ: Ծ䣬Ĵ (Spill)
- * 4. ջ۷: ΪļĴջռ (Spill Slot)
- * 5. д: Ĵ滻ΪĴջʡ
+ * 1. ָ: ָţÿָĴܱŻ費ظö١
+ * 2. Ծ: ֻԿԾĴţλʾ USE/DEF/IN/OUT㡣
+ * 3. Ծ乹: ݻԾԾ䣨ܱŴУ
+ * 4. ɨ: Ծ䣬Ĵ (Spill)
+ * 5. ջ۷: ΪļĴջռ (Spill Slot)
+ * 6. д: Ĵ滻ΪĴջʡ
  */
 namespace
 {
@@ -55,7 +47,7 @@ namespace
         // 
         int assignedPhys    = -1;       // 䵽Ĵ ID
         int spillFrameIndex = -1;       // ʱջ֡
-        
+
         // Coalescing (ϲ) ָ
         Interval* parent = nullptr;
 
@@ -68,7 +60,7 @@ namespace
         void mergeFrom(Interval* other)
         {
             segs.insert(segs.end(), other->segs.begin(), other->segs.end());
-            merge(); 
+            merge();
             if (other->crossesCall) crossesCall = true;
         }
 
@@ -109,7 +101,7 @@ namespace
             std::sort(segs.begin(), segs.end(), [](const Segment& a, const Segment& b) {
                 return a.start < b.start;
             });
-            
+
             std::vector<Segment> merged;
             merged.push_back(segs[0]);
             for (size_t i = 1; i < segs.size(); ++i)
@@ -147,6 +139,17 @@ namespace
             }
             return false;
         }
+
+        // points 򣺶ÿζֲңΪ O( * log())
+        bool coversAny(const std::vector<int>& points) const
+        {
+            for (const auto& seg : segs)
+            {
+                auto it = std::lower_bound(points.begin(), points.end(), seg.start);
+                if (it != points.end() && *it < seg.end) return true;
+            }
+            return false;
+        }
     };
 
     struct IntervalOrder
@@ -162,26 +165,27 @@ namespace
 
     struct ActiveOrder
     {
+        //  Active  (std::push_heap/pop_heap)ѶΪλ
         bool operator()(const Interval* a, const Interval* b) const
         {
-            // λ ( Active б)
             if (a->endPoint() != b->endPoint())
-                return a->endPoint() < b->endPoint();
-            return a->vreg.rId < b->vreg.rId;
+                return a->endPoint() > b->endPoint();
+            return a->vreg.rId > b->vreg.rId;
         }
     };
 
+    // ĴĻid Ϊڵĳܱ
+    struct VRegRef
+    {
+        int          id;
+        BE::Register reg;
+    };
+
     bool isFloatType(BE::DataType* dt)
     {
         if (!dt) return false;
         return dt->dt == BE::DataType::Type::FLOAT;
     }
-
-    const BE::Targeting::TargetInstrAdapter* getAdapter()
-    {
-        if (s_raAdapter) return s_raAdapter;
-        return BE::Targeting::g_adapter;
-    }
 }  // namespace
 
 static std::vector<int> buildAllocatableInt(const BE::Targeting::TargetRegInfo& ri)
@@ -218,21 +222,11 @@ static std::vector<int> buildAllocatableFloat(const BE::Targeting::TargetRegInfo
 
 void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::TargetRegInfo& regInfo)
 {
-    fprintf(stderr, "DEBUG: RA allocateFunction for %s\n", func.name.c_str());
-    fflush(stderr);
-    
-    const auto* adapter = getAdapter();
+    const auto* adapter = adapter_ ? adapter_ : BE::Targeting::g_adapter;
     ASSERT(adapter && "TargetInstrAdapter is not set");
 
     if (func.blocks.empty()) return;
 
-    // 1. ָ (Number instructions)
-    fprintf(stderr, "DEBUG: RA Step 1: Number instructions\n");
-    fflush(stderr);
-    std::map<BE::Block*, std::pair<int, int>> blockRange;
-    std::set<int>                             callPoints;
-    int                                       ins_id = 0;
-
     //  blockId  Blockȷ˳ȷ
     std::vector<BE::Block*> orderedBlocks;
     for (auto& [bid, block] : func.blocks)
@@ -242,248 +236,255 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
     std::sort(orderedBlocks.begin(), orderedBlocks.end(), [](BE::Block* a, BE::Block* b) {
         return a->blockId < b->blockId;
     });
+    const int numBlocks = static_cast<int>(orderedBlocks.size());
 
-    for (auto* block : orderedBlocks)
+    // 1. ָ (Number instructions)
+    //  i ָ USE Ϊ operands[useBegin[i], defBegin[i])DEF Ϊ operands[defBegin[i], useBegin[i + 1])
+    // Ĵ״γֵ˳ܱţdenseOf[rId] ΪţvregInfo[] ΪĴϢ
+    std::vector<std::pair<int, int>> blockRange(numBlocks);
+    std::vector<int>                 callPoints;  // 
+    std::vector<VRegRef>             operands;
+    std::vector<int>                 useBegin, defBegin;
+    std::vector<int>                 denseOf(func.vregCount, -1);
+    std::vector<BE::Register>        vregInfo;
+    int                              ins_id = 0;
+
+    auto numberVReg = [&](const BE::Register& r) {
+        if (static_cast<size_t>(r.rId) >= denseOf.size()) denseOf.resize(r.rId + 1, -1);
+        int& id = denseOf[r.rId];
+        if (id < 0)
+        {
+            id = static_cast<int>(vregInfo.size());
+            vregInfo.push_back(r);
+        }
+        else if (vregInfo[id].dt == nullptr)
+            vregInfo[id] = r;
+        return id;
+    };
+
+    std::vector<BE::Register> uses, defs;
+    for (int b = 0; b < numBlocks; ++b)
     {
-        int start = ins_id;
-        // ÿָ ID  2Աָ֮ Move ָ Spill/Reload 룩
-        //  ID ں룬ԭָ ID Ϊż
+        BE::Block* block = orderedBlocks[b];
+        int        start = ins_id;
         for (auto it = block->insts.begin(); it != block->insts.end(); ++it)
         {
             if (!*it) continue;
-            // adapter->setInstructionId(*it, ins_id); // ѡָ ID
-            if (adapter->isCall(*it)) callPoints.insert(ins_id);
+            if (adapter->isCall(*it)) callPoints.push_back(ins_id);
+
+            uses.clear();
+            defs.clear();
+            adapter->enumUses(*it, uses);
+            adapter->enumDefs(*it, defs);
+
+            useBegin.push_back(static_cast<int>(operands.size()));
+            for (auto& u : uses)
+                if (u.isVreg) operands.push_back({numberVReg(u), u});
+            defBegin.push_back(static_cast<int>(operands.size()));
+            for (auto& d : defs)
+                if (d.isVreg) operands.push_back({numberVReg(d), d});
             ins_id++;
         }
         // ¼ָΧ [start, ins_id)
-        blockRange[block] = {start, ins_id};
+        blockRange[b] = {start, ins_id};
     }
+    useBegin.push_back(static_cast<int>(operands.size()));
+    const int numVRegs = static_cast<int>(vregInfo.size());
 
     // 2. USE/DEF 
-    fprintf(stderr, "DEBUG: RA Step 2: USE/DEF analysis\n");
-    fflush(stderr);
     // USE[B]:  Block B бʹãʹǰδ B бı
     // DEF[B]:  Block B бı
-    std::map<int, BE::Register> vregInfo;
-    std::map<BE::Block*, std::set<int>> USE, DEF;
-    
-    for (auto* block : orderedBlocks)
+    // ֻгĳ USE еĴſܻԾڻ߽ϣࣨʱֵ
+    // λ±ΪЩĴһ׳ܱ liveIndexglobalVRegs[liveIndex] ΪĴ
+    std::vector<std::vector<int>> exposedUses(numBlocks), blockDefs(numBlocks);
+    std::vector<int>              defStamp(numVRegs, -1), useStamp(numVRegs, -1);
+    for (int b = 0; b < numBlocks; ++b)
     {
-        std::set<int> use, def;
-        
-        
-        for (auto it = block->insts.begin(); it != block->insts.end(); ++it)
+        for (int i = blockRange[b].first; i < blockRange[b].second; ++i)
         {
-            if (!*it) continue;
-            std::vector<BE::Register> uses, defs;
-            adapter->enumUses(*it, uses);
-            adapter->enumDefs(*it, defs);
-
-            // 
-            if (block->blockId == 4) {
-                fprintf(stderr, "  Inst: uses=%zu defs=%zu\n", uses.size(), defs.size());
-                for (auto& u : uses) {
-                    if (u.isVreg && u.rId == 32) {
-                        fprintf(stderr, "    Found vreg32 in uses!\n");
-                    }
-                }
-            }
-
             //  USEڵǰ Block δ壨def ϣ use 
-            // ζŸñ live-in ĺѡ
-            for (auto& u : uses)
+            for (int k = useBegin[i]; k < defBegin[i]; ++k)
             {
-                if (u.isVreg) {
-                    int key = u.rId;
-                    if (!def.count(key)) 
-                        use.insert(key);
-                    if (vregInfo.find(key) == vregInfo.end() || vregInfo[key].dt == nullptr)
-                        vregInfo[key] = u;
-                }
+                int id = operands[k].id;
+                if (defStamp[id] == b || useStamp[id] == b) continue;
+                useStamp[id] = b;
+                exposedUses[b].push_back(id);
             }
-
             //  DEF def ϣκ use
-            for (auto& d : defs)
+            for (int k = defBegin[i]; k < useBegin[i + 1]; ++k)
             {
-                if (d.isVreg) {
-                    int key = d.rId;
-                    def.insert(key);
-                    if (vregInfo.find(key) == vregInfo.end() || vregInfo[key].dt == nullptr)
-                        vregInfo[key] = d;
-                }
+                int id = operands[k].id;
+                if (defStamp[id] == b) continue;
+                defStamp[id] = b;
+                blockDefs[b].push_back(id);
             }
         }
-        
-        //  Block4  USE 
-        if (block->blockId == 4) {
-            fprintf(stderr, "  Block4 final USE set: ");
-            for (int id : use) fprintf(stderr, "%d ", id);
-            fprintf(stderr, "\n");
+    }
+
+    std::vector<int> liveIndex(numVRegs, -1), globalVRegs;
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        for (int id : exposedUses[b])
+        {
+            if (liveIndex[id] >= 0) continue;
+            liveIndex[id] = static_cast<int>(globalVRegs.size());
+            globalVRegs.push_back(id);
         }
-        
-        USE[block] = std::move(use);
-        DEF[block] = std::move(def);
+    }
+    const int numGlobals = static_cast<int>(globalVRegs.size());
+
+    std::vector<Cele::dynamic_bitset> USE(numBlocks, Cele::dynamic_bitset(numGlobals));
+    std::vector<Cele::dynamic_bitset> DEF(numBlocks, Cele::dynamic_bitset(numGlobals));
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        for (int id : exposedUses[b]) USE[b].set(liveIndex[id]);
+        for (int id : blockDefs[b])
+            if (liveIndex[id] >= 0) DEF[b].set(liveIndex[id]);
     }
 
-    // 3. ͼ (CFG)
-    fprintf(stderr, "DEBUG: RA Step 3: Build CFG\n");
-    fflush(stderr);
+    // 3. ͼ (CFG)/ǰ orderedBlocks е±ʾ
     BE::MIR::CFGBuilder cfgBuilder(adapter);
     BE::MIR::CFG*       cfg = cfgBuilder.buildCFGForFunction(&func);
-    std::map<BE::Block*, std::vector<BE::Block*>> succs;
+    std::vector<int>    blockIndex(orderedBlocks.back()->blockId + 1, -1);
+    for (int b = 0; b < numBlocks; ++b) blockIndex[orderedBlocks[b]->blockId] = b;
 
-    for (auto* block : orderedBlocks)
+    std::vector<std::vector<int>> succs(numBlocks), preds(numBlocks);
+    for (int b = 0; b < numBlocks; ++b)
     {
-        if (block->blockId < cfg->graph.size())
+        BE::Block* block = orderedBlocks[b];
+        if (block->blockId >= cfg->graph.size()) continue;
+        for (auto* succBlock : cfg->graph[block->blockId])
         {
-            for (auto* succBlock : cfg->graph[block->blockId])
-            {
-                succs[block].push_back(succBlock);
-            }
+            int s = blockIndex[succBlock->blockId];
+            succs[b].push_back(s);
+            preds[s].push_back(b);
         }
     }
+    delete cfg;
 
     // 4. Ծ (Backward Dataflow: IN[B] = USE[B] U (OUT[B] - DEF[B]))
-    fprintf(stderr, "DEBUG: RA Step 4: Liveness Analysis\n");
-    fflush(stderr);
-    std::map<BE::Block*, std::set<int>> IN, OUT;
-    
-    // ʼ IN = USE (ʼ)
-    for (auto* block : orderedBlocks)
-    {
-        IN[block] = USE[block];
-    }
-
-    bool changed = true;
-    while (changed)
+    // ⰴ CFG ĺǰIN ıʱֻǰ¼빤
+    std::vector<int>                 postorder;
+    std::vector<char>                visited(numBlocks, 0);
+    std::vector<std::pair<int, int>> dfsStack;
+    postorder.reserve(numBlocks);
+    for (int root = 0; root < numBlocks; ++root)
     {
-        changed = false;
-        //  (reverse order)
-        for (auto it = orderedBlocks.rbegin(); it != orderedBlocks.rend(); ++it)
+        if (visited[root]) continue;
+        visited[root] = 1;
+        dfsStack.push_back({root, 0});
+        while (!dfsStack.empty())
         {
-            BE::Block* block = *it;
-
-            std::set<int> newOUT;
-            for (auto* s : succs[block])
-            {
-                // OUT[B] = U(IN[Successors])
-                const auto& succIN = IN[s];
-                newOUT.insert(succIN.begin(), succIN.end());
-            }
-
-            // IN[B] = USE[B] U (OUT[B] - DEF[B])
-            std::set<int> newIN = USE[block];
-            for (auto& r : newOUT)
+            auto& [b, next] = dfsStack.back();
+            if (next < static_cast<int>(succs[b].size()))
             {
-                if (!DEF[block].count(r))
+                int s = succs[b][next++];
+                if (!visited[s])
                 {
-                    newIN.insert(r);
+                    visited[s] = 1;
+                    dfsStack.push_back({s, 0});
                 }
+                continue;
             }
-
-            if (newOUT != OUT[block] || newIN != IN[block])
-            {
-                OUT[block] = std::move(newOUT);
-                IN[block]  = std::move(newIN);
-                changed    = true;
-            }
+            postorder.push_back(b);
+            dfsStack.pop_back();
         }
     }
-    delete cfg;
 
-    fprintf(stderr, "DEBUG: Liveness for vreg32 (rId=32):\n");
-    for (auto* block : orderedBlocks) {
-        bool inUSE = USE[block].count(32);
-        bool inDEF = DEF[block].count(32);
-        bool inIN = IN[block].count(32);
-        bool inOUT = OUT[block].count(32);
-        if (inUSE || inDEF || inIN || inOUT) {
-            fprintf(stderr, "  Block%u: USE=%d DEF=%d IN=%d OUT=%d\n",
-                    block->blockId, inUSE, inDEF, inIN, inOUT);
+    std::vector<Cele::dynamic_bitset> IN(numBlocks, Cele::dynamic_bitset(numGlobals));
+    std::vector<Cele::dynamic_bitset> OUT(numBlocks, Cele::dynamic_bitset(numGlobals));
+    std::deque<int>                   worklist(postorder.begin(), postorder.end());
+    std::vector<char>                 queued(numBlocks, 1);
+    while (!worklist.empty())
+    {
+        int b = worklist.front();
+        worklist.pop_front();
+        queued[b] = 0;
+
+        // OUT[B] = U(IN[Successors])IN ֻ OUT ԭز
+        for (int s : succs[b]) OUT[b].union_with(IN[s]);
+        if (!IN[b].assign_union_difference(USE[b], OUT[b], DEF[b])) continue;
+
+        for (int p : preds[b])
+        {
+            if (queued[p]) continue;
+            queued[p] = 1;
+            worklist.push_back(p);
         }
     }
 
-    // 5. Ծ (Build Intervals)
-    fprintf(stderr, "DEBUG: RA Step 5: Build Intervals\n");
-    fflush(stderr);
-    std::map<int, Interval> intervals;
+    // 5. Ծ (Build Intervals)±Ϊܱ
+    std::vector<Interval> intervals(numVRegs);
+    std::vector<char>     hasInterval(numVRegs, 0);
+    auto                  touch = [&](const VRegRef& ref) {
+        Interval& interval = intervals[ref.id];
+        if (!hasInterval[ref.id])
+        {
+            hasInterval[ref.id] = 1;
+            interval.vreg       = ref.reg;
+        }
+        else if (interval.vreg.dt == nullptr && ref.reg.dt != nullptr)
+            interval.vreg.dt = ref.reg.dt;
+    };
 
-    for (auto* block : orderedBlocks)
+    // ɨʱĻԾĴΪ±꣺ block ʱ OUT λ
+    // ɨ赽 block ͷʱԱǵǡΪ IN[B] IN ˲Ҫ
+    std::vector<char> live(numVRegs, 0);
+    std::vector<int>  rangeEnd(numVRegs, 0);
+    for (int b = 0; b < numBlocks; ++b)
     {
-        int blockStart = blockRange[block].first;
-        int blockEnd   = blockRange[block].second;
+        int blockStart = blockRange[b].first;
+        int blockEnd   = blockRange[b].second;
 
         // live ϳʼΪ block  OUT 
-        // Щ block ʱȻԾ
-        std::set<int> live = OUT[block];
-
-        // ¼ԾΧյ㡣 OUT еı block ڵĻԾΧ쵽 blockEnd
-        std::map<int, int> rangeEnd;
-        for (int rId : live)
-        {
-            rangeEnd[rId] = blockEnd;
-            if (intervals.find(rId) == intervals.end() && vregInfo.count(rId)) {
-                intervals[rId].vreg = vregInfo[rId];
+        // Щ block ʱȻԾ block ڵĻԾΧ쵽 blockEnd
+        OUT[b].for_each_set([&](size_t k) {
+            int v       = globalVRegs[k];
+            live[v]     = 1;
+            rangeEnd[v] = blockEnd;
+            if (!hasInterval[v])
+            {
+                hasInterval[v]    = 1;
+                intervals[v].vreg = vregInfo[v];
             }
-        }
+        });
 
-        int pos = blockEnd - 1;
         // ָ»Ծ
-        for (auto it = block->insts.rbegin(); it != block->insts.rend(); ++it, --pos)
+        for (int pos = blockEnd - 1; pos >= blockStart; --pos)
         {
-            BE::MInstruction* inst = *it;
-            if (!inst) continue;
-
-            std::vector<BE::Register> uses, defs;
-            adapter->enumUses(inst, uses);
-            adapter->enumDefs(inst, defs);
-
             //  DEF̻Ծ
-            for (auto& d : defs)
+            for (int k = defBegin[pos]; k < useBegin[pos + 1]; ++k)
             {
-                if (!d.isVreg) continue;
-                int rId = d.rId;
-                
-                if (intervals.find(rId) == intervals.end()) {
-                    intervals[rId].vreg = d;
-                } else if (intervals[rId].vreg.dt == nullptr && d.dt != nullptr) {
-                    intervals[rId].vreg.dt = d.dt;
-                }
+                const VRegRef& d = operands[k];
+                touch(d);
 
-                if (live.count(rId))
+                if (live[d.id])
                 {
                     // ڵǰλñ壬ĻԾΧ [pos, rangeEnd)
                     // ͬʱ live ƳΪڴ֮ǰϣٻԾֱ USE
-                    intervals[rId].addSegment(pos, rangeEnd[rId]);
-                    live.erase(rId);
-                    rangeEnd.erase(rId);
+                    intervals[d.id].addSegment(pos, rangeEnd[d.id]);
+                    live[d.id] = 0;
                 }
                 else
                 {
                     // һ Dead Definition (˵δʹ)ֻǾֲ
                     // ΪȷԣһΪ 1  [pos, pos+1)
-                    intervals[rId].addSegment(pos, pos + 1);
+                    intervals[d.id].addSegment(pos, pos + 1);
                 }
             }
 
             //  USEӳԾ䣨ǰ죩
-            for (auto& u : uses)
+            for (int k = useBegin[pos]; k < defBegin[pos]; ++k)
             {
-                if (!u.isVreg) continue;
-                int rId = u.rId;
-                
-                if (intervals.find(rId) == intervals.end()) {
-                    intervals[rId].vreg = u;
-                } else if (intervals[rId].vreg.dt == nullptr && u.dt != nullptr) {
-                    intervals[rId].vreg.dt = u.dt;
-                }
+                const VRegRef& u = operands[k];
+                touch(u);
 
-                if (!live.count(rId))
+                if (!live[u.id])
                 {
                     // ڴ˴ʹãΪԾ
                     // ĻԾΧյݶΪ pos+1 (ΪִָҪ)
-                    live.insert(rId);
-                    rangeEnd[rId] = pos + 1;
+                    live[u.id]     = 1;
+                    rangeEnd[u.id] = pos + 1;
                 }
                 // Ѿ live У˵ǴӸλôģֻмʹõ㣬Ҫı rangeEnd
             }
@@ -491,53 +492,21 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
 
         //  block  live-in 
         //  block ʼǻԾģΧ [blockStart, rangeEnd)
-        for (int rId : live)
-        {
-            intervals[rId].addSegment(blockStart, rangeEnd[rId]);
-        }
+        IN[b].for_each_set([&](size_t k) {
+            int v = globalVRegs[k];
+            intervals[v].addSegment(blockStart, rangeEnd[v]);
+            live[v] = 0;
+        });
     }
 
     // Խõ
-    fprintf(stderr, "DEBUG: CallPoints: ");
-    for (int cp : callPoints) fprintf(stderr, "%d ", cp);
-    fprintf(stderr, "\n");
-
-    for (auto& [rId, interval] : intervals)
+    for (auto& interval : intervals)
     {
         interval.merge();
-        for (int callPt : callPoints)
-        {
-            if (interval.covers(callPt))
-            {
-                interval.crossesCall = true;
-                break;
-            }
-        }
-    }
-
-    fprintf(stderr, "DEBUG: Interval for vreg32 (b8):\n");
-    for (auto& [rId, interval] : intervals) {
-        if (rId == 32) {
-            fprintf(stderr, "  vreg32: segments = ");
-            for (auto& seg : interval.segs) {
-                fprintf(stderr, "[%d,%d) ", seg.start, seg.end);
-            }
-            fprintf(stderr, ", crossesCall = %d\n", interval.crossesCall);
-            break;
-        }
+        if (interval.coversAny(callPoints)) interval.crossesCall = true;
     }
 
     // 6. Ĵ (Allocate Registers)
-    fprintf(stderr, "DEBUG: RA Step 6: Allocate Registers\n");
-    fflush(stderr);
-    
-    // === Move Coalescing (ϲ) ===
-    // 򵥵ĺϲԣҪڹʱɵģٴȷǺϲ
-    for (auto& [rId, interval] : intervals)
-    {
-        interval.merge();
-    }
-
     auto allIntRegs   = buildAllocatableInt(regInfo);
     auto allFloatRegs = buildAllocatableFloat(regInfo);
 
@@ -546,7 +515,7 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
     // 򵥲ԣӿɷбƳ 2 Ϊ Scratch
     std::vector<int> scratchInts;
     std::vector<int> scratchFloats;
-    
+
     //  2 Ĵ
     for (int i = 0; i < 2; ++i)
     {
@@ -556,7 +525,7 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
             allIntRegs.pop_back();
         }
     }
-    
+
     //  2 Ĵ
     for (int i = 0; i < 2; ++i)
     {
@@ -569,11 +538,11 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
 
     // ͸ (ΪʹòͬļĴļ)
     std::vector<Interval*> intIntervals, floatIntervals;
-    for (auto& [rId, interval] : intervals)
+    for (auto& interval : intervals)
     {
         // ϲ ( Leader)
         if (interval.parent != nullptr) continue;
-        
+
         if (interval.segs.empty()) continue;
         if (isFloatType(interval.vreg.dt))
             floatIntervals.push_back(&interval);
@@ -589,27 +558,35 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
     auto allocateRegs = [&](std::vector<Interval*>& intervalList,
                             const std::vector<int>& allocatable,
                             const std::vector<int>& calleeSaved) {
-        std::set<int> calleeSavedSet(calleeSaved.begin(), calleeSaved.end());
-        // Active бǰռüĴ䣬λ
-        std::set<Interval*, ActiveOrder> active;
-        std::set<int> freeRegs(allocatable.begin(), allocatable.end());
+        // мĴ Callee-Saved ĴΪĴ ID Ϊ±λ ID ѡ
+        int maxReg = -1;
+        for (int r : allocatable) maxReg = std::max(maxReg, r);
+        for (int r : calleeSaved) maxReg = std::max(maxReg, r);
+        Cele::dynamic_bitset freeRegs(maxReg + 1), calleeSavedSet(maxReg + 1);
+        for (int r : allocatable) freeRegs.set(r);
+        for (int r : calleeSaved) calleeSavedSet.set(r);
+
+        //  ID СǷΪ Callee-Saved  wantCalleeSaved һµĿмĴ
+        auto pickFree = [&](bool wantCalleeSaved) {
+            for (size_t r = freeRegs.find_first(); r != Cele::dynamic_bitset::npos; r = freeRegs.find_next(r))
+                if (calleeSavedSet.test(r) == wantCalleeSaved) return static_cast<int>(r);
+            return -1;
+        };
+
+        // Active ѣǰռüĴ䣬ѶΪλ
+        std::vector<Interval*> active;
+        ActiveOrder            activeOrder;
 
         for (auto* interval : intervalList)
         {
             int curStart = interval->startPoint();
 
             // 1. ھ䣺ͷŽλڵǰ俪ʼλ֮ǰļĴ
-            for (auto it = active.begin(); it != active.end(); )
+            while (!active.empty() && active.front()->endPoint() <= curStart)
             {
-                if ((*it)->endPoint() <= curStart)
-                {
-                    freeRegs.insert((*it)->assignedPhys);
-                    it = active.erase(it);
-                }
-                else
-                {
-                    ++it;
-                }
+                freeRegs.set(active.front()->assignedPhys);
+                std::pop_heap(active.begin(), active.end(), activeOrder);
+                active.pop_back();
             }
 
             int selectedReg = -1;
@@ -619,68 +596,42 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
             // ڵڼ䲻Ҫ/ָɱ߸𣬻ֻҪһΣ
             if (interval->crossesCall)
             {
-                for (int r : freeRegs)
-                {
-                    if (calleeSavedSet.count(r))
-                    {
-                        selectedReg = r;
-                        break;
-                    }
-                }
+                selectedReg = pickFree(true);
             }
             else
             {
                 // Խãʹ Caller-Saved (ʱĴ)ⲻҪ Callee-Saved /ָ
-                for (int r : freeRegs)
-                {
-                    if (!calleeSavedSet.count(r))
-                    {
-                        selectedReg = r;
-                        break;
-                    }
-                }
+                selectedReg = pickFree(false);
                 //  Caller-Saved ˣٳ Callee-Saved
-                if (selectedReg == -1)
-                {
-                    for (int r : freeRegs)
-                    {
-                        if (calleeSavedSet.count(r))
-                        {
-                            selectedReg = r;
-                            break;
-                        }
-                    }
-                }
+                if (selectedReg == -1) selectedReg = pickFree(true);
             }
 
             if (selectedReg != -1)
             {
                 // ɹ
                 interval->assignedPhys = selectedReg;
-                freeRegs.erase(selectedReg);
-                active.insert(interval);
+                freeRegs.reset(selectedReg);
+                active.push_back(interval);
+                std::push_heap(active.begin(), active.end(), activeOrder);
             }
             else
             {
                 // 3.  (Spilling)
                 // ʽλ (Spill the interval that ends the latest)
-                // ̶ȵͷżĴԴ
+                // ̶ȵͷżĴԴλͬʱȡ vreg С
                 Interval* spillCandidate = interval;
                 for (auto* act : active)
                 {
-                    // ע⣺ǿԽõ䣬ռ Caller-SavedͨӦ Spill 
-                    // ߼ȽϽλ
-                    
-                    // ǰ interval Խã active е Callee-Saved
-                    // ǲܼռȷ Callee-Saved Ҳܱ Spill
-                    // ߼Ҫڽλá
-                    if (interval->crossesCall && !calleeSavedSet.count(act->assignedPhys))
+                    // ǰ interval Խã active е Caller-Saved
+                    // ռļĴڵôᱻƻԹ
+                    if (interval->crossesCall && !calleeSavedSet.test(act->assignedPhys))
                     {
-                        // Թ
                         continue;
                     }
 
-                    if (act->endPoint() > spillCandidate->endPoint())
+                    if (act->endPoint() > spillCandidate->endPoint() ||
+                        (spillCandidate != interval && act->endPoint() == spillCandidate->endPoint() &&
+                            act->vreg.rId < spillCandidate->vreg.rId))
                     {
                         spillCandidate = act;
                     }
@@ -692,8 +643,9 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
                     interval->assignedPhys = spillCandidate->assignedPhys;
                     spillCandidate->assignedPhys = -1;
                     spillCandidate->spillFrameIndex = func.frameInfo.createSpillSlot(8, 8); //  8 ֽջ
-                    active.erase(spillCandidate);
-                    active.insert(interval);
+                    active.erase(std::find(active.begin(), active.end(), spillCandidate));
+                    active.push_back(interval);
+                    std::make_heap(active.begin(), active.end(), activeOrder);
                 }
                 else
                 {
@@ -708,38 +660,32 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
     allocateRegs(floatIntervals, allFloatRegs, regInfo.calleeSavedFloatRegs());
 
     // 7. д MIR (Rewrite MIR)
-    fprintf(stderr, "DEBUG: RA Step 7: Rewrite MIR\n");
-    fflush(stderr);
-    std::map<int, Interval*> vregToInterval;
-    for (auto& [rId, interval] : intervals)
-    {
-        vregToInterval[rId] = interval.getLeader();
-    }
+    auto intervalOf = [&](const BE::Register& r) -> Interval* {
+        if (static_cast<size_t>(r.rId) >= denseOf.size() || denseOf[r.rId] < 0) return nullptr;
+        return intervals[denseOf[r.rId]].getLeader();
+    };
 
     for (auto* block : orderedBlocks)
     {
-        for (size_t idx = 0; idx < block->insts.size(); ++idx)
+        for (auto instIt = block->insts.begin(); instIt != block->insts.end();)
         {
-            BE::MInstruction* inst = block->insts[idx];
-            if (!inst) continue;
+            BE::MInstruction* inst = *instIt;
 
-            std::vector<BE::Register> uses, defs;
+            uses.clear();
+            defs.clear();
             adapter->enumUses(inst, uses);
             adapter->enumDefs(inst, defs);
 
             //  USE
             int spillUseCountInt = 0;
             int spillUseCountFloat = 0;
-            int reloadInserted = 0;  // ¼˶ reload ָԱ idx
 
             for (auto& u : uses)
             {
                 if (!u.isVreg) continue;
-                int rId = u.rId;
-                auto intervalIt = vregToInterval.find(rId);
-                if (intervalIt == vregToInterval.end()) continue;
+                Interval* interval = intervalOf(u);
+                if (interval == nullptr) continue;
 
-                Interval* interval = intervalIt->second;
                 if (interval->assignedPhys >= 0)
                 {
                     // ѷĴֱ滻
@@ -753,7 +699,7 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
                     // Ҫʹ Scratch Ĵջ Reload
                     DataType* finalDt = interval->vreg.dt != nullptr ? interval->vreg.dt : u.dt;
                     bool isFloat = isFloatType(finalDt);
-                    
+
                     int scratch = -1;
                     if (isFloat)
                     {
@@ -774,26 +720,19 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
                     }
 
                     BE::Register scratchReg(scratch, finalDt, false);
-                    // ڵǰָǰ reload
-                    auto it = block->insts.begin() + idx + reloadInserted;
-                    adapter->insertReloadBefore(block, it, scratchReg, interval->spillFrameIndex);
-                    reloadInserted++;  // ƫ
+                    // ڵǰָǰ reloadinstIt ָǰָ
+                    adapter->insertReloadBefore(block, instIt, scratchReg, interval->spillFrameIndex);
                     adapter->replaceUse(inst, u, scratchReg);
                 }
             }
 
-            //  idx² reload ָ
-            idx += reloadInserted;
-
             //  DEF
             for (auto& d : defs)
             {
                 if (!d.isVreg) continue;
-                int rId = d.rId;
-                auto intervalIt = vregToInterval.find(rId);
-                if (intervalIt == vregToInterval.end()) continue;
+                Interval* interval = intervalOf(d);
+                if (interval == nullptr) continue;
 
-                Interval* interval = intervalIt->second;
                 if (interval->assignedPhys >= 0)
                 {
                     DataType* finalDt = interval->vreg.dt != nullptr ? interval->vreg.dt : d.dt;
@@ -806,7 +745,7 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
                     // д ScratchȻ Spill ջ
                     DataType* finalDt = interval->vreg.dt != nullptr ? interval->vreg.dt : d.dt;
                     bool isFloat = isFloatType(finalDt);
-                    
+
                     int scratch = -1;
                     if (isFloat)
                     {
@@ -826,20 +765,18 @@ void LinearScanRA::allocateFunction(BE::Function& func, const BE::Targeting::Tar
                     BE::Register scratchReg(scratch, finalDt, false);
                     adapter->replaceDef(inst, d, scratchReg);
                     // ڵǰָ spill
-                    auto it = block->insts.begin() + idx;
-                    adapter->insertSpillAfter(block, it, scratchReg, interval->spillFrameIndex);
-                    // ע⣺insertSpillAfter ı idxΪ idx ֮
+                    adapter->insertSpillAfter(block, instIt, scratchReg, interval->spillFrameIndex);
                 }
             }
 
             // Ƴ Move ָ (Coalescing Ч: MOV x, x)
             BE::Register pDst, pSrc;
-            inst = block->insts[idx];  // »ȡָԷ vector ݣȻﲻ̫ʧЧ
             if (adapter->isCopy(inst, pDst, pSrc) && pDst.rId == pSrc.rId && pDst.isVreg == pSrc.isVreg)
             {
-                block->insts.erase(block->insts.begin() + idx);
-                --idx;  //  idxΪɾ˵ǰԪ
+                instIt = block->insts.erase(instIt);
+                continue;
             }
+            ++instIt;
         }
     }
 }
@@ -9,7 +9,13 @@ namespace BE::RA
     class LinearScanRA : public RegisterAllocator<LinearScanRA>
     {
       public:
+        // adapter 为空时退回到全局的 BE::Targeting::g_adapter
+        explicit LinearScanRA(const BE::Targeting::TargetInstrAdapter* adapter = nullptr) : adapter_(adapter) {}
+
         void allocateFunction(BE::Function& func, const BE::Targeting::TargetRegInfo& regInfo);
+
+      private:
+        const BE::Targeting::TargetInstrAdapter* adapter_;
     };
 }  // namespace BE::RA
 
@@ -0,0 +1,231 @@
+#include <backend/target/function_cache.h>
+#include <middleend/module/ir_module.h>
+#include <middleend/visitor/printer/module_printer.h>
+#include <mapped_file.h>
+#include <out_buffer.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <string_view>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace BE::Targeting
+{
+    namespace
+    {
+        constexpr std::string_view entryMagic  = "sysy-asm-cache 1";
+        constexpr std::string_view entrySuffix = ".asm";
+
+        uint64_t fmix64(uint64_t h)
+        {
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        // 两路互不相关的 64 位哈希拼成 128 位键：FNV-1a 与逐字节乘加后再做 xorshift 的混合
+        class KeyHasher
+        {
+          private:
+            uint64_t a = 0xcbf29ce484222325ULL;
+            uint64_t b = 0x9e3779b97f4a7c15ULL;
+
+          public:
+            void update(std::string_view s)
+            {
+                for (unsigned char c : s)
+                {
+                    a = (a ^ c) * 0x100000001b3ULL;
+                    b = (b + c + 1) * 0xbf58476d1ce4e5b9ULL;
+                    b ^= b >> 31;
+                }
+                // 分隔各段，避免 "ab"+"c" 与 "a"+"bc" 得到相同的键
+                a = (a ^ 0xff) * 0x100000001b3ULL;
+                b = fmix64(b + s.size());
+            }
+
+            std::string hex() const
+            {
+                std::ostringstream os;
+                os << std::hex << std::setfill('0') << std::setw(16) << fmix64(a) << std::setw(16) << fmix64(b);
+                return os.str();
+            }
+        };
+
+        // 编译器可执行文件的大小与修改时间：重新编译编译器后旧的条目自然不再命中
+        std::string compilerIdentity()
+        {
+            std::error_code ec;
+            fs::path        exe = fs::read_symlink("/proc/self/exe", ec);
+            if (ec) return "unknown";
+            auto size  = fs::file_size(exe, ec);
+            auto mtime = fs::last_write_time(exe, ec);
+            if (ec) return "unknown";
+            return std::to_string(size) + ":" + std::to_string(mtime.time_since_epoch().count());
+        }
+
+        std::string printFunction(ME::Function& function)
+        {
+            std::ostringstream os;
+            {
+                OutBuffer     out(os);
+                ME::IRPrinter printer;
+                printer.visit(function, out);
+            }
+            return os.str();
+        }
+    }  // namespace
+
+    FunctionCache::FunctionCache(const std::string& dir, uint64_t limitBytes)
+        : dir(dir), limitBytes(limitBytes), options(), keys(), cachedAsm(), hit(), stats()
+    {}
+
+    bool FunctionCache::open(std::string& error)
+    {
+        std::error_code ec;
+        fs::create_directories(dir, ec);
+        if (ec || !fs::is_directory(dir, ec))
+        {
+            error = "cannot create cache directory '" + dir + "'" + (ec ? ": " + ec.message() : std::string());
+            return false;
+        }
+        return true;
+    }
+
+    void FunctionCache::probe(ME::Module& module)
+    {
+        std::string salt = std::string(entryMagic) + "\n" + compilerIdentity() + "\n" + options;
+
+        size_t n = module.functions.size();
+        keys.assign(n, std::string());
+        cachedAsm.assign(n, std::string());
+        hit.assign(n, 0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            KeyHasher hasher;
+            hasher.update(salt);
+            hasher.update(printFunction(*module.functions[i]));
+            keys[i] = hasher.hex();
+
+            // 条目格式："<magic> <键> <汇编字节数>\n" 后接汇编文本；格式不符或长度不对（写了一半）都按未命中处理
+            fs::path    path = fs::path(dir) / (keys[i] + std::string(entrySuffix));
+            MappedFile  file;
+            std::string err;
+            if (!file.open(path.string(), err))
+            {
+                ++stats.misses;
+                continue;
+            }
+            std::string_view data   = file.view();
+            std::string      header = std::string(entryMagic) + " " + keys[i] + " ";
+            size_t           eol    = data.find('\n');
+            if (eol == std::string_view::npos || data.substr(0, header.size()) != header ||
+                data.substr(header.size(), eol - header.size()) != std::to_string(data.size() - eol - 1))
+            {
+                ++stats.misses;
+                continue;
+            }
+            cachedAsm[i] = std::string(data.substr(eol + 1));
+            hit[i]       = 1;
+            ++stats.hits;
+
+            std::error_code ec;
+            fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+        }
+    }
+
+    void FunctionCache::store(size_t idx, const std::string& text)
+    {
+        if (idx >= keys.size() || keys[idx].empty() || hit[idx]) return;
+
+        fs::path path = fs::path(dir) / (keys[idx] + std::string(entrySuffix));
+        fs::path tmp  = fs::path(dir) / (keys[idx] + ".tmp." + std::to_string(getpid()));
+        std::error_code ec;
+        {
+            std::ofstream out(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (out) out << entryMagic << ' ' << keys[idx] << ' ' << text.size() << '\n' << text << std::flush;
+            if (!out)
+            {
+                fs::remove(tmp, ec);
+                return;
+            }
+        }
+
+        fs::rename(tmp, path, ec);
+        if (ec)
+        {
+            fs::remove(tmp, ec);
+            return;
+        }
+        ++stats.stores;
+    }
+
+    void FunctionCache::discard(size_t idx)
+    {
+        if (idx < keys.size()) keys[idx].clear();
+    }
+
+    void FunctionCache::finish()
+    {
+        struct Entry
+        {
+            fs::file_time_type mtime;
+            uint64_t           size;
+            fs::path           path;
+        };
+        std::vector<Entry> entries;
+
+        std::error_code ec;
+        for (auto it = fs::directory_iterator(dir, ec); !ec && it != fs::directory_iterator(); it.increment(ec))
+        {
+            if (it->path().extension() != entrySuffix) continue;
+            std::error_code entryEc;
+            Entry           entry{it->last_write_time(entryEc), it->file_size(entryEc), it->path()};
+            if (!entryEc) entries.push_back(std::move(entry));
+        }
+
+        stats.bytes = 0;
+        for (auto& entry : entries) stats.bytes += entry.size;
+
+        if (stats.bytes > limitBytes)
+        {
+            // 最久没有被读写过的条目先淘汰
+            std::sort(entries.begin(), entries.end(), [](const Entry& x, const Entry& y) { return x.mtime < y.mtime; });
+            for (auto& entry : entries)
+            {
+                if (stats.bytes <= limitBytes) break;
+                if (!fs::remove(entry.path, ec) || ec) continue;
+                stats.bytes -= entry.size;
+                ++stats.evictions;
+            }
+        }
+        stats.entries = entries.size() - stats.evictions;
+    }
+
+    void FunctionCache::report(std::ostream& os) const
+    {
+        size_t lookups = stats.hits + stats.misses;
+        double rate    = lookups ? stats.hits * 100.0 / lookups : 0.0;
+
+        os << "===" << std::string(60, '-') << "===\n";
+        os << "                 Function cache report\n";
+        os << "===" << std::string(60, '-') << "===\n";
+        os << "  Directory: " << dir << "\n";
+        os << "  Hits: " << stats.hits << "  Misses: " << stats.misses << "  (" << std::fixed << std::setprecision(1)
+           << rate << "% hit rate)\n";
+        os << "  Stored: " << stats.stores << "  Evicted: " << stats.evictions << "\n";
+        os << "  Size: " << stats.entries << " entries, " << std::setprecision(1) << stats.bytes / 1024.0 << " KiB of "
+           << limitBytes / 1024.0 << " KiB\n";
+        os.unsetf(std::ios_base::floatfield);
+        os << std::setprecision(6);
+    }
+}  // namespace BE::Targeting
@@ -0,0 +1,70 @@
+#ifndef __BACKEND_TARGET_FUNCTION_CACHE_H__
+#define __BACKEND_TARGET_FUNCTION_CACHE_H__
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace ME
+{
+    class Module;
+}
+
+namespace BE::Targeting
+{
+    /*
+     * 按内容寻址的函数汇编缓存（-cache-dir=DIR）：
+     * - 键是 IR 生成后、优化前的函数 IR 文本与编译选项（目标、流水线、编译器本身）的 128 位哈希；
+     *   指令选择只依据函数自身的 IR，全局变量与被调函数都按符号名引用，因此同一函数的汇编只由键决定
+     * - probe 之后，命中的函数跳过中端优化与整条后端流水线，输出时直接拼入缓存中的汇编文本
+     * - 每个条目是目录下的一个文件，先写临时文件再改名，多个编译进程同时使用同一目录也不会读到半个条目；
+     *   命中时更新文件的修改时间，finish 时按修改时间从旧到新淘汰，直到总大小不超过上限（LRU）
+     * - 缓存只是加速手段，目录读写失败时按未命中处理，不影响编译结果
+     */
+    class FunctionCache
+    {
+      public:
+        struct Stats
+        {
+            size_t   hits      = 0;
+            size_t   misses    = 0;
+            size_t   stores    = 0;
+            size_t   evictions = 0;
+            size_t   entries   = 0;  // finish 之后目录中的条目数与总字节数
+            uint64_t bytes     = 0;
+        };
+
+      private:
+        std::string              dir;
+        uint64_t                 limitBytes;
+        std::string              options;
+        std::vector<std::string> keys;       // 第 i 个函数的键（十六进制），空串表示不写回缓存
+        std::vector<std::string> cachedAsm;  // 命中的函数的汇编文本
+        std::vector<char>        hit;
+        Stats                    stats;
+
+      public:
+        FunctionCache(const std::string& dir, uint64_t limitBytes);
+
+        // 创建缓存目录，失败时返回 false 并在 error 中给出原因
+        bool open(std::string& error);
+        // 参与计算键的编译选项，须在 probe 之前设置
+        void setOptions(const std::string& opts) { options = opts; }
+
+        // 用优化前的 IR 为 module 中每个函数计算键并查找缓存，之后按函数在 module.functions 中的下标访问
+        void               probe(ME::Module& module);
+        bool               isHit(size_t idx) const { return idx < hit.size() && hit[idx]; }
+        const std::string& cachedText(size_t idx) const { return cachedAsm[idx]; }
+        // 未命中的函数生成汇编后写回；discard 之后的函数（例如因预算被降级优化的）不写回
+        void store(size_t idx, const std::string& text);
+        void discard(size_t idx);
+        // 按 LRU 淘汰超出上限的条目并统计目录大小
+        void finish();
+
+        const Stats& getStats() const { return stats; }
+        void         report(std::ostream& os) const;
+    };
+}  // namespace BE::Targeting
+
+#endif  // __BACKEND_TARGET_FUNCTION_CACHE_H__
@@ -12,6 +12,7 @@ namespace ME
 {
     class Module;
     class Block;
+    class PassTimer;
 }  // namespace ME
 namespace BE
 {
@@ -20,6 +21,8 @@ namespace BE
 
 namespace BE::Targeting
 {
+    class FunctionCache;
+
     class BackendTarget
     {
       public:
@@ -37,6 +40,16 @@ namespace BE::Targeting
 
         virtual const char* getName() const = 0;
 
+        // -j N：后端流水线中按函数执行的部分最多使用的线程数
+        void   setJobs(size_t n) { jobs = n ? n : 1; }
+        size_t getJobs() const { return jobs; }
+
+        // -time-passes：非空时后端各阶段按函数计时并累加到 t 中，与中端 Pass 一同输出
+        void setTimer(ME::PassTimer* t) { timer = t; }
+
+        // -cache-dir：非空时命中缓存的函数直接输出缓存中的汇编，其余函数生成后写回缓存
+        void setFunctionCache(FunctionCache* c) { cache = c; }
+
         void buildDAG(ME::Module* ir)
         {
             DAG::DAGBuilder builder;
@@ -53,6 +66,11 @@ namespace BE::Targeting
             }
         }
         virtual void runPipeline(ME::Module* ir, BE::Module* backend, std::ostream* out) = 0;
+
+      protected:
+        size_t         jobs  = 1;
+        ME::PassTimer* timer = nullptr;
+        FunctionCache* cache = nullptr;
     };
 }  // namespace BE::Targeting
 
@@ -85,7 +85,7 @@ namespace BE::Targeting
 
         // ?? it ???????????????????? frameIndex ????? physReg ?????reload??
         // ?? RA ??????????? use ?????
-        virtual void insertReloadBefore(BE::Block* block, std::deque<BE::MInstruction*>::iterator it,
+        virtual void insertReloadBefore(BE::Block* block, BE::Block::iterator it,
             const BE::Register& physReg, int frameIndex) const
         {
             ERROR("Using base target instruction adapter insertReloadBefore method is not allowed");
@@ -93,7 +93,7 @@ namespace BE::Targeting
 
         // ?? it ??????????????? physReg ??????? frameIndex ???????spill??
         // ?? RA ??????????? def ?????
-        virtual void insertSpillAfter(BE::Block* block, std::deque<BE::MInstruction*>::iterator it,
+        virtual void insertSpillAfter(BE::Block* block, BE::Block::iterator it,
             const BE::Register& physReg, int frameIndex) const
         {
             ERROR("Using base target instruction adapter insertSpillAfter method is not allowed");
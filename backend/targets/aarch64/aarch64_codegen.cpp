@@ -1,81 +1,137 @@
 #include <backend/targets/aarch64/aarch64_codegen.h>
 #include <backend/targets/aarch64/aarch64_defs.h>
-#include <sstream>
 
 namespace BE::AArch64
 {
-    static std::string formatOperand(Operand* op)
+    // Ĵֱд formatRegister Ľһ
+    static void writeRegister(OutBuffer& out, const Register& r)
     {
-        if (auto* regOp = dynamic_cast<RegOperand*>(op)) return formatRegister(regOp->reg);
-        if (auto* immOp = dynamic_cast<ImmeOperand*>(op)) return "#" + std::to_string(immOp->value);
-        if (auto* memOp = dynamic_cast<MemOperand*>(op))
+        if (r.isVreg)
         {
-            std::string baseStr = formatRegister(memOp->base);
-            return "[" + baseStr + ", #" + std::to_string(memOp->offset) + "]";
+            out << 'v' << r.rId;
+            return;
+        }
+        auto* dt = r.dt != nullptr ? r.dt : I64;
+        if (dt == F32)
+            out << 's' << r.rId;
+        else if (dt == F64)
+            out << 'd' << r.rId;
+        else if (dt == I32)
+        {
+            if (r.rId == A64_REGISTER_ID_XZR)
+                out << "wzr";
+            else
+                out << 'w' << r.rId;
         }
-        return "unknown_op";
+        else if (r.rId == A64_REGISTER_ID_SP)
+            out << "sp";
+        else if (r.rId == A64_REGISTER_ID_XZR)
+            out << "xzr";
+        else
+            out << 'x' << r.rId;
     }
 
+    static void writeOperand(OutBuffer& out, Operand* op)
+    {
+        if (auto* regOp = dynamic_cast<RegOperand*>(op))
+            writeRegister(out, regOp->reg);
+        else if (auto* immOp = dynamic_cast<ImmeOperand*>(op))
+            out << '#' << immOp->value;
+        else if (auto* memOp = dynamic_cast<MemOperand*>(op))
+        {
+            out << '[';
+            writeRegister(out, memOp->base);
+            out << ", #" << memOp->offset << ']';
+        }
+        else
+            out << "unknown_op";
+    }
+
+    static std::string_view condName(int cc)
+    {
+        switch (cc)
+        {
+            case 0: return "eq";   // Equal
+            case 1: return "ne";   // Not Equal
+            case 2: return "hs";   // Unsigned >= (HS/CS)
+            case 3: return "lo";   // Unsigned < (LO/CC)
+            case 8: return "hi";   // Unsigned >
+            case 9: return "ls";   // Unsigned <=
+            case 10: return "ge";  // Signed >=
+            case 11: return "lt";  // Signed <
+            case 12: return "gt";  // Signed >
+            case 13: return "le";  // Signed <=
+            default: return "eq";
+        }
+    }
+
+    Codegen::Codegen(BE::Module* module, std::ostream& out) : module_(module), out_(out, outBufferCapacity) {}
+
     // ģĻ
     void Codegen::generateAssembly()
     {
-        out_ << ".text\n";
-        out_ << ".arch armv8-a\n";
+        emitHeader();
 
         // к
         for (auto* func : module_->functions) emitFunction(func);
 
+        emitGlobals();
+    }
+
+    void Codegen::emitHeader()
+    {
+        out_ << ".text\n";
+        out_ << ".arch armv8-a\n";
+        out_.flush();
+    }
+
+    void Codegen::emitGlobals()
+    {
         if (module_->globals.empty()) return;
 
-        // ݶ (ȫֱ)
-        out_ << "\n.data\n";
-        for (auto* gv : module_->globals)
+        // зʼֵȫֱ .dataȫķ .bssֻ¼СռĿļռ
+        bool hasData = false, hasBss = false;
+        for (auto* gv : module_->globals) (gv->isZeroInit() ? hasBss : hasData) = true;
+
+        if (hasData)
         {
-            out_ << gv->name << ":\n";
-            if (gv->isScalar())
+            out_ << "\n.data\n";
+            for (auto* gv : module_->globals)
+                if (!gv->isZeroInit()) emitGlobalData(gv);
+        }
+        if (hasBss)
+        {
+            out_ << "\n.bss\n";
+            for (auto* gv : module_->globals)
             {
-                if (gv->type == I32 || gv->type == F32)
-                {
-                    int val = gv->initVals.empty() ? 0 : gv->initVals[0];
-                    out_ << "  .word " << val << "\n";
-                }
-                else if (gv->type == I64 || gv->type == PTR || gv->type == F64)
-                {
-                    long long val = gv->initVals.empty() ? 0 : (long long)gv->initVals[0];
-                    out_ << "  .quad " << val << "\n";
-                }
-                continue;
+                if (!gv->isZeroInit()) continue;
+                bool is32 = (gv->type == I32 || gv->type == F32);
+                out_ << "  .p2align " << (is32 ? 2 : 3) << "\n";
+                out_ << gv->name << ":\n";
+                out_ << "  .zero " << gv->numElements() * (is32 ? 4 : 8) << "\n";
             }
-            // 鴦
-            int total_elems = 1;
-            for (int d : gv->dims) total_elems *= d;
-            bool is32 = (gv->type == I32 || gv->type == F32);
-            int  sz   = is32 ? 4 : 8;
-            if (gv->initVals.empty())
-                out_ << "  .zero " << (total_elems * sz) << "\n";
+        }
+        out_.flush();
+    }
+
+    void Codegen::emitGlobalData(BE::GlobalVariable* gv)
+    {
+        bool   is32 = (gv->type == I32 || gv->type == F32);
+        size_t sz   = is32 ? 4 : 8;
+        size_t pos  = 0;
+
+        out_ << gv->name << ":\n";
+        for (auto& [idx, v] : gv->initVals)
+        {
+            if (idx > pos) out_ << "  .zero " << (idx - pos) * sz << "\n";
+            if (is32)
+                out_ << "  .word " << v << "\n";
             else
-            {
-                int zero_cum = 0;
-                for (int v : gv->initVals)
-                {
-                    if (v == 0)
-                    {
-                        zero_cum += sz;
-                        continue;
-                    }
-                    if (zero_cum)
-                    {
-                        out_ << "  .zero " << zero_cum << "\n";
-                        zero_cum = 0;
-                    }
-                    if (is32)
-                        out_ << "  .word " << v << "\n";
-                    else
-                        out_ << "  .quad " << v << "\n";
-                }
-                if (zero_cum) out_ << "  .zero " << zero_cum << "\n";
-            }
+                out_ << "  .quad " << static_cast<long long>(v) << "\n";
+            pos = idx + 1;
         }
+        size_t total = gv->numElements();
+        if (total > pos) out_ << "  .zero " << (total - pos) * sz << "\n";
     }
 
     // ɵĻ
@@ -88,6 +144,7 @@ namespace BE::AArch64
         out_ << func->name << ":\n";
 
         for (auto& [id, block] : func->blocks) emitBlock(block);
+        out_.flush();
     }
 
     // ɻĻ
@@ -97,14 +154,18 @@ namespace BE::AArch64
         for (auto* inst : block->insts) emitInstruction(inst);
     }
 
-    // ָתΪַ
+    // ָתΪıֱд
     void Codegen::emitInstruction(BE::MInstruction* minst)
     {
         if (minst->kind == BE::InstKind::MOVE)
         {
             auto* moveInst = static_cast<BE::MoveInst*>(minst);
-            out_ << "  MOVE " << formatOperand(moveInst->dest) << ", " << formatOperand(moveInst->src) << "\n";
-            if (minst->comment != "") out_ << "  // " << minst->comment << "\n";
+            out_ << "  MOVE ";
+            writeOperand(out_, moveInst->dest);
+            out_ << ", ";
+            writeOperand(out_, moveInst->src);
+            out_ << '\n';
+            if (!minst->comment.empty()) out_ << "  // " << minst->comment << '\n';
             return;
         }
 
@@ -125,173 +186,105 @@ namespace BE::AArch64
         if (minst->kind != BE::InstKind::TARGET)
             ERROR("Unhandled non-target instruction %u in assembly generation.", static_cast<unsigned>(minst->kind));
 
-        auto*             inst = static_cast<Instr*>(minst);
-        std::stringstream ss;
+        auto* inst = static_cast<Instr*>(minst);
+        auto& ops  = inst->operands;
 
         if (inst->op == Operator::LA)
         {
-            auto* dst = static_cast<RegOperand*>(inst->operands[0]);
-            auto* sym = static_cast<SymbolOperand*>(inst->operands[1]);
-            ss << "  ldr " << formatOperand(dst) << ", =" << sym->name;
-            out_ << ss.str() << "\n";
+            out_ << "  ldr ";
+            writeOperand(out_, ops[0]);
+            out_ << ", =" << static_cast<SymbolOperand*>(ops[1])->name << '\n';
             return;
         }
 
-        auto opAsm  = getOpInfoAsm(inst->op);
-        auto opType = getOpInfoType(inst->op);
+        std::string_view opAsm  = getOpInfoAsm(inst->op);
+        OpType           opType = getOpInfoType(inst->op);
 
-        ss << "  " << opAsm;
+        // Ĵ֮ MOV Ϊ fmov
+        if (inst->op == Operator::MOV)
+        {
+            auto* dst = static_cast<RegOperand*>(ops[0]);
+            auto* src = static_cast<RegOperand*>(ops[1]);
+            if ((dst->reg.dt == F32 || dst->reg.dt == F64) && (src->reg.dt == F32 || src->reg.dt == F64))
+                opAsm = "fmov";
+        }
+
+        out_ << "  " << opAsm;
+
+        // ĴԷô棺op r1, r2, [base, #imm]  pre/post-index ʽ
+        auto writePair = [&](bool writeBack) {
+            out_ << ' ';
+            writeOperand(out_, ops[0]);
+            out_ << ", ";
+            writeOperand(out_, ops[1]);
+            out_ << ", [";
+            writeOperand(out_, ops[2]);
+            int imm = static_cast<ImmeOperand*>(ops[3])->value;
+            if (!writeBack)
+                out_ << ", #" << imm << ']';
+            else if (inst->op == Operator::STP)
+                out_ << ", #" << imm << "]!";
+            else
+                out_ << "], #" << imm;
+        };
+        auto writeTwo = [&]() {
+            out_ << ' ';
+            writeOperand(out_, ops[0]);
+            out_ << ", ";
+            writeOperand(out_, ops[1]);
+        };
 
         switch (opType)
         {
             case OpType::L:
-            {
                 // תָ
-                auto* lb = static_cast<LabelOperand*>(inst->operands[0]);
-                ss << " " << "." << cur_func_->name << "_" << lb->targetBlockId;
+                out_ << " ." << cur_func_->name << '_' << static_cast<LabelOperand*>(ops[0])->targetBlockId;
                 break;
-            }
             case OpType::SYM:
-            {
                 //  (BL symbol)
-                auto* so = static_cast<SymbolOperand*>(inst->operands[0]);
-                ss << " " << so->name;
+                out_ << ' ' << static_cast<SymbolOperand*>(ops[0])->name;
                 break;
-            }
             case OpType::P:
-            {
                 // Pair load/store (LDP/STP)
-                if (inst->op == Operator::STP)
-                {
-                    auto* r1 = static_cast<RegOperand*>(inst->operands[0]);
-                    auto* r2 = static_cast<RegOperand*>(inst->operands[1]);
-                    auto* rb = static_cast<RegOperand*>(inst->operands[2]);
-                    auto* io = static_cast<ImmeOperand*>(inst->operands[3]);
-                    ss << " " << formatOperand(r1) << ", " << formatOperand(r2) << ", [" << formatOperand(rb) << ", #"
-                       << io->value << "]";
-                }
-                else if (inst->op == Operator::LDP)
-                {
-                    auto* r1 = static_cast<RegOperand*>(inst->operands[0]);
-                    auto* r2 = static_cast<RegOperand*>(inst->operands[1]);
-                    auto* rb = static_cast<RegOperand*>(inst->operands[2]);
-                    auto* io = static_cast<ImmeOperand*>(inst->operands[3]);
-                    ss << " " << formatOperand(r1) << ", " << formatOperand(r2) << ", [" << formatOperand(rb) << ", #"
-                       << io->value << "]";
-                }
+                if (inst->op == Operator::STP || inst->op == Operator::LDP) writePair(false);
                 break;
-            }
             case OpType::R2:
-                if (inst->op == Operator::LA)
-                {
-                    auto* dst = static_cast<RegOperand*>(inst->operands[0]);
-                    auto* sym = static_cast<SymbolOperand*>(inst->operands[1]);
-                    ss << " " << formatOperand(dst) << ", =" << sym->name;
-                }
-                else if (inst->op == Operator::CMP)
+                if (inst->op == Operator::CSET)
                 {
-                    if (dynamic_cast<ImmeOperand*>(inst->operands[1]) != nullptr)
-                        ss << " " << formatOperand(inst->operands[0]) << ", #"
-                           << static_cast<ImmeOperand*>(inst->operands[1])->value;
-                    else
-                        ss << " " << formatOperand(inst->operands[0]) << ", " << formatOperand(inst->operands[1]);
-                }
-                else if (inst->op == Operator::CSET)
-                {
-                    auto*       dst  = static_cast<RegOperand*>(inst->operands[0]);
-                    auto*       cc   = static_cast<ImmeOperand*>(inst->operands[1]);
-                    const char* cond = "eq";
-                    switch (cc->value)
-                    {
-                        case 0: cond = "eq"; break;   // Equal
-                        case 1: cond = "ne"; break;   // Not Equal
-                        case 2: cond = "hs"; break;   // Unsigned >= (HS/CS)
-                        case 3: cond = "lo"; break;   // Unsigned < (LO/CC)
-                        case 8: cond = "hi"; break;   // Unsigned >
-                        case 9: cond = "ls"; break;   // Unsigned <=
-                        case 10: cond = "ge"; break;  // Signed >=
-                        case 11: cond = "lt"; break;  // Signed <
-                        case 12: cond = "gt"; break;  // Signed >
-                        case 13: cond = "le"; break;  // Signed <=
-                        default: cond = "eq"; break;
-                    }
-                    ss << " " << formatOperand(dst) << ", " << cond;
-                }
-                else if (inst->op == Operator::MOV)
-                {
-                    auto* dst = static_cast<RegOperand*>(inst->operands[0]);
-                    auto* src = static_cast<RegOperand*>(inst->operands[1]);
-                    bool  isFloatMove =
-                        (dst->reg.dt == F32 || dst->reg.dt == F64) && (src->reg.dt == F32 || src->reg.dt == F64);
-                    if (isFloatMove)
-                    {
-                        ss.str("");
-                        ss << "  fmov " << formatOperand(inst->operands[0]) << ", " << formatOperand(inst->operands[1]);
-                    }
-                    else { ss << " " << formatOperand(inst->operands[0]) << ", " << formatOperand(inst->operands[1]); }
+                    out_ << ' ';
+                    writeOperand(out_, ops[0]);
+                    out_ << ", " << condName(static_cast<ImmeOperand*>(ops[1])->value);
                 }
                 else
-                    ss << " " << formatOperand(inst->operands[0]) << ", " << formatOperand(inst->operands[1]);
+                    writeTwo();
                 break;
             case OpType::R:
-            {
                 if (inst->op == Operator::MOVZ || inst->op == Operator::MOVK || inst->op == Operator::MOVN)
                 {
-                    ss << " " << formatOperand(inst->operands[0]);
-                    if (inst->operands.size() >= 2 && dynamic_cast<ImmeOperand*>(inst->operands[1]) != nullptr)
+                    out_ << ' ';
+                    writeOperand(out_, ops[0]);
+                    if (ops.size() >= 2 && dynamic_cast<ImmeOperand*>(ops[1]) != nullptr)
                     {
-                        ss << ", #" << static_cast<ImmeOperand*>(inst->operands[1])->value;
-                        if (inst->operands.size() >= 3 && dynamic_cast<ImmeOperand*>(inst->operands[2]) != nullptr)
-                        {
-                            ss << ", lsl #" << static_cast<ImmeOperand*>(inst->operands[2])->value;
-                        }
+                        out_ << ", #" << static_cast<ImmeOperand*>(ops[1])->value;
+                        if (ops.size() >= 3 && dynamic_cast<ImmeOperand*>(ops[2]) != nullptr)
+                            out_ << ", lsl #" << static_cast<ImmeOperand*>(ops[2])->value;
                     }
                 }
                 else
                 {
-                    ss << " " << formatOperand(inst->operands[0]) << ", " << formatOperand(inst->operands[1]) << ", ";
-                    if (inst->operands.size() >= 3)
-                    {
-                        if (dynamic_cast<ImmeOperand*>(inst->operands[2]) != nullptr)
-                            ss << "#" << static_cast<ImmeOperand*>(inst->operands[2])->value;
-                        else
-                            ss << formatOperand(inst->operands[2]);
-                    }
+                    writeTwo();
+                    out_ << ", ";
+                    if (ops.size() >= 3) writeOperand(out_, ops[2]);
                 }
                 break;
-            }
-            case OpType::M:
-                ss << " " << formatOperand(inst->operands[0]) << ", " << formatOperand(inst->operands[1]);
-                break;
+            case OpType::M: writeTwo(); break;
             case OpType::Z:
-            {
-                if (inst->op == Operator::RET)
-                    ;
-                else if (inst->op == Operator::STP)
-                {
-                    auto* r1 = static_cast<RegOperand*>(inst->operands[0]);
-                    auto* r2 = static_cast<RegOperand*>(inst->operands[1]);
-                    auto* rb = static_cast<RegOperand*>(inst->operands[2]);
-                    auto* io = static_cast<ImmeOperand*>(inst->operands[3]);
-                    ss << " " << formatOperand(r1) << ", " << formatOperand(r2) << ", [" << formatOperand(rb) << ", #"
-                       << io->value << "]!";
-                }
-                else if (inst->op == Operator::LDP)
-                {
-                    auto* r1 = static_cast<RegOperand*>(inst->operands[0]);
-                    auto* r2 = static_cast<RegOperand*>(inst->operands[1]);
-                    auto* rb = static_cast<RegOperand*>(inst->operands[2]);
-                    auto* io = static_cast<ImmeOperand*>(inst->operands[3]);
-                    ss << " " << formatOperand(r1) << ", " << formatOperand(r2) << ", [" << formatOperand(rb) << "], "
-                       << "#" << io->value;
-                }
+                if (inst->op == Operator::STP || inst->op == Operator::LDP) writePair(true);
                 break;
-            }
         }
-        out_ << ss.str();
 
-        if (minst->comment != "") out_ << "  // " << minst->comment;
+        if (!minst->comment.empty()) out_ << "  // " << minst->comment;
 
-        out_ << "\n";
+        out_ << '\n';
     }
 }  // namespace BE::AArch64
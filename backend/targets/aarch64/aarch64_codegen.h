@@ -3,27 +3,41 @@
 
 #include <backend/mir/m_module.h>
 #include <backend/mir/m_codegen.h>
+#include <out_buffer.h>
 #include <iostream>
 
 namespace BE::AArch64
 {
+    /*
+     * 汇编输出先写入一块较大的输出缓冲区，寄存器名、立即数与助记符都直接格式化进缓冲区，
+     * 不构造临时字符串；每个 emit* 结束时整体写出一次（即每个函数一次）
+     */
     class Codegen
     {
       public:
-        Codegen(BE::Module* module, std::ostream& out) : module_(module), out_(out) {}
+        static constexpr size_t outBufferCapacity = 1 << 20;
+
+        Codegen(BE::Module* module, std::ostream& out);
 
         void generateAssembly();
 
+        // generateAssembly 的三个组成部分，按函数并行生成时分别调用：
+        // 各函数可以输出到各自的缓冲区，再按原顺序拼接在文件头与数据段之间
+        void emitHeader();
+        void emitFunction(BE::Function* func);
+        void emitGlobals();
+
       private:
-        BE::Module*   module_;
-        std::ostream& out_;
+        BE::Module* module_;
+        OutBuffer   out_;
 
         BE::Function* cur_func_       = nullptr;
         int           cur_stack_size_ = 0;
 
-        void emitFunction(BE::Function* func);
         void emitBlock(BE::Block* block);
         void emitInstruction(BE::MInstruction* inst);
+        // 非零初始值写作 .word/.quad，中间的连续 0 合并成一条 .zero
+        void emitGlobalData(BE::GlobalVariable* gv);
     };
 }  // namespace BE::AArch64
 
@@ -3,30 +3,35 @@
 
 namespace BE::AArch64
 {
-    // ȡӦĻǷ
-    std::string getOpInfoAsm(Operator op)
+    namespace
     {
-        switch (op)
-        {
-#define X(n, t, a) \
-    case Operator::n: return a;
+        constexpr std::string_view opAsmTable[] = {
+#define X(n, t, a) a,
             A64_INSTS
 #undef X
-            default: return "nop";
-        }
+        };
+
+        constexpr OpType opTypeTable[] = {
+#define X(n, t, a) OpType::t,
+            A64_INSTS
+#undef X
+        };
+
+        constexpr size_t opCount = sizeof(opAsmTable) / sizeof(opAsmTable[0]);
+    }  // namespace
+
+    // ȡӦĻǷ
+    std::string_view getOpInfoAsm(Operator op)
+    {
+        size_t idx = static_cast<size_t>(op);
+        return idx < opCount ? opAsmTable[idx] : std::string_view("nop");
     }
 
     // ȡĲ (ڻɺָ)
     // OpType ָĲʽĴڴ
     OpType getOpInfoType(Operator op)
     {
-        switch (op)
-        {
-#define X(n, t, a) \
-    case Operator::n: return OpType::t;
-            A64_INSTS
-#undef X
-            default: return OpType::Z;
-        }
+        size_t idx = static_cast<size_t>(op);
+        return idx < opCount ? opTypeTable[idx] : OpType::Z;
     }
 }  // namespace BE::AArch64
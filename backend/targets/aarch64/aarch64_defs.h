@@ -6,6 +6,7 @@
 #include <array>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <set>
 
 namespace BE::AArch64
@@ -101,8 +102,9 @@ namespace BE::AArch64
         Z     // no operands
     };
 
-    std::string getOpInfoAsm(Operator op);
-    OpType      getOpInfoType(Operator op);
+    //  A64_INSTS ɵĲұصǷַָ̬
+    std::string_view getOpInfoAsm(Operator op);
+    OpType           getOpInfoType(Operator op);
 
     class Instr : public BE::MInstruction
     {
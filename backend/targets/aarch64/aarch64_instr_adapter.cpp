@@ -24,9 +24,11 @@ namespace BE::Targeting::AArch64
      *  -  FILoad/FIStore Ϊαָ stack_lowering תΪ LDR/STR
      */
 
+    // жֻĿָ壻PHI/MOVE αָ Instrܰ Instr ȡ op
     // жǷΪָ (BL)
     bool InstrAdapter::isCall(BE::MInstruction* inst) const
     {
+        if (inst->kind != BE::InstKind::TARGET) return false;
         auto* i = static_cast<Instr*>(inst);
         return i->op == Operator::BL;
     }
@@ -34,6 +36,7 @@ namespace BE::Targeting::AArch64
     // жǷΪָ (RET)
     bool InstrAdapter::isReturn(BE::MInstruction* inst) const
     {
+        if (inst->kind != BE::InstKind::TARGET) return false;
         auto* i = static_cast<Instr*>(inst);
         return i->op == Operator::RET;
     }
@@ -41,6 +44,7 @@ namespace BE::Targeting::AArch64
     // жǷΪת (B)
     bool InstrAdapter::isUncondBranch(BE::MInstruction* inst) const
     {
+        if (inst->kind != BE::InstKind::TARGET) return false;
         auto* i = static_cast<Instr*>(inst);
         return i->op == Operator::B;
     }
@@ -48,6 +52,7 @@ namespace BE::Targeting::AArch64
     // жǷΪת (BEQ, BNE, BLT, BLE, BGT, BGE)
     bool InstrAdapter::isCondBranch(BE::MInstruction* inst) const
     {
+        if (inst->kind != BE::InstKind::TARGET) return false;
         auto* i = static_cast<Instr*>(inst);
         switch (i->op)
         {
@@ -67,6 +72,7 @@ namespace BE::Targeting::AArch64
     // ڹͼ (CFG)
     int InstrAdapter::extractBranchTarget(BE::MInstruction* inst) const
     {
+        if (inst->kind != BE::InstKind::TARGET) return -1;
         auto* i = static_cast<Instr*>(inst);
         if (i->operands.empty()) return -1;
         
@@ -303,6 +309,7 @@ namespace BE::Targeting::AArch64
     // ????????????MOV???????? true ??????????
     bool InstrAdapter::isCopy(BE::MInstruction* inst, BE::Register& dst, BE::Register& src) const
     {
+        if (inst->kind != BE::InstKind::TARGET) return false;
         auto* i = static_cast<Instr*>(inst);
         if (i->op == Operator::MOV || i->op == Operator::FMOV)
         {
@@ -498,7 +505,7 @@ namespace BE::Targeting::AArch64
     // ??????????????????????? (Reload) ???
     // ??????????????????
     void InstrAdapter::insertReloadBefore(
-        BE::Block* block, std::deque<BE::MInstruction*>::iterator it, const BE::Register& physReg, int frameIndex) const
+        BE::Block* block, BE::Block::iterator it, const BE::Register& physReg, int frameIndex) const
     {
         // ????????? FILoadInst physReg, frameIndex
         auto* reload = new BE::FILoadInst(physReg, frameIndex);
@@ -508,7 +515,7 @@ namespace BE::Targeting::AArch64
     // ?????????????????????? (Spill) ???
     // ????????????????????
     void InstrAdapter::insertSpillAfter(
-        BE::Block* block, std::deque<BE::MInstruction*>::iterator it, const BE::Register& physReg, int frameIndex) const
+        BE::Block* block, BE::Block::iterator it, const BE::Register& physReg, int frameIndex) const
     {
         // ????????? FIStoreInst physReg, frameIndex
         auto* spill = new BE::FIStoreInst(physReg, frameIndex);
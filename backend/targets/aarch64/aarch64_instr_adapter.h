@@ -19,9 +19,9 @@ namespace BE::Targeting::AArch64
         void replaceDef(BE::MInstruction* inst, const BE::Register& from, const BE::Register& to) const override;
         bool isCopy(BE::MInstruction* inst, BE::Register& dst, BE::Register& src) const override;
         void enumPhysRegs(BE::MInstruction* inst, std::vector<BE::Register>& out) const override;
-        void insertReloadBefore(BE::Block* block, std::deque<BE::MInstruction*>::iterator it,
+        void insertReloadBefore(BE::Block* block, BE::Block::iterator it,
             const BE::Register& physReg, int frameIndex) const override;
-        void insertSpillAfter(BE::Block* block, std::deque<BE::MInstruction*>::iterator it, const BE::Register& physReg,
+        void insertSpillAfter(BE::Block* block, BE::Block::iterator it, const BE::Register& physReg,
             int frameIndex) const override;
     };
 }  // namespace BE::Targeting::AArch64
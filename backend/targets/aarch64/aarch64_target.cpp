@@ -1,6 +1,7 @@
 #include "backend/targets/aarch64/aarch64_defs.h"
 #include <backend/targets/aarch64/aarch64_target.h>
 #include <backend/target/registry.h>
+#include <backend/target/function_cache.h>
 #include <backend/targets/aarch64/isel/aarch64_ir_isel.h>
 #include <backend/targets/aarch64/aarch64_reg_info.h>
 #include <backend/targets/aarch64/aarch64_instr_adapter.h>
@@ -9,20 +10,19 @@
 #include <backend/targets/aarch64/passes/lowering/frame_lowering.h>
 #include <backend/targets/aarch64/passes/lowering/stack_lowering.h>
 #include <backend/targets/aarch64/passes/lowering/phi_elimination.h>
+#include <middleend/pass/pass_manager.h>
+#include <middleend/pass/analysis/analysis_manager.h>
 
 #include <debug.h>
+#include <thread_pool.h>
 
+#include <algorithm>
+#include <chrono>
 #include <map>
+#include <sstream>
+#include <string>
 #include <vector>
 
-namespace BE
-{
-    namespace RA
-    {
-        void setTargetInstrAdapter(const BE::Targeting::TargetInstrAdapter* adapter);
-    }
-}  // namespace BE
-
 namespace BE::Targeting::AArch64
 {
     namespace
@@ -35,66 +35,174 @@ namespace BE::Targeting::AArch64
                 BE::Targeting::TargetRegistry::registerTargetFactory("armv8", []() { return new AArch64Target(); });
             }
         } s_auto_register;
+
+        size_t countMInsts(const BE::Function* func)
+        {
+            size_t count = 0;
+            for (auto& [_, block] : func->blocks) count += block->insts.size();
+            return count;
+        }
+
+        // 计时一个后端步骤；func 在步骤开始前可以为空（指令选择），此时按 0 条指令计
+        template <typename Fn>
+        void timeStage(ME::PassTimer* timer, const char* name, BE::Function*& func, Fn&& fn)
+        {
+            if (!timer)
+            {
+                fn();
+                return;
+            }
+            size_t before = func ? countMInsts(func) : 0;
+            auto   start  = std::chrono::steady_clock::now();
+            fn();
+            auto   end   = std::chrono::steady_clock::now();
+            size_t after = func ? countMInsts(func) : 0;
+            timer->add(name,
+                std::chrono::duration<double, std::milli>(end - start).count(),
+                static_cast<long long>(after) - static_cast<long long>(before));
+        }
+
+        /*
+         * 指令选择之后（或函数命中缓存时）后端不再访问该函数的中端 IR：MIR 只按编号记录寄存器与标签，
+         * 因此立即销毁 ME::Function，连同它的内存池与操作数表一起归还。
+         * 先丢弃 AM 中以该函数为键缓存的分析，否则它们会留到退出，且可能被之后分配在同一地址的函数取到。
+         * 每个下标只由处理该函数的线程置空；全局变量与模块级常量不受影响
+         */
+        void releaseIRFunction(ME::Module* ir, size_t idx)
+        {
+            ME::Analysis::AM.invalidate(*ir->functions[idx]);
+            delete ir->functions[idx];
+            ir->functions[idx] = nullptr;
+        }
     }  // namespace
 
+    /*
+     * 指令选择之后各函数的 MIR 互不依赖，因此除全局变量导入、文件头与数据段外，
+     * 从指令选择到生成汇编文本的整条流水线都按函数执行：
+     * - jobs <= 1 时逐个函数直接输出到 out
+     * - jobs > 1 时各函数分发到线程池，每个函数输出到自己的缓冲区，最后按原函数顺序拼接，
+     *   因此输出与串行执行完全一致
+     * 设置了函数缓存时，命中的函数不再运行流水线，直接在原位置输出缓存的汇编；
+     * 其余函数先输出到缓冲区，写回缓存后再输出
+     */
     void AArch64Target::runPipeline(ME::Module* ir, BE::Module* backend, std::ostream* out)
     {
-        fprintf(stderr, "DEBUG: Entering AArch64 pipeline\n");
-        fflush(stderr);
-        
-        static BE::Targeting::AArch64::InstrAdapter s_adapter;
-        static BE::Targeting::AArch64::RegInfo      s_regInfo;
-        BE::Targeting::setTargetInstrAdapter(&s_adapter);
-
-        fprintf(stderr, "DEBUG: Running ISel\n");
-        fflush(stderr);
+        BE::Targeting::setTargetInstrAdapter(&adapter_);
+
         //TODO("选择一种 Instruction Selector 实现，并完成指令选择");
         // BE::AArch64::DAGIsel isel(ir, backend, this);
-        BE::AArch64::IRIsel isel(ir, backend, this);
-        isel.run();
+        BE::AArch64::IRIsel globalIsel(ir, backend, this);
+        globalIsel.importGlobals();
+
+        size_t numFuncs = ir->functions.size();
+        backend->functions.assign(numFuncs, nullptr);
+
+        BE::AArch64::Codegen codegen(backend, *out);
+        codegen.emitHeader();
+
+        if (jobs <= 1 || numFuncs <= 1)
+        {
+            for (size_t i = 0; i < numFuncs; ++i)
+            {
+                if (!cache)
+                {
+                    runFunctionPipeline(ir, backend, i, *out, timer);
+                    continue;
+                }
+                if (cache->isHit(i))
+                {
+                    releaseIRFunction(ir, i);
+                    *out << cache->cachedText(i);
+                    continue;
+                }
+                std::ostringstream buf;
+                runFunctionPipeline(ir, backend, i, buf, timer);
+                std::string text = buf.str();
+                cache->store(i, text);
+                *out << text;
+            }
+        }
+        else
+        {
+            // 并行时每个函数单独计时，结束后按函数顺序合并，报告中各阶段的顺序与串行一致
+            std::vector<std::string>   asmBufs(numFuncs);
+            std::vector<ME::PassTimer> timers(timer ? numFuncs : 0);
+            ThreadPool                 pool(std::min(jobs, numFuncs));
+            pool.parallelFor(numFuncs, [&](size_t, size_t idx) {
+                if (cache && cache->isHit(idx))
+                {
+                    releaseIRFunction(ir, idx);
+                    return;
+                }
+                std::ostringstream buf;
+                runFunctionPipeline(ir, backend, idx, buf, timer ? &timers[idx] : nullptr);
+                asmBufs[idx] = buf.str();
+            });
+            for (size_t i = 0; i < numFuncs; ++i)
+            {
+                if (cache && cache->isHit(i))
+                {
+                    *out << cache->cachedText(i);
+                    continue;
+                }
+                // 缓存的写回在调用线程上按函数顺序进行
+                if (cache) cache->store(i, asmBufs[i]);
+                *out << asmBufs[i];
+            }
+            for (auto& t : timers) timer->merge(t);
+        }
+
+        codegen.emitGlobals();
+    }
+
+    void AArch64Target::runFunctionPipeline(
+        ME::Module* ir, BE::Module* backend, size_t idx, std::ostream& out, ME::PassTimer* timer)
+    {
+        // 每个函数使用独立的 IRIsel 实例，只写入 backend->functions[idx]
+        BE::Function* func = nullptr;
+        timeStage(timer, "isel", func, [&] {
+            BE::AArch64::IRIsel isel(ir, backend, this);
+            func = isel.selectFunction(*ir->functions[idx]);
+        });
+        backend->functions[idx] = func;
+        releaseIRFunction(ir, idx);
 
         // Pre-RA
         {
-            fprintf(stderr, "DEBUG: Running Pre-RA Passes\n");
-            fflush(stderr);
-            // 对实现了 mem2reg 优化的同学，还需完成 Phi Elimination 
-            BE::AArch64::Passes::Lowering::PhiEliminationPass phiElim; 
-            phiElim.runOnModule(*backend, &s_adapter); 
- 
+            // 对实现了 mem2reg 优化的同学，还需完成 Phi Elimination
+            timeStage(timer, "phi-elimination", func, [&] {
+                BE::AArch64::Passes::Lowering::PhiEliminationPass phiElim;
+                phiElim.runOnFunction(func, &adapter_);
+            });
+
             // 移动指令消解已包含在 PhiElimination 中（通过生成 MOV/UXTW 指令），无需额外 Pass
         }
 
         // RA
         {
-            fprintf(stderr, "DEBUG: Running RA\n");
-            fflush(stderr);
             // TODO("使用你实现的寄存器分配器进行寄存器分配");
-            BE::RA::LinearScanRA ra;
-            ra.allocate(*backend, s_regInfo);
+            timeStage(timer, "linear-scan-ra", func, [&] {
+                BE::RA::LinearScanRA ra(&adapter_);
+                ra.allocateFunction(*func, regInfo_);
+            });
         }
 
         // Post-RA
         {
-            fprintf(stderr, "DEBUG: Running Post-RA Passes\n");
-            fflush(stderr);
-            
-            fprintf(stderr, "DEBUG: Running FrameLoweringPass\n");
-            fflush(stderr);
-            BE::AArch64::Passes::Lowering::FrameLoweringPass fl;
-            fl.runOnModule(*backend);
-
-            fprintf(stderr, "DEBUG: Running StackLoweringPass\n");
-            fflush(stderr);
-            BE::AArch64::Passes::Lowering::StackLoweringPass sl;
-            sl.runOnModule(*backend);
+            timeStage(timer, "frame-lowering", func, [&] {
+                BE::AArch64::Passes::Lowering::FrameLoweringPass fl;
+                fl.runOnFunction(func);
+            });
+
+            timeStage(timer, "stack-lowering", func, [&] {
+                BE::AArch64::Passes::Lowering::StackLoweringPass sl;
+                sl.runOnFunction(func);
+            });
         }
 
-        fprintf(stderr, "DEBUG: Running Codegen\n");
-        fflush(stderr);
-        BE::AArch64::Codegen codegen(backend, *out);
-        codegen.generateAssembly();
-        
-        fprintf(stderr, "DEBUG: Pipeline Finished\n");
-        fflush(stderr);
+        timeStage(timer, "asm-emit", func, [&] {
+            BE::AArch64::Codegen codegen(backend, out);
+            codegen.emitFunction(func);
+        });
     }
-}  // namespace BE::Targeting::AArch64
\ No newline at end of file
+}  // namespace BE::Targeting::AArch64
@@ -2,6 +2,9 @@
 #define __BACKEND_TARGETS_AARCH64_AARCH64_TARGET_H__
 
 #include <backend/target/target.h>
+#include <backend/targets/aarch64/aarch64_instr_adapter.h>
+#include <backend/targets/aarch64/aarch64_reg_info.h>
+#include <iosfwd>
 
 namespace BE
 {
@@ -10,15 +13,26 @@ namespace BE
 namespace ME
 {
     class Module;
+    class PassTimer;
 }
 
 namespace BE::Targeting::AArch64
 {
     class AArch64Target : public BackendTarget
     {
+      private:
+        // 只读的目标描述，各函数的流水线（包括并行执行时）共享同一份
+        InstrAdapter adapter_;
+        RegInfo      regInfo_;
+
       public:
         const char* getName() const override { return "aarch64"; }
         void        runPipeline(ME::Module* ir, BE::Module* backend, std::ostream* out) override;
+
+      private:
+        // 对第 idx 个函数执行指令选择到汇编输出的全部步骤，timer 非空时记录各步骤的耗时与 MIR 指令数变化
+        void runFunctionPipeline(
+            ME::Module* ir, BE::Module* backend, size_t idx, std::ostream& out, ME::PassTimer* timer);
     };
 }  // namespace BE::Targeting::AArch64
 
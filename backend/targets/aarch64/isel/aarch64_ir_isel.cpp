@@ -52,7 +52,7 @@ Register IRIsel::getOrCreateVReg(size_t ir_reg_id, BE::DataType* dt)
         return ctx_.vregMap[ir_reg_id];
 
     // 򴴽µĴӳ
-    Register vreg = BE::getVReg(dt);
+    Register vreg = ctx_.mfunc->getVReg(dt);
     ctx_.vregMap[ir_reg_id] = vreg;
     return vreg;
 }
@@ -79,7 +79,7 @@ Register IRIsel::getReg(ME::Operand* op)
     // 2.  32 λ
     else if (auto* immOp = dynamic_cast<ME::ImmeI32Operand*>(op))
     {
-        Register reg = BE::getVReg(BE::I32);
+        Register reg = ctx_.mfunc->getVReg(BE::I32);
         int val = immOp->value;
         
         // Ż0 ֱֵʹĴ wzr
@@ -105,7 +105,7 @@ Register IRIsel::getReg(ME::Operand* op)
     // 3.  32 λ
     else if (auto* immF32 = dynamic_cast<ME::ImmeF32Operand*>(op))
     {
-        Register reg = BE::getVReg(BE::F32);
+        Register reg = ctx_.mfunc->getVReg(BE::F32);
         float val = immF32->value;
         
         // Ż0.0f ֱʹĴ wzr ƶĴ
@@ -118,7 +118,7 @@ Register IRIsel::getReg(ME::Operand* op)
         // λģʽתΪأȻתƵĴ
         // Ըش߼
         int bits = FLOAT_TO_INT_BITS(val);
-        Register tmp = BE::getVReg(BE::I32);
+        Register tmp = ctx_.mfunc->getVReg(BE::I32);
         
          if ((bits & 0xFFFF0000) == 0) {
              cur_block_->insts.push_back(createInstr2(Operator::MOVZ, new RegOperand(tmp), new ImmeOperand(bits)));
@@ -147,15 +147,20 @@ void IRIsel::importGlobals()
 
         if (g->init)
         {
+            int bits = 0;
             if (g->dt == ME::DataType::F32)
-            {
-                float f = static_cast<ME::ImmeF32Operand*>(g->init)->value;
-                be_g->initVals.push_back(FLOAT_TO_INT_BITS(f));
-            }
+                bits = FLOAT_TO_INT_BITS(static_cast<ME::ImmeF32Operand*>(g->init)->value);
             else
+                bits = static_cast<ME::ImmeI32Operand*>(g->init)->value;
+            if (bits != 0) be_g->initVals.emplace_back(0, bits);
+        }
+        else
+        {
+            // ʼֵϡģֱӰ±
+            for (auto& [idx, v] : g->initList.initList)
             {
-                int v = static_cast<ME::ImmeI32Operand*>(g->init)->value;
-                be_g->initVals.push_back(v);
+                int bits = g->dt == ME::DataType::F32 ? FLOAT_TO_INT_BITS(v.getFloat()) : v.getInt();
+                if (bits != 0) be_g->initVals.emplace_back(idx, bits);
             }
         }
         m_backend_module->globals.push_back(be_g);
@@ -263,11 +268,12 @@ void IRIsel::visit(ME::Module& module)
     }
 }
 
-void IRIsel::visit(ME::Function& func)
+void IRIsel::visit(ME::Function& func) { m_backend_module->functions.push_back(selectFunction(func)); }
+
+BE::Function* IRIsel::selectFunction(ME::Function& func)
 {
     ctx_ = FunctionContext();
     ctx_.mfunc = new BE::Function(func.funcDef->funcName);
-    m_backend_module->functions.push_back(ctx_.mfunc);
 
     // Create all blocks first
     for (auto& pair : func.blocks)
@@ -284,6 +290,7 @@ void IRIsel::visit(ME::Function& func)
     {
         visit(*pair.second);
     }
+    return ctx_.mfunc;
 }
 
 void IRIsel::visit(ME::Block& block)
@@ -315,7 +322,7 @@ void IRIsel::visit(ME::LoadInst& inst)
         if (ctx_.allocaFI.count(ptrId)) {
             // ջ
             int fi = ctx_.allocaFI[ptrId];
-            Register base = BE::getVReg(BE::I64);
+            Register base = ctx_.mfunc->getVReg(BE::I64);
             
             //  add base, sp, #offset (ͨ FrameIndexOperand )
             Instr* addrInst = createInstr2(Operator::ADD, new RegOperand(base), new RegOperand(PR::sp));
@@ -333,7 +340,7 @@ void IRIsel::visit(ME::LoadInst& inst)
     // 2. ȫֱ (Global Variable)
     // ȫֱĵַʱȷʹ LA (Load Address) αָصַ
     if (auto* symOp = dynamic_cast<ME::GlobalOperand*>(ptr)) {
-         Register addr = BE::getVReg(BE::I64);
+         Register addr = ctx_.mfunc->getVReg(BE::I64);
          cur_block_->insts.push_back(createInstr2(Operator::LA, new RegOperand(addr), new SymbolOperand(symOp->name)));
          cur_block_->insts.push_back(createInstr2(Operator::LDR, new RegOperand(res), new MemOperand(addr, 0)));
          return;
@@ -357,7 +364,7 @@ void IRIsel::visit(ME::StoreInst& inst)
         size_t ptrId = regOp->getRegNum();
         if (ctx_.allocaFI.count(ptrId)) {
             int fi = ctx_.allocaFI[ptrId];
-            Register base = BE::getVReg(BE::I64);
+            Register base = ctx_.mfunc->getVReg(BE::I64);
             
             //  add base, sp, #offset
             Instr* addrInst = createInstr2(Operator::ADD, new RegOperand(base), new RegOperand(PR::sp));
@@ -374,7 +381,7 @@ void IRIsel::visit(ME::StoreInst& inst)
     
     // 2. ȫֱ
     if (auto* symOp = dynamic_cast<ME::GlobalOperand*>(ptr)) {
-         Register addr = BE::getVReg(BE::I64);
+         Register addr = ctx_.mfunc->getVReg(BE::I64);
          cur_block_->insts.push_back(createInstr2(Operator::LA, new RegOperand(addr), new SymbolOperand(symOp->name)));
          cur_block_->insts.push_back(createInstr2(Operator::STR, new RegOperand(valReg), new MemOperand(addr, 0)));
          return;
@@ -405,7 +412,7 @@ void IRIsel::visit(ME::ArithmeticInst& inst)
     if (!isFloat) {
         if (lhs.dt == BE::I32 && rhs.dt == BE::I64) {
             // չ: UXTW (Unsigned Extend Word)
-            Register ext = BE::getVReg(BE::I64);
+            Register ext = ctx_.mfunc->getVReg(BE::I64);
             cur_block_->insts.push_back(createInstr2(Operator::UXTW, new RegOperand(ext), new RegOperand(lhs)));
             lhs = ext;
             if (res.dt == BE::I32) {
@@ -413,7 +420,7 @@ void IRIsel::visit(ME::ArithmeticInst& inst)
             }
         } else if (lhs.dt == BE::I64 && rhs.dt == BE::I32) {
              // Ҳչ
-             Register ext = BE::getVReg(BE::I64);
+             Register ext = ctx_.mfunc->getVReg(BE::I64);
              cur_block_->insts.push_back(createInstr2(Operator::UXTW, new RegOperand(ext), new RegOperand(rhs)));
              rhs = ext;
              if (res.dt == BE::I32) res.dt = BE::I64;
@@ -437,8 +444,8 @@ void IRIsel::visit(ME::ArithmeticInst& inst)
             // ʵΪ: res = lhs - (lhs / rhs) * rhs
             // MSUB (Multiply-Subtract): d = a - b * c ( AArch64 ֻ MSUB d, b, c, a)
             // Ϊ SDIV, MUL, SUB
-            Register divRes = BE::getVReg(lhs.dt);
-            Register mulRes = BE::getVReg(lhs.dt);
+            Register divRes = ctx_.mfunc->getVReg(lhs.dt);
+            Register mulRes = ctx_.mfunc->getVReg(lhs.dt);
             cur_block_->insts.push_back(createInstr3(Operator::SDIV, new RegOperand(divRes), new RegOperand(lhs), new RegOperand(rhs)));
             cur_block_->insts.push_back(createInstr3(Operator::MUL, new RegOperand(mulRes), new RegOperand(divRes), new RegOperand(rhs)));
             cur_block_->insts.push_back(createInstr3(Operator::SUB, new RegOperand(res), new RegOperand(lhs), new RegOperand(mulRes)));
@@ -489,7 +496,7 @@ void IRIsel::visit(ME::IcmpInst& inst)
              lhs = PR::xzr; // Use 64-bit zero
          } else {
              // Extend lhs
-             Register ext = BE::getVReg(BE::I64);
+             Register ext = ctx_.mfunc->getVReg(BE::I64);
              cur_block_->insts.push_back(createInstr2(Operator::UXTW, new RegOperand(ext), new RegOperand(lhs)));
              lhs = ext;
          }
@@ -498,7 +505,7 @@ void IRIsel::visit(ME::IcmpInst& inst)
              rhs = PR::xzr; // Use 64-bit zero
          } else {
              // Extend rhs
-             Register ext = BE::getVReg(BE::I64);
+             Register ext = ctx_.mfunc->getVReg(BE::I64);
              cur_block_->insts.push_back(createInstr2(Operator::UXTW, new RegOperand(ext), new RegOperand(rhs)));
              rhs = ext;
          }
@@ -62,11 +62,15 @@ namespace BE::AArch64
         void     runImpl();
         Register getOrCreateVReg(size_t ir_reg_id, BE::DataType* dt);
         Register getReg(ME::Operand* op);
-        void     importGlobals();
         void     collectAllocas(ME::Function* ir_func);
         void     setupParameters(ME::Function* ir_func);
 
       public:
+        // 供按函数并行的后端流水线使用：先在单线程中导入全局变量，
+        // 再对每个函数各用一个 IRIsel 实例调用 selectFunction，返回的函数由调用者放入模块
+        void          importGlobals();
+        BE::Function* selectFunction(ME::Function& func);
+
         void visit(ME::Module& module) override;
         void visit(ME::Function& func) override;
         void visit(ME::Block& block) override;
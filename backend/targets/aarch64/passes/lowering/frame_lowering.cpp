@@ -4,6 +4,7 @@
 #include <backend/mir/m_function.h>
 #include <debug.h>
 #include <algorithm>
+#include <deque>
 
 namespace BE::AArch64::Passes::Lowering
 {
@@ -28,7 +28,7 @@ namespace BE::AArch64::Passes::Lowering
             return a->blockId < b->blockId;
         });
 
-        auto insertCopies = [&](BE::Block* blk, std::deque<BE::MInstruction*>::iterator insertIt,
+        auto insertCopies = [&](BE::Block* blk, BE::Block::iterator insertIt,
                                 const std::vector<std::pair<BE::Register, BE::Operand*>>& copies) {
             std::vector<std::pair<BE::Register, BE::Operand*>> moves = copies;
             auto isSrcReg = [](BE::Operand* op) { return dynamic_cast<BE::RegOperand*>(op) != nullptr; };
@@ -90,7 +90,7 @@ namespace BE::AArch64::Passes::Lowering
                     
                     auto [dst, srcOp] = moves[k];
                     BE::Register sr   = srcRegOf(srcOp);
-                    BE::Register tmp  = BE::getVReg(dst.dt);
+                    BE::Register tmp  = func->getVReg(dst.dt);
                     
                     auto* tMov = BE::AArch64::createMove(new BE::RegOperand(tmp), new BE::RegOperand(sr));
                     if (insertIt == blk->insts.end())
@@ -235,8 +235,8 @@ namespace BE::AArch64::Passes::Lowering
                             deletedOps.insert(kv.second);
                         }
                     }
-                    BE::MInstruction::delInst(p);
                     it = block->insts.erase(it);
+                    BE::MInstruction::delInst(p);
                 }
                 else
                     ++it;
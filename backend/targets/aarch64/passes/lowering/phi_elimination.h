@@ -22,15 +22,15 @@ namespace BE::AArch64::Passes::Lowering
         ~PhiEliminationPass() = default;
 
         void runOnModule(BE::Module& module, const BE::Targeting::TargetInstrAdapter* adapter);
+        void runOnFunction(BE::Function* func, const BE::Targeting::TargetInstrAdapter* adapter);
 
       private:
-        void runOnFunction(BE::Function* func, const BE::Targeting::TargetInstrAdapter* adapter);
 
         [[maybe_unused]] void splitCriticalEdgesForBlock(BE::Function* func, BE::MIR::CFG* cfg, uint32_t toLabel);
         [[maybe_unused]] void redirectEdgeBranch(
             BE::Function* func, uint32_t fromLabel, uint32_t oldTo, uint32_t newTo);
 
-        [[maybe_unused]] std::deque<BE::MInstruction*>::iterator findInsertPoint(
+        [[maybe_unused]] BE::Block::iterator findInsertPoint(
             BE::Block* block, const BE::Targeting::TargetInstrAdapter* adapter);
 
         [[maybe_unused]] void insertPhiCopiesForPred(BE::Function* func, BE::Block* predBlock,
@@ -46,7 +46,7 @@ namespace BE::AArch64::Passes::Lowering
                     if (fitsUnsignedScaledOffset(offset, scale))
                     {
                         auto* str = createInstr2(Operator::STR, new RegOperand(src), new MemOperand(PR::sp, offset));
-                        *it = str;
+                        it = block->insts.replace(it, str);
                     }
                     else
                     {
@@ -72,7 +72,7 @@ namespace BE::AArch64::Passes::Lowering
 
                         // 4. STR src, [x16, #0]
                         auto* str = createInstr2(Operator::STR, new RegOperand(src), new MemOperand(tmpReg, 0));
-                        *it = str;
+                        it = block->insts.replace(it, str);
                     }
                     
                     BE::MInstruction::delInst(inst);
@@ -94,7 +94,7 @@ namespace BE::AArch64::Passes::Lowering
                     if (fitsUnsignedScaledOffset(offset, scale))
                     {
                         auto* ldr = createInstr2(Operator::LDR, new RegOperand(dest), new MemOperand(PR::sp, offset));
-                        *it = ldr;
+                        it = block->insts.replace(it, ldr);
                     }
                     else
                     {
@@ -119,7 +119,7 @@ namespace BE::AArch64::Passes::Lowering
 
                         // 4. LDR dest, [x16, #0]
                         auto* ldr = createInstr2(Operator::LDR, new RegOperand(dest), new MemOperand(tmpReg, 0));
-                        *it = ldr;
+                        it = block->insts.replace(it, ldr);
                     }
 
                     BE::MInstruction::delInst(inst);
@@ -12,6 +12,10 @@ namespace BE::AArch64::Passes::Lowering
         ~StackLoweringPass() = default;
 
         void runOnModule(BE::Module& module);
+        void runOnFunction(BE::Function* func)
+        {
+            if (func) lowerFunction(func);
+        }
 
       private:
         void lowerFunction(BE::Function* func);
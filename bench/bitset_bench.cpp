@@ -0,0 +1,322 @@
+/*
+ * 位集基准：在生成的 CFG 上用 Cele::dynamic_bitset 与 std::set<int> 分别求活跃变量（逆序轮转迭代到不动点），
+ * 比较耗时并校验两者结果一致；另测置位遍历与小位集拷贝两类常见操作。
+ *
+ * 开头先在随机小位集上把 find_first/find_next、返回“是否改变”的集合运算、子集判断与 resize
+ * 逐项和 std::set<int> 对照，覆盖内联存储与堆存储之间的切换。
+ *
+ * 用法：bin/bitset_bench [最大基本块数]
+ */
+#include <dynamic_bitset.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace std;
+using Cele::dynamic_bitset;
+
+namespace
+{
+    template <typename F>
+    double bestMs(F&& run, int repeat = 3)
+    {
+        double best = 1e300;
+        for (int i = 0; i < repeat; ++i)
+        {
+            auto start = chrono::steady_clock::now();
+            run();
+            best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    set<int> toSet(const dynamic_bitset& bs)
+    {
+        set<int> s;
+        for (size_t i = bs.find_first(); i != dynamic_bitset::npos; i = bs.find_next(i)) s.insert(static_cast<int>(i));
+        return s;
+    }
+
+    dynamic_bitset randomBits(size_t n, mt19937& rng)
+    {
+        dynamic_bitset bs(n);
+        // 密度随机取，既有稀疏也有接近全满的位集
+        uniform_int_distribution<int> density(0, 100);
+        int                           d = density(rng);
+        for (size_t i = 0; i < n; ++i)
+            if (static_cast<int>(rng() % 100) < d) bs.set(i);
+        return bs;
+    }
+
+    // 每种运算与 std::set 上的同义运算比较，返回不一致的次数
+    int fuzzOps(mt19937& rng, int runs)
+    {
+        int bad = 0;
+        for (int r = 0; r < runs; ++r)
+        {
+            size_t         n = rng() % 300;
+            dynamic_bitset a = randomBits(n, rng), b = randomBits(n, rng), c = randomBits(n, rng);
+            set<int>       sa = toSet(a), sb = toSet(b), sc = toSet(c);
+
+            size_t cnt = 0;
+            a.for_each_set([&](size_t i) { cnt += sa.count(static_cast<int>(i)); });
+            bad += cnt != sa.size() || a.count() != sa.size();
+
+            set<int> expect;
+            set_union(sa.begin(), sa.end(), sb.begin(), sb.end(), inserter(expect, expect.end()));
+            dynamic_bitset t = a;
+            bad += t.union_with(b) != (expect != sa) || toSet(t) != expect;
+
+            expect.clear();
+            set_intersection(sa.begin(), sa.end(), sb.begin(), sb.end(), inserter(expect, expect.end()));
+            t = a;
+            bad += t.intersect_with(b) != (expect != sa) || toSet(t) != expect;
+            bad += a.intersects(b) != !expect.empty();
+
+            expect.clear();
+            set_difference(sa.begin(), sa.end(), sb.begin(), sb.end(), inserter(expect, expect.end()));
+            t = a;
+            bad += t.subtract(b) != (expect != sa) || toSet(t) != expect;
+            bad += a.is_subset_of(b) != expect.empty();
+
+            // a |= b & ~c 与 a = b | (a & ~c)
+            set<int> diff, fused;
+            set_difference(sb.begin(), sb.end(), sc.begin(), sc.end(), inserter(diff, diff.end()));
+            set_union(sa.begin(), sa.end(), diff.begin(), diff.end(), inserter(fused, fused.end()));
+            t = a;
+            bad += t.union_with_difference(b, c) != (fused != sa) || toSet(t) != fused;
+
+            diff.clear();
+            fused.clear();
+            set_difference(sa.begin(), sa.end(), sc.begin(), sc.end(), inserter(diff, diff.end()));
+            set_union(sb.begin(), sb.end(), diff.begin(), diff.end(), inserter(fused, fused.end()));
+            t = a;
+            bad += t.assign_union_difference(b, t, c) != (fused != sa) || toSet(t) != fused;
+
+            // resize 在内联与堆存储之间来回切换
+            size_t         m     = rng() % 300;
+            bool           value = rng() & 1;
+            dynamic_bitset g     = a;
+            g.resize(m, value);
+            set<int> grown;
+            for (int i : sa)
+                if (static_cast<size_t>(i) < m) grown.insert(i);
+            if (value)
+                for (size_t i = n; i < m; ++i) grown.insert(static_cast<int>(i));
+            bad += g.size() != m || toSet(g) != grown || g.count() != grown.size();
+
+            dynamic_bitset moved(std::move(g));
+            bad += toSet(moved) != grown || !g.empty();
+        }
+        return bad;
+    }
+
+    struct Cfg
+    {
+        vector<vector<int>> succs;
+        vector<vector<int>> uses;  // 块内先用后定义的虚拟寄存器（upward exposed use）
+        vector<vector<int>> defs;
+    };
+
+    // 顺序排列的基本块，带前向跳转与回边；每个虚拟寄存器在一个块中定义，在其后不远的若干块中使用
+    Cfg makeCfg(int blocks, int vregs, mt19937& rng)
+    {
+        Cfg cfg;
+        cfg.succs.resize(blocks);
+        cfg.uses.resize(blocks);
+        cfg.defs.resize(blocks);
+        for (int b = 0; b + 1 < blocks; ++b)
+        {
+            cfg.succs[b].push_back(b + 1);
+            if (rng() % 4 == 0) cfg.succs[b].push_back(min(blocks - 1, b + 2 + static_cast<int>(rng() % 8)));
+            if (rng() % 6 == 0) cfg.succs[b].push_back(max(0, b - 1 - static_cast<int>(rng() % 16)));
+        }
+
+        for (int v = 0; v < vregs; ++v)
+        {
+            int def  = rng() % blocks;
+            int span = 1 + rng() % 32;
+            cfg.defs[def].push_back(v);
+            int useCount = 1 + rng() % 3;
+            for (int k = 0; k < useCount; ++k)
+            {
+                int use = min(blocks - 1, def + static_cast<int>(rng() % span));
+                if (use != def) cfg.uses[use].push_back(v);
+            }
+        }
+        for (auto& u : cfg.uses)
+        {
+            sort(u.begin(), u.end());
+            u.erase(unique(u.begin(), u.end()), u.end());
+        }
+        return cfg;
+    }
+
+    struct BitsetLiveness
+    {
+        vector<dynamic_bitset> use, def, in, out;
+
+        void solve(const Cfg& cfg, int vregs)
+        {
+            int blocks = static_cast<int>(cfg.succs.size());
+            use.assign(blocks, dynamic_bitset(vregs));
+            def.assign(blocks, dynamic_bitset(vregs));
+            in.assign(blocks, dynamic_bitset(vregs));
+            out.assign(blocks, dynamic_bitset(vregs));
+            for (int b = 0; b < blocks; ++b)
+            {
+                for (int v : cfg.uses[b]) use[b].set(v);
+                for (int v : cfg.defs[b]) def[b].set(v);
+            }
+
+            bool changed = true;
+            while (changed)
+            {
+                changed = false;
+                for (int b = blocks - 1; b >= 0; --b)
+                {
+                    for (int s : cfg.succs[b]) out[b].union_with(in[s]);
+                    changed |= in[b].assign_union_difference(use[b], out[b], def[b]);
+                }
+            }
+        }
+    };
+
+    struct SetLiveness
+    {
+        vector<set<int>> use, def, in, out;
+
+        void solve(const Cfg& cfg)
+        {
+            int blocks = static_cast<int>(cfg.succs.size());
+            use.assign(blocks, {});
+            def.assign(blocks, {});
+            in.assign(blocks, {});
+            out.assign(blocks, {});
+            for (int b = 0; b < blocks; ++b)
+            {
+                use[b].insert(cfg.uses[b].begin(), cfg.uses[b].end());
+                def[b].insert(cfg.defs[b].begin(), cfg.defs[b].end());
+            }
+
+            bool changed = true;
+            while (changed)
+            {
+                changed = false;
+                for (int b = blocks - 1; b >= 0; --b)
+                {
+                    for (int s : cfg.succs[b]) out[b].insert(in[s].begin(), in[s].end());
+                    set<int> next = use[b];
+                    for (int v : out[b])
+                        if (!def[b].count(v)) next.insert(v);
+                    if (next != in[b])
+                    {
+                        in[b]   = std::move(next);
+                        changed = true;
+                    }
+                }
+            }
+        }
+    };
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    int maxBlocks = argc > 1 ? atoi(argv[1]) : 1024;
+
+    mt19937 rng(20251017);
+    int     mismatches = fuzzOps(rng, 3000);
+    bool    allOk      = mismatches == 0;
+    printf("bitset ops vs std::set on random small sets: %d mismatches in 3000 runs\n\n", mismatches);
+
+    printf("%-8s %8s %8s %12s %12s %9s %s\n", "blocks", "vregs", "live", "bitset ms", "set ms", "speedup", "check");
+    for (int blocks = 64; blocks <= maxBlocks; blocks <<= 2)
+    {
+        int vregs = blocks * 4;
+        Cfg cfg   = makeCfg(blocks, vregs, rng);
+
+        BitsetLiveness bits;
+        SetLiveness    sets;
+        double         bitsMs = bestMs([&] { bits.solve(cfg, vregs); });
+        double         setMs  = bestMs([&] { sets.solve(cfg); });
+
+        bool   ok   = true;
+        size_t live = 0;
+        for (int b = 0; b < blocks; ++b)
+        {
+            ok &= toSet(bits.in[b]) == sets.in[b] && toSet(bits.out[b]) == sets.out[b];
+            live += sets.in[b].size();
+        }
+        allOk &= ok;
+        printf("%-8d %8d %8zu %12.2f %12.2f %8.1fx %s\n", blocks, vregs, live / blocks, bitsMs, setMs,
+            setMs / max(bitsMs, 1e-3), ok ? "ok" : "MISMATCH");
+    }
+
+    // 遍历活跃集合：分配寄存器、构造冲突图时的主要操作
+    printf("\n%-8s %8s %12s %12s %9s\n", "vregs", "density", "bitset ms", "set ms", "speedup");
+    for (int vregs : {64, 1024, 16384})
+    {
+        for (int density : {2, 25})
+        {
+            dynamic_bitset bs(vregs);
+            set<int>       s;
+            for (int v = 0; v < vregs; ++v)
+                if (static_cast<int>(rng() % 100) < density)
+                {
+                    bs.set(v);
+                    s.insert(v);
+                }
+
+            const int rounds  = (1 << 22) / vregs;
+            long long sumBits = 0, sumSet = 0;
+            double    bitsMs  = bestMs([&] {
+                for (int r = 0; r < rounds; ++r) bs.for_each_set([&](size_t v) { sumBits += v; });
+            });
+            double    setMs   = bestMs([&] {
+                for (int r = 0; r < rounds; ++r)
+                    for (int v : s) sumSet += v;
+            });
+            allOk &= sumBits == sumSet;
+            printf("%-8d %7d%% %12.2f %12.2f %8.1fx\n", vregs, density, bitsMs, setMs, setMs / max(bitsMs, 1e-3));
+        }
+    }
+
+    // 小位集的拷贝：基本块数少的函数中 in/out 集合通常不超过 128 位，不再申请堆内存
+    printf("\n%-8s %12s %12s %9s\n", "bits", "bitset ms", "set ms", "speedup");
+    for (int bits : {64, 128, 1024})
+    {
+        dynamic_bitset src(bits);
+        set<int>       srcSet;
+        for (int v = 0; v < bits; v += 3)
+        {
+            src.set(v);
+            srcSet.insert(v);
+        }
+
+        const int rounds = 1 << 18;
+        size_t    sink   = 0;
+        double    bitsMs = bestMs([&] {
+            for (int r = 0; r < rounds; ++r)
+            {
+                dynamic_bitset copy(src);
+                sink += copy.size();
+            }
+        });
+        double    setMs  = bestMs([&] {
+            for (int r = 0; r < rounds; ++r)
+            {
+                set<int> copy(srcSet);
+                sink += copy.size();
+            }
+        });
+        printf("%-8d %12.2f %12.2f %8.1fx\n", bits, bitsMs, setMs, setMs / max(bitsMs, 1e-3));
+        if (sink == 0) allOk = false;
+    }
+
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,405 @@
+/*
+ * 支配树分析基准：在生成的 CFG 上对比 DomAnalyzer（迭代式 Semi-NCA + CSR 支配边界）
+ * 与原先的递归 Lengauer-Tarjan 实现（LegacyDomAnalyzer，照原样保留在本文件中作为参照），
+ * 同时校验两者给出的 idom 与支配边界一致。
+ *
+ * 第二部分测 DomTreeUpdater：在随机小图上逐步做随机的边插入/删除并与从头求解的结果逐项比较，
+ * 再在大图上对比增量更新与每次更新后从头求解的耗时。
+ *
+ * 用法：bin/dom_bench [最大节点数] [参照实现的最大节点数]
+ * 参照实现递归做 DFS，深度过大会栈溢出，超过第二个参数的规模只测新实现。
+ */
+#include <dom_analyzer.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    using Graph = vector<vector<int>>;
+
+    // 原 utils/dom_analyser.cpp 中的实现，只做了去注释
+    class LegacyDomAnalyzer
+    {
+      public:
+        vector<vector<int>> dom_tree;
+        vector<set<int>>    dom_frontier;
+        vector<int>         imm_dom;
+
+        void solve(const Graph& graph, const vector<int>& entry_points)
+        {
+            int   node_count     = graph.size();
+            int   virtual_source = node_count;
+            Graph working_graph  = graph;
+            working_graph.push_back(vector<int>());
+            for (int entry : entry_points) working_graph[virtual_source].push_back(entry);
+            build(working_graph, node_count + 1, virtual_source);
+        }
+
+      private:
+        void build(const Graph& working_graph, int node_count, int virtual_source)
+        {
+            Graph backward_edges(node_count);
+            for (int u = 0; u < node_count; ++u)
+                for (int v : working_graph[u]) backward_edges[v].push_back(u);
+
+            dom_tree.assign(node_count, {});
+            dom_frontier.assign(node_count, {});
+            imm_dom.assign(node_count, 0);
+
+            int         dfs_count = -1;
+            vector<int> block_to_dfs(node_count, 0), dfs_to_block(node_count), parent(node_count, 0);
+            vector<int> semi_dom(node_count), dsu_parent(node_count), min_ancestor(node_count);
+            Graph       semi_children(node_count);
+            for (int i = 0; i < node_count; ++i) dsu_parent[i] = min_ancestor[i] = semi_dom[i] = i;
+
+            function<void(int)> dfs = [&](int block) {
+                block_to_dfs[block]     = ++dfs_count;
+                dfs_to_block[dfs_count] = block;
+                semi_dom[block]         = block_to_dfs[block];
+                for (int next : working_graph[block])
+                    if (!block_to_dfs[next])
+                    {
+                        dfs(next);
+                        parent[next] = block;
+                    }
+            };
+            dfs(virtual_source);
+
+            auto dsu_find = [&](int u, const auto& self) -> int {
+                if (dsu_parent[u] == u) return u;
+                int root = self(dsu_parent[u], self);
+                if (semi_dom[min_ancestor[dsu_parent[u]]] < semi_dom[min_ancestor[u]])
+                    min_ancestor[u] = min_ancestor[dsu_parent[u]];
+                dsu_parent[u] = root;
+                return root;
+            };
+            auto dsu_query = [&](int u) -> int {
+                dsu_find(u, dsu_find);
+                return min_ancestor[u];
+            };
+
+            for (int dfs_id = dfs_count; dfs_id >= 1; --dfs_id)
+            {
+                int curr = dfs_to_block[dfs_id];
+                for (int pred : backward_edges[curr])
+                {
+                    if (pred != virtual_source && block_to_dfs[pred] == 0) continue;
+                    int eval_node = block_to_dfs[pred] < block_to_dfs[curr] ? pred : dsu_query(pred);
+                    if (semi_dom[eval_node] < semi_dom[curr]) semi_dom[curr] = semi_dom[eval_node];
+                }
+                semi_children[dfs_to_block[semi_dom[curr]]].push_back(curr);
+                dsu_parent[curr] = parent[curr];
+
+                int p = parent[curr];
+                for (int child : semi_children[p])
+                {
+                    int u          = dsu_query(child);
+                    imm_dom[child] = semi_dom[u] < semi_dom[child] ? u : p;
+                }
+                semi_children[p].clear();
+            }
+
+            for (int dfs_id = 1; dfs_id <= dfs_count; ++dfs_id)
+            {
+                int curr = dfs_to_block[dfs_id];
+                if (imm_dom[curr] != dfs_to_block[semi_dom[curr]]) imm_dom[curr] = imm_dom[imm_dom[curr]];
+            }
+
+            for (int i = 0; i < node_count; ++i)
+                if (block_to_dfs[i]) dom_tree[imm_dom[i]].push_back(i);
+
+            dom_tree.resize(virtual_source);
+            dom_frontier.resize(virtual_source);
+            imm_dom.resize(virtual_source);
+            for (int i = 0; i < virtual_source; ++i)
+                if (imm_dom[i] == virtual_source) imm_dom[i] = i;
+
+            for (int block = 0; block < node_count; ++block)
+            {
+                if (block_to_dfs[block] == 0) continue;
+                for (int succ : working_graph[block])
+                {
+                    if (block_to_dfs[succ] == 0) continue;
+                    int runner = block;
+                    while (runner != imm_dom[succ] && runner != virtual_source &&
+                           static_cast<size_t>(runner) < dom_frontier.size())
+                    {
+                        if (succ < virtual_source) dom_frontier[runner].insert(succ);
+                        runner = imm_dom[runner];
+                        if (runner == block || runner == imm_dom[runner]) break;
+                    }
+                }
+            }
+        }
+    };
+
+    // ------------------------------------------------------------------------
+    // CFG 生成：节点 0 为入口，最后一个节点为出口
+    // ------------------------------------------------------------------------
+
+    // 随机结构化程序：多数节点顺序流向下一个，部分为分支（向前跳）或回边（向后跳）
+    Graph randomCfg(int n, mt19937& rng)
+    {
+        Graph                         g(n);
+        uniform_int_distribution<int> kind(0, 9);
+        uniform_int_distribution<int> span(2, 64);
+        for (int u = 0; u + 1 < n; ++u)
+        {
+            g[u].push_back(u + 1);
+            int k = kind(rng);
+            if (k < 3) g[u].push_back(min(n - 1, u + span(rng)));
+            else if (k < 4 && u > 0) g[u].push_back(max(0, u - span(rng)));
+        }
+        return g;
+    }
+
+    // 一条长链：递归 DFS 的最坏情况
+    Graph chainCfg(int n)
+    {
+        Graph g(n);
+        for (int u = 0; u + 1 < n; ++u) g[u].push_back(u + 1);
+        return g;
+    }
+
+    // 连续的 if-else 菱形，每个汇合点都有两个前驱
+    Graph diamondCfg(int n)
+    {
+        n = max(4, n - (n - 1) % 3);
+        Graph g(n);
+        for (int u = 0; u + 3 < n; u += 3)
+        {
+            g[u]     = {u + 1, u + 2};
+            g[u + 1] = {u + 3};
+            g[u + 2] = {u + 3};
+        }
+        return g;
+    }
+
+    // 一串深度为 depth 的循环嵌套：每层循环头是上一层循环体的入口，又有来自本层尾的回边
+    Graph loopNestCfg(int n, int depth = 32)
+    {
+        Graph g(n);
+        for (int u = 0; u + 1 < n; ++u) g[u].push_back(u + 1);
+        for (int base = 0; base + 2 * depth <= n; base += 2 * depth)
+            for (int d = 0; d < depth; ++d) g[base + 2 * depth - 1 - d].push_back(base + d);
+        return g;
+    }
+
+    // ------------------------------------------------------------------------
+
+    // 取 repeat 次中最快的一次，减小计时抖动
+    template <typename F>
+    double bestMs(F&& run, int repeat = 3)
+    {
+        double best = 1e300;
+        for (int i = 0; i < repeat; ++i)
+        {
+            auto start = chrono::steady_clock::now();
+            run();
+            best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+
+    // 比较 idom 与支配边界；旧实现的支配边界不包含根自身，比较时去掉根
+    bool sameResult(const DomAnalyzer& a, const LegacyDomAnalyzer& b, const Graph& g)
+    {
+        int n = g.size();
+        for (int i = 0; i < n; ++i)
+        {
+            if (a.imm_dom[i] < 0) continue;
+            if (a.imm_dom[i] != b.imm_dom[i]) return false;
+
+            vector<int> lhs, rhs;
+            for (int x : a.dom_frontier[i])
+                if (a.imm_dom[x] != x) lhs.push_back(x);
+            for (int x : b.dom_frontier[i])
+                if (b.imm_dom[x] != x) rhs.push_back(x);
+            if (lhs != rhs) return false;
+        }
+        return true;
+    }
+
+    // 与在当前图上从头求解的结果比较，包括支配树子节点的顺序与支配边界
+    bool sameAsScratch(DomTreeUpdater& updater, const DomAnalyzer& inc, const Graph& g)
+    {
+        updater.flush();
+        DomAnalyzer ref;
+        ref.solve(g, {0});
+        return inc.imm_dom == ref.imm_dom && inc.dom_tree == ref.dom_tree &&
+               inc.dom_frontier.offset == ref.dom_frontier.offset && inc.dom_frontier.blocks == ref.dom_frontier.blocks;
+    }
+
+    // 随机生成一条更新并同时作用到 g 上：插入一条较短的边、删除一条已有边，偶尔加入一个新节点
+    DomTreeUpdater::Update randomUpdate(Graph& g, mt19937& rng)
+    {
+        using Kind = DomTreeUpdater::UpdateKind;
+
+        int                           n = g.size();
+        uniform_int_distribution<int> pick(0, n - 1);
+        uniform_int_distribution<int> span(-16, 16);
+
+        int kind = rng() % 16;
+        if (kind == 0)
+        {
+            int u = pick(rng);
+            g.emplace_back();
+            g[u].push_back(n);
+            return {Kind::Insert, u, n};
+        }
+        if (kind < 8)
+        {
+            for (int tries = 0; tries < 8; ++tries)
+            {
+                int u = pick(rng);
+                if (g[u].empty()) continue;
+                size_t k = rng() % g[u].size();
+                int    v = g[u][k];
+                g[u].erase(g[u].begin() + k);
+                return {Kind::Delete, u, v};
+            }
+        }
+        int u = pick(rng);
+        int v = min(n - 1, max(0, u + span(rng)));
+        g[u].push_back(v);
+        return {Kind::Insert, u, v};
+    }
+
+    void applyOne(DomTreeUpdater& updater, const DomTreeUpdater::Update& u)
+    {
+        if (u.kind == DomTreeUpdater::UpdateKind::Insert)
+            updater.insertEdge(u.from, u.to);
+        else
+            updater.deleteEdge(u.from, u.to);
+    }
+
+    // 随机小图上逐步更新，每一步都与从头求解比较；约四分之一的步骤以一批更新的形式提交
+    int fuzzUpdater(mt19937& rng, int trials)
+    {
+        int mismatches = 0;
+        for (int t = 0; t < trials; ++t)
+        {
+            Graph          g = randomCfg(1 + rng() % 48, rng);
+            DomAnalyzer    dom;
+            DomTreeUpdater updater(dom);
+            dom.solve(g, {0});
+            updater.reset(g, 0);
+
+            for (int step = 0; step < 64; ++step)
+            {
+                if (rng() % 4 == 0)
+                {
+                    vector<DomTreeUpdater::Update> batch;
+                    for (int i = 1 + rng() % 6; i > 0; --i) batch.push_back(randomUpdate(g, rng));
+                    updater.applyUpdates(batch);
+                }
+                else
+                    applyOne(updater, randomUpdate(g, rng));
+
+                if (!sameAsScratch(updater, dom, g))
+                {
+                    ++mismatches;
+                    break;
+                }
+            }
+        }
+        return mismatches;
+    }
+
+    struct Shape
+    {
+        const char*          name;
+        function<Graph(int)> make;
+    };
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    int maxNodes  = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int maxLegacy = argc > 2 ? atoi(argv[2]) : 1 << 16;
+
+    mt19937       rng(20251017);
+    vector<Shape> shapes = {
+        {"random", [&](int n) { return randomCfg(n, rng); }},
+        {"chain", chainCfg},
+        {"diamond", diamondCfg},
+        {"loopnest", [](int n) { return loopNestCfg(n); }},
+    };
+    const vector<int> entry = {0};
+
+    printf("%-10s %10s %12s %12s %9s %s\n", "shape", "nodes", "semi-nca ms", "legacy ms", "speedup", "check");
+    bool allOk = true;
+    for (auto& shape : shapes)
+    {
+        for (int n = 1 << 10; n <= maxNodes; n <<= 2)
+        {
+            Graph g = shape.make(n);
+
+            DomAnalyzer fast;
+            double      fastMs = bestMs([&] { fast.solve(g, entry); });
+
+            if (static_cast<int>(g.size()) > maxLegacy)
+            {
+                printf("%-10s %10zu %12.2f %12s %9s %s\n", shape.name, g.size(), fastMs, "-", "-", "-");
+                continue;
+            }
+
+            LegacyDomAnalyzer legacy;
+            double            legacyMs = bestMs([&] { legacy.solve(g, entry); });
+
+            bool ok = sameResult(fast, legacy, g);
+            allOk &= ok;
+            printf("%-10s %10zu %12.2f %12.2f %8.1fx %s\n", shape.name, g.size(), fastMs, legacyMs,
+                legacyMs / max(fastMs, 1e-3), ok ? "ok" : "MISMATCH");
+        }
+    }
+
+    int mismatches = fuzzUpdater(rng, 2000);
+    allOk &= mismatches == 0;
+    printf("\nincremental updates on random small graphs: %d mismatches in 2000 runs\n\n", mismatches);
+
+    // 每次更新后从头求解的耗时按最终图上一次求解的耗时估计
+    const int updates = 1000;
+    printf("%-10s %10s %8s %12s %12s %9s %s\n", "shape", "nodes", "updates", "update ms", "scratch ms", "speedup",
+        "check");
+    for (auto& shape : shapes)
+    {
+        if (string(shape.name) == "chain") continue;
+        for (int n = 1 << 12; n <= min(maxNodes, 1 << 16); n <<= 4)
+        {
+            Graph          g = shape.make(n);
+            DomAnalyzer    dom;
+            DomTreeUpdater updater(dom);
+            dom.solve(g, entry);
+            updater.reset(g, 0);
+
+            vector<DomTreeUpdater::Update> stream;
+            for (int i = 0; i < updates; ++i) stream.push_back(randomUpdate(g, rng));
+
+            double updateMs = bestMs(
+                [&] {
+                    for (auto& u : stream) applyOne(updater, u);
+                    updater.flush();
+                },
+                1);
+
+            DomAnalyzer scratch;
+            double      scratchMs = bestMs([&] { scratch.solve(g, entry); }) * updates;
+
+            bool ok = sameAsScratch(updater, dom, g);
+            allOk &= ok;
+            printf("%-10s %10zu %8d %12.2f %12.2f %8.1fx %s\n", shape.name, g.size(), updates, updateMs, scratchMs,
+                scratchMs / max(updateMs, 1e-3), ok ? "ok" : "MISMATCH");
+        }
+    }
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+"""
+This script measures how the compile time of the SysY compiler scales.
+It generates synthetic SysY programs that grow along one axis at a time
+(number of functions, blocks per function, expression depth, loop nest
+depth, array initializer size, live variables), compiles each of them
+with `bin/compiler -time-passes`, and records per-phase time and peak RSS
+as JSON. Phases whose time grows clearly faster than the input are
+reported as super-linear.
+
+Usage:
+    python3 compile_bench.py                       # all axes, default scales
+    python3 compile_bench.py --axis live_vars --steps 6 --opt 1
+    python3 compile_bench.py --gen-only            # only write the .sy files
+"""
+import argparse
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+from dataclasses import dataclass, field, asdict
+from typing import Callable, Dict, List, Optional
+
+
+SYSY = "bin/compiler"
+BENCH_OUTPUT_DIR = "bench_output"
+
+COMPILE_TIMEOUT = 120
+
+# Growth exponent above which a phase is reported as super-linear: time ~ size^k
+SUPERLINEAR_EXPONENT = 1.5
+# Phases faster than this (ms) at the largest size are too noisy to judge
+MIN_PHASE_MS = 5.0
+
+
+# ----------------------------------------------------------------------------
+# Program generator
+# ----------------------------------------------------------------------------
+
+def _gen_functions(n: int) -> str:
+    """n small functions, all called from main."""
+    out = []
+    for i in range(n):
+        out.append(
+            f"int f{i}(int a, int b) {{\n"
+            f"    int c = a * {i % 7 + 1} + b;\n"
+            f"    if (c > {i}) c = c - b;\n"
+            f"    return c + {i};\n"
+            f"}}\n")
+    out.append("int main() {\n    int s = 0;\n")
+    for i in range(n):
+        out.append(f"    s = s + f{i}(s, {i});\n")
+    out.append("    putint(s);\n    return 0;\n}\n")
+    return "".join(out)
+
+
+def _gen_blocks(n: int) -> str:
+    """One function with n if/else diamonds, i.e. about 3n basic blocks."""
+    out = ["int work(int x) {\n    int s = 0;\n"]
+    for i in range(n):
+        out.append(
+            f"    if (x % {i % 13 + 2} == {i % 3}) {{\n"
+            f"        s = s + {i};\n"
+            f"    }} else {{\n"
+            f"        s = s - x;\n"
+            f"    }}\n"
+            f"    x = x + 1;\n")
+    out.append("    return s;\n}\n")
+    out.append("int main() {\n    putint(work(getint()));\n    return 0;\n}\n")
+    return "".join(out)
+
+
+def _gen_expr_depth(n: int) -> str:
+    """One expression nested n levels deep."""
+    ops = ["+", "-", "*", "+"]
+    expr = "x"
+    for i in range(n):
+        expr = f"({expr} {ops[i % len(ops)]} {i % 5 + 1})"
+    return (
+        "int main() {\n"
+        "    int x = getint();\n"
+        f"    int y = {expr};\n"
+        "    putint(y);\n"
+        "    return 0;\n"
+        "}\n")
+
+
+def _gen_loop_depth(n: int) -> str:
+    """n nested while loops, each with its own induction variable."""
+    out = ["int main() {\n    int s = 0;\n"]
+    for i in range(n):
+        out.append(f"    int i{i} = 0;\n")
+    for i in range(n):
+        ind = "    " * (i + 1)
+        if i > 0:
+            out.append(f"{ind}i{i} = 0;\n")
+        out.append(f"{ind}while (i{i} < 2) {{\n")
+    ind = "    " * (n + 1)
+    out.append(f"{ind}s = s + 1;\n")
+    for i in reversed(range(n)):
+        ind = "    " * (i + 1)
+        out.append(f"{ind}    i{i} = i{i} + 1;\n")
+        out.append(f"{ind}}}\n")
+    out.append("    putint(s);\n    return 0;\n}\n")
+    return "".join(out)
+
+
+def _gen_array_init(n: int) -> str:
+    """A global and a local array with n-element initializer lists."""
+    vals = ", ".join(str((i * 7) % 101) for i in range(n))
+    return (
+        f"int g[{n}] = {{{vals}}};\n"
+        "int main() {\n"
+        f"    int a[{n}] = {{{vals}}};\n"
+        f"    putint(g[{n - 1}] + a[getint() % {n}]);\n"
+        "    return 0;\n"
+        "}\n")
+
+
+def _gen_live_vars(n: int) -> str:
+    """n variables that are all live across a loop."""
+    out = ["int main() {\n    int k = getint();\n"]
+    for i in range(n):
+        out.append(f"    int v{i} = k + {i};\n")
+    out.append("    int i = 0;\n    while (i < k) {\n")
+    for i in range(n):
+        out.append(f"        v{i} = v{i} + v{(i + 1) % n};\n")
+    out.append("        i = i + 1;\n    }\n    int s = 0;\n")
+    for i in range(n):
+        out.append(f"    s = s + v{i};\n")
+    out.append("    putint(s);\n    return 0;\n}\n")
+    return "".join(out)
+
+
+@dataclass
+class Axis:
+    """One scaling axis: a generator and the size of its first step."""
+    name: str
+    generate: Callable[[int], str]
+    base: int
+
+
+AXES = [
+    Axis("functions", _gen_functions, 50),
+    Axis("blocks", _gen_blocks, 50),
+    Axis("expr_depth", _gen_expr_depth, 50),
+    Axis("loop_depth", _gen_loop_depth, 4),
+    Axis("array_init", _gen_array_init, 500),
+    Axis("live_vars", _gen_live_vars, 25),
+]
+
+
+# ----------------------------------------------------------------------------
+# Harness
+# ----------------------------------------------------------------------------
+
+@dataclass
+class Phase:
+    ms: float
+    runs: int
+    inst_delta: int
+
+
+@dataclass
+class BenchResult:
+    axis: str
+    size: int
+    source_bytes: int
+    status: str
+    wall_ms: float = 0.0
+    peak_rss_kb: int = 0
+    phases: Dict[str, Phase] = field(default_factory=dict)
+
+
+# "     3.870     2.6%       1           -3  mem2reg"
+_REPORT_ROW = re.compile(r"^\s*([\d.]+)\s+([\d.]+)%\s+(\d+)\s+([+-]\d+)\s+(\S+)\s*$")
+
+
+def parse_time_report(stderr: str) -> Dict[str, Phase]:
+    """Extract the rows of the -time-passes report; other stderr output is ignored."""
+    phases = {}
+    for line in stderr.splitlines():
+        m = _REPORT_ROW.match(line)
+        if m:
+            phases[m.group(5)] = Phase(float(m.group(1)), int(m.group(3)), int(m.group(4)))
+    return phases
+
+
+def run_compiler(src: str, out: str, args) -> BenchResult:
+    """Compile one file, measuring wall time and the child's own peak RSS."""
+    cmd = [SYSY, "-S" if args.stage == "asm" else "-llvm", f"-O{args.opt}",
+           "-time-passes", "-o", out, src]
+    if args.jobs > 1:
+        cmd += ["-j", str(args.jobs)]
+
+    # stderr goes to a file: the report comes after all debug output and a pipe could fill up,
+    # and wait4 gives the rusage (peak RSS) of exactly this child
+    killed = []
+
+    def kill(proc):
+        killed.append(True)
+        proc.kill()
+
+    with tempfile.TemporaryFile("w+") as err:
+        start = time.perf_counter()
+        proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=err, text=True)
+        timer = threading.Timer(COMPILE_TIMEOUT, kill, [proc])
+        timer.start()
+        _, wstatus, usage = os.wait4(proc.pid, 0)
+        wall_ms = (time.perf_counter() - start) * 1000.0
+        timer.cancel()
+        proc.returncode = os.waitstatus_to_exitcode(wstatus)
+
+        err.seek(0)
+        stderr = err.read()
+
+    if killed:
+        status = "timeout"
+    elif proc.returncode != 0:
+        status = f"exit {proc.returncode}"
+    else:
+        status = "ok"
+    return BenchResult("", 0, os.path.getsize(src), status, wall_ms, usage.ru_maxrss, parse_time_report(stderr))
+
+
+def growth_exponent(points: List[BenchResult], key: Callable[[BenchResult], Optional[float]]) -> Optional[float]:
+    """Least-squares slope of log(value) over log(size), i.e. k in value ~ size^k."""
+    xs, ys = [], []
+    for p in points:
+        v = key(p)
+        if p.status == "ok" and v is not None and v > 0:
+            xs.append(math.log(p.size))
+            ys.append(math.log(v))
+    if len(xs) < 2:
+        return None
+    mx, my = sum(xs) / len(xs), sum(ys) / len(ys)
+    den = sum((x - mx) ** 2 for x in xs)
+    if den == 0:
+        return None
+    return sum((x - mx) * (y - my) for x, y in zip(xs, ys)) / den
+
+
+def analyse(axis: str, points: List[BenchResult], threshold: float) -> dict:
+    """Growth exponents of total time, peak RSS and every phase along one axis."""
+    ok = [p for p in points if p.status == "ok"]
+    names = []
+    for p in ok:
+        for name in p.phases:
+            if name not in names:
+                names.append(name)
+
+    phases = {}
+    superlinear = []
+    for name in names:
+        k = growth_exponent(ok, lambda p: p.phases[name].ms if name in p.phases else None)
+        phases[name] = k
+        largest = ok[-1].phases.get(name) if ok else None
+        if k is not None and k > threshold and largest and largest.ms >= MIN_PHASE_MS:
+            superlinear.append(name)
+
+    return {
+        "axis": axis,
+        "wall_exponent": growth_exponent(ok, lambda p: p.wall_ms),
+        "rss_exponent": growth_exponent(ok, lambda p: float(p.peak_rss_kb)),
+        "phase_exponents": phases,
+        "superlinear": superlinear,
+        "failures": [{"size": p.size, "status": p.status} for p in points if p.status != "ok"],
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile-time scaling benchmark for the SysY compiler.")
+    parser.add_argument("--axis", action="append", choices=[a.name for a in AXES],
+                        help="Axis to measure (repeatable). Default: all axes.")
+    parser.add_argument("--steps", default=5, type=int,
+                        help="Number of sizes per axis; each step doubles the size.")
+    parser.add_argument("--scale", default=1.0, type=float,
+                        help="Multiply the base size of every axis.")
+    parser.add_argument("--opt", default=1, type=int, choices=[0, 1, 2],
+                        help="Optimization level.")
+    parser.add_argument("--stage", default="asm", choices=["llvm", "asm"],
+                        help="Stop after IR (-llvm) or run the backend (-S).")
+    parser.add_argument("-j", "--jobs", default=1, type=int,
+                        help="Thread count passed to the compiler.")
+    parser.add_argument("--threshold", default=SUPERLINEAR_EXPONENT, type=float,
+                        help="Growth exponent above which a phase is reported as super-linear.")
+    parser.add_argument("--output", default=os.path.join(BENCH_OUTPUT_DIR, "results.json"),
+                        help="JSON report path.")
+    parser.add_argument("--gen-only", action="store_true",
+                        help="Only generate the programs into " + BENCH_OUTPUT_DIR + ".")
+    args = parser.parse_args()
+
+    if not args.gen_only and not os.path.exists(SYSY):
+        print(f"Compiler not found: {SYSY} (run make first)")
+        sys.exit(1)
+    os.makedirs(BENCH_OUTPUT_DIR, exist_ok=True)
+
+    axes = [a for a in AXES if not args.axis or a.name in args.axis]
+    results: List[BenchResult] = []
+    analyses = []
+
+    for axis in axes:
+        points = []
+        for step in range(args.steps):
+            size = max(1, int(axis.base * args.scale)) << step
+            src = os.path.join(BENCH_OUTPUT_DIR, f"{axis.name}_{size}.sy")
+            with open(src, "w", encoding="utf-8") as f:
+                f.write(axis.generate(size))
+            if args.gen_only:
+                print(src)
+                continue
+
+            out = os.path.join(BENCH_OUTPUT_DIR, f"{axis.name}_{size}" + (".s" if args.stage == "asm" else ".ll"))
+            res = run_compiler(src, out, args)
+            res.axis, res.size = axis.name, size
+            points.append(res)
+            print(f"{axis.name:<12}{size:>8}  {res.status:<8}{res.wall_ms:>10.1f} ms{res.peak_rss_kb / 1024:>10.1f} MiB",
+                  flush=True)
+
+        if points:
+            results.extend(points)
+            report = analyse(axis.name, points, args.threshold)
+            analyses.append(report)
+            if report["superlinear"]:
+                detail = ", ".join(f"{n} (k={report['phase_exponents'][n]:.2f})" for n in report["superlinear"])
+                print(f"\033[93m  super-linear on {axis.name}: {detail}\033[0m")
+
+    if args.gen_only:
+        return
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        json.dump({
+            "compiler": SYSY,
+            "opt": args.opt,
+            "stage": args.stage,
+            "jobs": args.jobs,
+            "threshold": args.threshold,
+            "results": [asdict(r) for r in results],
+            "analysis": analyses,
+        }, f, indent=2)
+
+    print("\n" + "="*30)
+    for report in analyses:
+        k = report["wall_exponent"]
+        flag = "super-linear: " + ", ".join(report["superlinear"]) if report["superlinear"] else "ok"
+        print(f"\t{report['axis']:<12} k={k:.2f}  {flag}" if k is not None else f"\t{report['axis']:<12} n/a")
+    print(f"\tReport: {args.output}")
+    print("="*30)
+
+
+if __name__ == "__main__":
+    main()
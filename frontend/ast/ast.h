@@ -4,6 +4,7 @@
 #include <frontend/ast/ast_defs.h>
 #include <frontend/ast/ast_visitor.h>
 #include <frontend/symbol/symbol_entry.h>
+#include <arena.h>
 #include <vector>
 
 /*
@@ -19,6 +20,14 @@ namespace FE::AST
 
     using Entry = FE::Sym::Entry;
 
+    /*
+     * AST 节点与子节点列表都从语法分析器持有的 Arena 中分配：
+     *   new (arena) BinaryExpr(...)、arena.create<NodeList<ExprNode>>(ArenaAllocator<ExprNode*>(arena))
+     * 节点只含指针与平凡成员，不逐个析构，整棵树随 Arena 一次性释放（见 Parser::releaseAST）
+     */
+    template <typename T>
+    using NodeList = std::vector<T*, ArenaAllocator<T*>>;
+
     // AST的节点类
     class Node
     {
@@ -31,21 +40,25 @@ namespace FE::AST
         virtual ~Node() = default;
 
         virtual void accept(Visitor& visitor) = 0;
+
+        // 只能在 Arena 上创建；delete 不归还内存，内存随 Arena 释放
+        static void* operator new(size_t size, Arena& arena) { return arena.allocate(size); }
+        static void  operator delete(void*, Arena&) {}
+        static void  operator delete(void*) {}
     };
 
     // AST的根节点
     class Root : public Node
     {
       private:
-        std::vector<StmtNode*>* stmts;
+        NodeList<StmtNode>* stmts;
 
       public:
-        Root(std::vector<StmtNode*>* stmts) : Node(-1, -1), stmts(stmts) {}
-        virtual ~Root() override;
+        Root(NodeList<StmtNode>* stmts) : Node(-1, -1), stmts(stmts) {}
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
 
-        std::vector<StmtNode*>* getStmts() const { return stmts; }
+        NodeList<StmtNode>* getStmts() const { return stmts; }
     };
 }  // namespace FE::AST
 
@@ -42,7 +42,6 @@ namespace FE::AST
         Initializer(ExprNode* expr, int line_num = -1, int col_num = -1)
             : InitDecl(true, line_num, col_num), init_val(expr)
         {}
-        virtual ~Initializer() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -52,13 +51,12 @@ namespace FE::AST
     class InitializerList : public InitDecl
     {
       public:
-        std::vector<InitDecl*>* init_list;
+        NodeList<InitDecl>* init_list;
 
       public:
-        InitializerList(std::vector<InitDecl*>* init_list, int line_num = -1, int col_num = -1)
+        InitializerList(NodeList<InitDecl>* init_list, int line_num = -1, int col_num = -1)
             : InitDecl(false, line_num, col_num), init_list(init_list)
         {}
-        virtual ~InitializerList() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
 
@@ -76,7 +74,6 @@ namespace FE::AST
         VarDeclarator(ExprNode* lval, InitDecl* init = nullptr, int line_num = -1, int col_num = -1)
             : DeclNode(line_num, col_num), lval(lval), init(init)
         {}
-        virtual ~VarDeclarator() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -87,14 +84,13 @@ namespace FE::AST
       public:
         Type*                   type;
         Entry*                  entry;
-        std::vector<ExprNode*>* dims;
+        NodeList<ExprNode>* dims;
 
       public:
         ParamDeclarator(
-            Type* type, Entry* entry, std::vector<ExprNode*>* dims = nullptr, int line_num = -1, int col_num = -1)
+            Type* type, Entry* entry, NodeList<ExprNode>* dims = nullptr, int line_num = -1, int col_num = -1)
             : DeclNode(line_num, col_num), type(type), entry(entry), dims(dims)
         {}
-        virtual ~ParamDeclarator() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -106,15 +102,14 @@ namespace FE::AST
     {
       public:
         Type*                        type;
-        std::vector<VarDeclarator*>* decls;
+        NodeList<VarDeclarator>* decls;
         bool                         isConstDecl;
 
       public:
-        VarDeclaration(Type* type, std::vector<VarDeclarator*>* decls, bool isConstDecl = false, int line_num = -1,
+        VarDeclaration(Type* type, NodeList<VarDeclarator>* decls, bool isConstDecl = false, int line_num = -1,
             int col_num = -1)
             : DeclNode(line_num, col_num), type(type), decls(decls), isConstDecl(isConstDecl)
         {}
-        virtual ~VarDeclaration() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -11,13 +11,7 @@ namespace FE::AST
     class ExprNode : public Node
     {
       public:
-        size_t trueTar;
-        size_t falseTar;
-
-      public:
-        ExprNode(int line_num = -1, int col_num = -1)
-            : Node(line_num, col_num), trueTar(static_cast<size_t>(-1)), falseTar(static_cast<size_t>(-1))
-        {}
+        ExprNode(int line_num = -1, int col_num = -1) : Node(line_num, col_num) {}
         virtual ~ExprNode() override = default;
 
         virtual void accept(Visitor& visitor) override = 0;
@@ -33,13 +27,12 @@ namespace FE::AST
       public:
         bool                    isLval;
         Entry*                  entry;
-        std::vector<ExprNode*>* indices;
+        NodeList<ExprNode>* indices;
 
       public:
-        LeftValExpr(Entry* entry, std::vector<ExprNode*>* indices = nullptr, int line_num = -1, int col_num = -1)
+        LeftValExpr(Entry* entry, NodeList<ExprNode>* indices = nullptr, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), entry(entry), indices(indices)
         {}
-        virtual ~LeftValExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -72,7 +65,6 @@ namespace FE::AST
         UnaryExpr(Operator op, ExprNode* expr, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), op(op), expr(expr)
         {}
-        virtual ~UnaryExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -89,7 +81,6 @@ namespace FE::AST
         BinaryExpr(Operator op, ExprNode* lhs, ExprNode* rhs, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), op(op), lhs(lhs), rhs(rhs)
         {}
-        virtual ~BinaryExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -99,13 +90,12 @@ namespace FE::AST
     {
       public:
         Entry*                  func;
-        std::vector<ExprNode*>* args;
+        NodeList<ExprNode>* args;
 
       public:
-        CallExpr(Entry* func, std::vector<ExprNode*>* args = nullptr, int line_num = -1, int col_num = -1)
+        CallExpr(Entry* func, NodeList<ExprNode>* args = nullptr, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), func(func), args(args)
         {}
-        virtual ~CallExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
     };
@@ -115,13 +105,12 @@ namespace FE::AST
     class CommaExpr : public ExprNode
     {
       public:
-        std::vector<ExprNode*>* exprs;
+        NodeList<ExprNode>* exprs;
 
       public:
-        CommaExpr(std::vector<ExprNode*>* exprs, int line_num = -1, int col_num = -1)
+        CommaExpr(NodeList<ExprNode>* exprs, int line_num = -1, int col_num = -1)
             : ExprNode(line_num, col_num), exprs(exprs)
         {}
-        virtual ~CommaExpr() override;
 
         virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
 
@@ -20,6 +20,8 @@ namespace FE::AST
             errors.push_back("No main function defined.");
             res = false;
         }
+        // 全局变量属性交给代码生成使用，直接从符号表移出而不复制
+        symTable.releaseGlobals(glbSymbols);
         //symTable.exitScope();
         return res;
     }
@@ -33,6 +35,10 @@ namespace FE::AST
         //      _sysy_starttime, _sysy_stoptime
         using SymEnt = FE::Sym::Entry;
 
+        auto newParamList = [this]() {
+            return libArena.create<NodeList<ParamDeclarator>>(ArenaAllocator<ParamDeclarator*>(libArena));
+        };
+
         // int getint(), getch(), getarray(int a[]);
         static SymEnt* getint   = SymEnt::getEntry("getint");
         static SymEnt* getch    = SymEnt::getEntry("getch");
@@ -60,97 +66,97 @@ namespace FE::AST
         static SymEnt* _sysy_stoptime  = SymEnt::getEntry("_sysy_stoptime");
 
         // int getint()
-        funcDecls[getint] = new FuncDeclStmt(intType, getint, nullptr);
+        funcDecls[getint] = new (libArena) FuncDeclStmt(intType, getint, nullptr);
 
         // int getch()
-        funcDecls[getch] = new FuncDeclStmt(intType, getch, nullptr);
+        funcDecls[getch] = new (libArena) FuncDeclStmt(intType, getch, nullptr);
 
         // int getarray(int a[])
-        auto getarray_params = new std::vector<ParamDeclarator*>();
+        auto getarray_params = newParamList();
        // 1. 构造参数改回 intType
-        auto getarray_param  = new ParamDeclarator(intType, SymEnt::getEntry("a"));
+        auto getarray_param  = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("a"));
        // 2. 新增：显式设置 type 为指针
         getarray_param->type = TypeFactory::getPtrType(intType);
        // 3. attr 设置保持不变
         getarray_param->attr.val.value.type = TypeFactory::getPtrType(intType);
         getarray_params->push_back(getarray_param);
-        funcDecls[getarray] = new FuncDeclStmt(intType, getarray, getarray_params);
+        funcDecls[getarray] = new (libArena) FuncDeclStmt(intType, getarray, getarray_params);
 
         // float getfloat()
-        funcDecls[getfloat] = new FuncDeclStmt(floatType, getfloat, nullptr);
+        funcDecls[getfloat] = new (libArena) FuncDeclStmt(floatType, getfloat, nullptr);
 
         // int getfarray(float a[])
-        auto getfarray_params = new std::vector<ParamDeclarator*>();
+        auto getfarray_params = newParamList();
        // 1. 构造参数改回 floatType
-        auto getfarray_param  = new ParamDeclarator(floatType, SymEnt::getEntry("a"));
+        auto getfarray_param  = new (libArena) ParamDeclarator(floatType, SymEnt::getEntry("a"));
        // 2. 新增：显式设置 type 为指针
         getfarray_param->type = TypeFactory::getPtrType(floatType);
        // 3. attr 设置保持不变
         getfarray_param->attr.val.value.type = TypeFactory::getPtrType(floatType);
         getfarray_params->push_back(getfarray_param);
-        funcDecls[getfarray] = new FuncDeclStmt(intType, getfarray, getfarray_params);
+        funcDecls[getfarray] = new (libArena) FuncDeclStmt(intType, getfarray, getfarray_params);
 
         // void putint(int a)
-        auto putint_params                = new std::vector<ParamDeclarator*>();
-        auto putint_param                 = new ParamDeclarator(intType, SymEnt::getEntry("a"));
+        auto putint_params                = newParamList();
+        auto putint_param                 = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("a"));
         putint_param->attr.val.value.type = intType;
         putint_params->push_back(putint_param);
-        funcDecls[putint] = new FuncDeclStmt(voidType, putint, putint_params);
+        funcDecls[putint] = new (libArena) FuncDeclStmt(voidType, putint, putint_params);
 
         // void putch(int a)
-        auto putch_params                = new std::vector<ParamDeclarator*>();
-        auto putch_param                 = new ParamDeclarator(intType, SymEnt::getEntry("a"));
+        auto putch_params                = newParamList();
+        auto putch_param                 = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("a"));
         putch_param->attr.val.value.type = intType;
         putch_params->push_back(putch_param);
-        funcDecls[putch] = new FuncDeclStmt(voidType, putch, putch_params);
+        funcDecls[putch] = new (libArena) FuncDeclStmt(voidType, putch, putch_params);
 
         // void putarray(int n, int a[])
-        auto putarray_params                 = new std::vector<ParamDeclarator*>();
-        auto putarray_param1                 = new ParamDeclarator(intType, SymEnt::getEntry("n"));
+        auto putarray_params                 = newParamList();
+        auto putarray_param1                 = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("n"));
         putarray_param1->attr.val.value.type = intType;
         // 1. 构造参数改回 intType
-        auto putarray_param2 = new ParamDeclarator(intType, SymEnt::getEntry("a"));
+        auto putarray_param2 = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("a"));
         // 2. 新增：显式设置 type 为指针
         putarray_param2->type = TypeFactory::getPtrType(intType);
         // 3. attr 设置保持不变
         putarray_param2->attr.val.value.type = TypeFactory::getPtrType(intType);
         putarray_params->push_back(putarray_param1);
         putarray_params->push_back(putarray_param2);
-        funcDecls[putarray] = new FuncDeclStmt(voidType, putarray, putarray_params);
+        funcDecls[putarray] = new (libArena) FuncDeclStmt(voidType, putarray, putarray_params);
 
         // void putfloat(float a)
-        auto putfloat_params                = new std::vector<ParamDeclarator*>();
-        auto putfloat_param                 = new ParamDeclarator(floatType, SymEnt::getEntry("a"));
+        auto putfloat_params                = newParamList();
+        auto putfloat_param                 = new (libArena) ParamDeclarator(floatType, SymEnt::getEntry("a"));
         putfloat_param->attr.val.value.type = floatType;
         putfloat_params->push_back(putfloat_param);
-        funcDecls[putfloat] = new FuncDeclStmt(voidType, putfloat, putfloat_params);
+        funcDecls[putfloat] = new (libArena) FuncDeclStmt(voidType, putfloat, putfloat_params);
 
         // void putfarray(int n, float a[])
-        auto putfarray_params                 = new std::vector<ParamDeclarator*>();
-        auto putfarray_param1                 = new ParamDeclarator(intType, SymEnt::getEntry("n"));
+        auto putfarray_params                 = newParamList();
+        auto putfarray_param1                 = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("n"));
         putfarray_param1->attr.val.value.type = intType;
         // 1. 构造参数改回 floatType
-        auto putfarray_param2 = new ParamDeclarator(floatType, SymEnt::getEntry("a"));
+        auto putfarray_param2 = new (libArena) ParamDeclarator(floatType, SymEnt::getEntry("a"));
         // 2. 新增：显式设置 type 为指针
         putfarray_param2->type = TypeFactory::getPtrType(floatType);
         // 3. attr 设置保持不变
         putfarray_param2->attr.val.value.type = TypeFactory::getPtrType(floatType);
         putfarray_params->push_back(putfarray_param1);
         putfarray_params->push_back(putfarray_param2);
-        funcDecls[putfarray] = new FuncDeclStmt(voidType, putfarray, putfarray_params);
+        funcDecls[putfarray] = new (libArena) FuncDeclStmt(voidType, putfarray, putfarray_params);
 
         // void _sysy_starttime(int lineno)
-        auto starttime_params                = new std::vector<ParamDeclarator*>();
-        auto starttime_param                 = new ParamDeclarator(intType, SymEnt::getEntry("lineno"));
+        auto starttime_params                = newParamList();
+        auto starttime_param                 = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("lineno"));
         starttime_param->attr.val.value.type = intType;
         starttime_params->push_back(starttime_param);
-        funcDecls[_sysy_starttime] = new FuncDeclStmt(voidType, _sysy_starttime, starttime_params);
+        funcDecls[_sysy_starttime] = new (libArena) FuncDeclStmt(voidType, _sysy_starttime, starttime_params);
 
         // void _sysy_stoptime(int lineno)
-        auto stoptime_params                = new std::vector<ParamDeclarator*>();
-        auto stoptime_param                 = new ParamDeclarator(intType, SymEnt::getEntry("lineno"));
+        auto stoptime_params                = newParamList();
+        auto stoptime_param                 = new (libArena) ParamDeclarator(intType, SymEnt::getEntry("lineno"));
         stoptime_param->attr.val.value.type = intType;
         stoptime_params->push_back(stoptime_param);
-        funcDecls[_sysy_stoptime] = new FuncDeclStmt(voidType, _sysy_stoptime, stoptime_params);
+        funcDecls[_sysy_stoptime] = new (libArena) FuncDeclStmt(voidType, _sysy_stoptime, stoptime_params);
     }
 }  // namespace FE::AST
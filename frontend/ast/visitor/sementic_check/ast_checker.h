@@ -42,6 +42,7 @@ namespace FE::AST
         FE::Sym::SymTable                        symTable;
         std::map<FE::Sym::Entry*, VarAttr>       glbSymbols;
         std::map<FE::Sym::Entry*, FuncDeclStmt*> funcDecls;
+        Arena                                    libArena;  // 库函数声明节点不属于语法树，单独分配
 
         bool mainExists;
 
@@ -59,6 +60,7 @@ namespace FE::AST
             : symTable(),
               glbSymbols(),
               funcDecls(),
+              libArena(),
               mainExists(false),
               funcHasReturn(false),
               curFuncRetType(voidType),
@@ -70,28 +72,7 @@ namespace FE::AST
             libFuncRegister();
         }
 
-        ~ASTChecker()
-        {
-            const char* libFuncNames[] = {"getint",
-                "getch",
-                "getarray",
-                "getfloat",
-                "getfarray",
-                "putint",
-                "putch",
-                "putarray",
-                "putfloat",
-                "putfarray",
-                "_sysy_starttime",
-                "_sysy_stoptime"};
-
-            for (const char* name : libFuncNames)
-            {
-                FE::Sym::Entry* entry = FE::Sym::Entry::getEntry(name);
-                auto            it    = funcDecls.find(entry);
-                if (it != funcDecls.end()) delete it->second;
-            }
-        }
+        ~ASTChecker() = default;
 
       public:
         const std::map<FE::Sym::Entry*, VarAttr>&       getGlbSymbols() const { return glbSymbols; }
@@ -133,13 +114,13 @@ namespace FE::AST
         void libFuncRegister();
 
       private:
+        // 数组初始化：按行优先展开到稀疏列表中，只记录非零元素，cursor 为下一个待填元素的下标
         size_t   calcArraySize(const std::vector<int>& dims) const;
         size_t   calcSubarrayStride(const std::vector<int>& dims, size_t level) const;
-        bool     assignScalarInitializer(Type* baseType, Initializer* init, std::vector<VarValue>& buffer, size_t& cursor,
+        bool     assignScalarInitializer(Type* baseType, Initializer* init, SparseInitList& list, size_t& cursor,
                 const std::string& name);
         bool     assignArrayInitializer(Type* baseType, InitDecl* node, const std::vector<int>& dims, size_t level,
-                std::vector<VarValue>& buffer, size_t& cursor, const std::string& name, size_t blockStart);
-        VarValue makeZeroValue(Type* type) const;
+                SparseInitList& list, size_t& cursor, const std::string& name, size_t blockStart);
         VarValue convertConstValue(const ExprValue& expr, Type* targetType) const;
 
         // 这两个辅助函数用于对一元/二元表达式做类型推断与常量折叠（若可能）
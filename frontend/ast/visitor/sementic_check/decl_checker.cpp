@@ -57,7 +57,7 @@ namespace FE::AST
         attr.type       = node.type;
         attr.scopeLevel = symTable.getScopeDepth();
 
-        if (!redef) symTable.addSymbol(node.entry, attr);
+        if (!redef) symTable.addSymbol(node.entry, std::move(attr));
         return res;
     }
 
@@ -66,6 +66,8 @@ namespace FE::AST
         bool res = true;
 
         if (!node.decls) return true;
+        curDeclType    = node.type;
+        curDeclIsConst = node.isConstDecl;
 
         for (auto* decl : *(node.decls))
         {
@@ -101,7 +103,39 @@ namespace FE::AST
             FE::AST::VarAttr attr(node.type, node.isConstDecl, symTable.getScopeDepth());
             if (!attr.type) { ERROR("1"); }
 
-            if (decl->init)
+            if (lval->indices)
+            {
+                for (auto* idx : *lval->indices)
+                {
+                    if (!idx) continue;
+                    res &= apply(*this, *idx);
+                    if (!idx->attr.val.isConstexpr || idx->attr.val.getInt() <= 0)
+                    {
+                        errors.push_back("Array dimension of '" + entry->getName() +
+                            "' must be a positive constant at line " + std::to_string(decl->line_num));
+                        res = false;
+                        break;
+                    }
+                    attr.arrayDims.push_back(idx->attr.val.getInt());
+                }
+            }
+
+            if (decl->init && !attr.arrayDims.empty())
+            {
+                if (dynamic_cast<Initializer*>(decl->init))
+                {
+                    errors.push_back("Array '" + entry->getName() + "' must be initialized with an initializer list at line " +
+                        std::to_string(decl->line_num));
+                    res = false;
+                }
+                else if (attr.arrayDims.size() == lval->indices->size())
+                {
+                    size_t cursor = 0;
+                    res &= assignArrayInitializer(
+                        attr.type, decl->init, attr.arrayDims, 0, attr.initList, cursor, entry->getName(), 0);
+                }
+            }
+            else if (decl->init)
             {
                 if (auto* single = dynamic_cast<Initializer*>(decl->init))
                 {
@@ -119,10 +153,92 @@ namespace FE::AST
                 }
             }
 
-            symTable.addSymbol(entry, attr);
-            if (symTable.isGlobalScope()) glbSymbols[entry] = attr;
+            symTable.addSymbol(entry, std::move(attr));
         }
 
         return res;
     }
+
+    size_t ASTChecker::calcArraySize(const std::vector<int>& dims) const
+    {
+        size_t size = 1;
+        for (int d : dims) size *= static_cast<size_t>(d);
+        return size;
+    }
+
+    size_t ASTChecker::calcSubarrayStride(const std::vector<int>& dims, size_t level) const
+    {
+        // 第 level 维上每个元素（即去掉前 level + 1 维后的子数组）包含的标量个数
+        size_t stride = 1;
+        for (size_t i = level + 1; i < dims.size(); ++i) stride *= static_cast<size_t>(dims[i]);
+        return stride;
+    }
+
+    VarValue ASTChecker::convertConstValue(const ExprValue& expr, Type* targetType) const
+    {
+        if (targetType == floatType) return VarValue(expr.getFloat());
+        return VarValue(expr.getInt());
+    }
+
+    bool ASTChecker::assignScalarInitializer(
+        Type* baseType, Initializer* init, SparseInitList& list, size_t& cursor, const std::string& name)
+    {
+        size_t idx = cursor++;
+        if (!init->init_val) return true;
+
+        const ExprValue& val = init->init_val->attr.val;
+        if (!val.isConstexpr)
+        {
+            // 非 const 的局部数组允许运行期初始值，此处不记录
+            if (!curDeclIsConst && !symTable.isGlobalScope()) return true;
+            errors.push_back("Initializer of array '" + name + "' is not a compile-time constant at line " +
+                std::to_string(init->line_num));
+            return false;
+        }
+
+        VarValue v = convertConstValue(val, baseType);
+        if (!SparseInitList::isZero(v)) list.set(idx, v);
+        return true;
+    }
+
+    bool ASTChecker::assignArrayInitializer(Type* baseType, InitDecl* node, const std::vector<int>& dims, size_t level,
+        SparseInitList& list, size_t& cursor, const std::string& name, size_t blockStart)
+    {
+        // node 是从第 level 维开始的子数组 [blockStart, blockStart + span) 的初始化列表
+        auto* initList = dynamic_cast<InitializerList*>(node);
+        if (!initList || !initList->init_list) return true;
+
+        size_t span = level == 0 ? calcArraySize(dims) : calcSubarrayStride(dims, level - 1);
+        bool   res  = true;
+        for (auto* item : *initList->init_list)
+        {
+            if (!item) continue;
+            if (cursor >= blockStart + span)
+            {
+                errors.push_back("Excess elements in initializer of array '" + name + "' at line " +
+                    std::to_string(item->line_num));
+                return false;
+            }
+
+            if (auto* single = dynamic_cast<Initializer*>(item))
+            {
+                res &= assignScalarInitializer(baseType, single, list, cursor, name);
+                continue;
+            }
+
+            // 嵌套的 {...} 初始化从 cursor 处对齐的最大子数组
+            size_t sub = level + 1;
+            while (sub < dims.size() && cursor % calcSubarrayStride(dims, sub - 1) != 0) ++sub;
+            if (sub >= dims.size())
+            {
+                errors.push_back("Braces around scalar initializer of array '" + name + "' at line " +
+                    std::to_string(item->line_num));
+                return false;
+            }
+            size_t subStart = cursor;
+            res &= assignArrayInitializer(baseType, item, dims, sub, list, cursor, name, subStart);
+            cursor = subStart + calcSubarrayStride(dims, sub - 1);
+        }
+        return res;
+    }
 }  // namespace FE::AST
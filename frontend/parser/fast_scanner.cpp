@@ -0,0 +1,441 @@
+#include <frontend/parser/fast_scanner.h>
+#include <frontend/parser/parser.h>
+#include <debug.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+// lexer.l 中的数值转换函数，两个扫描器共用
+long long convertToInt(const char* str, const char end, bool& isLongLong);
+float     convertToFloatHex(const char* str);
+
+namespace FE
+{
+    using token = YaccParser::token;
+
+    namespace
+    {
+        constexpr int tabWidth = 4;  // 与 lexer.l 的 TAB_WIDTH 一致
+
+        enum : uint8_t
+        {
+            C_SPACE   = 1 << 0,  // ' ' \f \r \v，不含 \t 与 \n
+            C_IDSTART = 1 << 1,
+            C_DIGIT   = 1 << 2,
+            C_HEX     = 1 << 3,
+            C_OCT     = 1 << 4,
+            C_IDCONT  = C_IDSTART | C_DIGIT,
+        };
+
+        constexpr std::array<uint8_t, 256> makeCharClass()
+        {
+            std::array<uint8_t, 256> t{};
+            t[' '] = t['\f'] = t['\r'] = t['\v'] = C_SPACE;
+            for (int c = 'a'; c <= 'z'; ++c) t[c] |= C_IDSTART;
+            for (int c = 'A'; c <= 'Z'; ++c) t[c] |= C_IDSTART;
+            t['_'] |= C_IDSTART;
+            for (int c = '0'; c <= '9'; ++c) t[c] |= C_DIGIT | C_HEX;
+            for (int c = '0'; c <= '7'; ++c) t[c] |= C_OCT;
+            for (int c = 'a'; c <= 'f'; ++c) t[c] |= C_HEX;
+            for (int c = 'A'; c <= 'F'; ++c) t[c] |= C_HEX;
+            return t;
+        }
+        constexpr std::array<uint8_t, 256> charClass = makeCharClass();
+
+        bool is(char c, uint8_t mask) { return charClass[static_cast<unsigned char>(c)] & mask; }
+
+        struct Keyword
+        {
+            std::string_view            text;
+            YaccParser::token_kind_type token;
+        };
+        constexpr Keyword keywords[] = {
+            {"int", token::TOKEN_INT},
+            {"void", token::TOKEN_VOID},
+            {"float", token::TOKEN_FLOAT},
+            {"double", token::TOKEN_DOUBLE},
+            {"char", token::TOKEN_CHAR},
+            {"const", token::TOKEN_CONST},
+            {"if", token::TOKEN_IF},
+            {"else", token::TOKEN_ELSE},
+            {"for", token::TOKEN_FOR},
+            {"while", token::TOKEN_WHILE},
+            {"continue", token::TOKEN_CONTINUE},
+            {"break", token::TOKEN_BREAK},
+            {"switch", token::TOKEN_SWITCH},
+            {"case", token::TOKEN_CASE},
+            {"goto", token::TOKEN_GOTO},
+            {"do", token::TOKEN_DO},
+            {"return", token::TOKEN_RETURN},
+        };
+
+        // 数值转换函数需要以 '\0' 结尾的字符串，短词素在栈上拷贝
+        template <typename F>
+        auto withCString(std::string_view s, F&& f)
+        {
+            char buf[64];
+            if (s.size() < sizeof(buf))
+            {
+                std::memcpy(buf, s.data(), s.size());
+                buf[s.size()] = '\0';
+                return f(static_cast<const char*>(buf));
+            }
+            std::string tmp(s);
+            return f(tmp.c_str());
+        }
+    }  // namespace
+
+    void FastScanner::reset(std::string_view source)
+    {
+        ASSERT(source.size() <= std::numeric_limits<uint32_t>::max() && "Source file too large for the scanner");
+        src = source;
+        pos = 0;
+        loc = location();
+    }
+
+    size_t FastScanner::skip(size_t i, uint8_t mask) const
+    {
+        const char* s = src.data();
+        size_t      n = src.size();
+        while (i < n && is(s[i], mask)) ++i;
+        return i;
+    }
+
+    void FastScanner::advance(size_t len)
+    {
+        loc.step();
+        loc.columns(static_cast<int>(len));
+        pos += len;
+    }
+
+    FastScanner::Lexeme FastScanner::make(YaccParser::token_kind_type tok, size_t start)
+    {
+        // 调用前 pos 已指向词素末尾
+        size_t len = pos - start;
+        pos        = start;
+        advance(len);
+        Lexeme lx;
+        lx.token  = tok;
+        lx.offset = static_cast<uint32_t>(start);
+        lx.length = static_cast<uint32_t>(len);
+        lx.loc    = loc;
+        lx.lval   = 0;
+        return lx;
+    }
+
+    FastScanner::Lexeme FastScanner::scan()
+    {
+        const size_t n = src.size();
+        while (pos < n)
+        {
+            const size_t start = pos;
+            const char   c     = src[pos];
+
+            if (c == '\n')
+            {
+                advance(1);
+                loc.lines(1);
+                loc.step();
+                continue;
+            }
+            if (is(c, C_SPACE))
+            {
+                advance(skip(pos + 1, C_SPACE) - start);
+                continue;
+            }
+            if (c == '\t')
+            {
+                advance(1);
+                loc.columns(tabWidth - ((loc.begin.column - 1) % tabWidth) - 1);
+                continue;
+            }
+
+            if (is(c, C_IDSTART))
+            {
+                pos                = skip(pos + 1, C_IDCONT);
+                std::string_view w = src.substr(start, pos - start);
+                for (auto& kw : keywords)
+                    if (kw.text == w) return make(kw.token, start);
+                return make(token::TOKEN_IDENT, start);
+            }
+            if (is(c, C_DIGIT) || (c == '.' && is(at(pos + 1), C_DIGIT))) return scanNumber(start);
+
+            switch (c)
+            {
+                case ';': ++pos; return make(token::TOKEN_SEMICOLON, start);
+                case ',': ++pos; return make(token::TOKEN_COMMA, start);
+                case '(': ++pos; return make(token::TOKEN_LPAREN, start);
+                case ')': ++pos; return make(token::TOKEN_RPAREN, start);
+                case '[': ++pos; return make(token::TOKEN_LBRACKET, start);
+                case ']': ++pos; return make(token::TOKEN_RBRACKET, start);
+                case '{': ++pos; return make(token::TOKEN_LBRACE, start);
+                case '}': ++pos; return make(token::TOKEN_RBRACE, start);
+                case '"': return scanString(start);
+                case '/':
+                    if (at(pos + 1) == '/')
+                    {
+                        // 行注释到换行为止，不含换行
+                        const void* nl  = std::memchr(src.data() + pos, '\n', n - pos);
+                        size_t      end = nl ? static_cast<size_t>(static_cast<const char*>(nl) - src.data()) : n;
+                        advance(end - start);
+                        continue;
+                    }
+                    if (at(pos + 1) == '*')
+                    {
+                        size_t close = src.find("*/", pos + 2);
+                        if (close != std::string_view::npos)
+                        {
+                            // 与 lexer.l 相同：列号按整段注释推进后，再按其中的换行数换行
+                            size_t len = close + 2 - start;
+                            advance(len);
+                            auto lines = std::count(src.data() + start, src.data() + start + len, '\n');
+                            loc.lines(static_cast<int>(lines));
+                            loc.step();
+                            continue;
+                        }
+                    }
+                    pos += at(pos + 1) == '=' ? 2 : 1;
+                    return make(pos - start == 2 ? token::TOKEN_DIV_ASSIGN : token::TOKEN_DIV, start);
+                case '+':
+                case '-':
+                case '*':
+                case '%':
+                {
+                    bool assign = at(pos + 1) == '=';
+                    pos += assign ? 2 : 1;
+                    if (c == '+') return make(assign ? token::TOKEN_ADD_ASSIGN : token::TOKEN_PLUS, start);
+                    if (c == '-') return make(assign ? token::TOKEN_SUB_ASSIGN : token::TOKEN_MINUS, start);
+                    if (c == '*') return make(assign ? token::TOKEN_MUL_ASSIGN : token::TOKEN_MUL, start);
+                    return make(assign ? token::TOKEN_MOD_ASSIGN : token::TOKEN_MOD, start);
+                }
+                case '=':
+                case '!':
+                case '<':
+                case '>':
+                {
+                    bool eq = at(pos + 1) == '=';
+                    pos += eq ? 2 : 1;
+                    if (c == '=') return make(eq ? token::TOKEN_EQ : token::TOKEN_ASSIGN, start);
+                    if (c == '!') return make(eq ? token::TOKEN_NEQ : token::TOKEN_NOT, start);
+                    if (c == '<') return make(eq ? token::TOKEN_LE : token::TOKEN_LT, start);
+                    return make(eq ? token::TOKEN_GE : token::TOKEN_GT, start);
+                }
+                case '&':
+                case '|':
+                    if (at(pos + 1) == c)
+                    {
+                        pos += 2;
+                        return make(c == '&' ? token::TOKEN_AND : token::TOKEN_OR, start);
+                    }
+                    break;
+                default: break;
+            }
+
+            // 其余任意单个字节都是错误 token
+            ++pos;
+            return make(token::TOKEN_ERR_TOKEN, start);
+        }
+
+        // 与 Flex 的 <<EOF>> 一致：不再推进位置
+        Lexeme lx;
+        lx.token  = token::TOKEN_END;
+        lx.offset = static_cast<uint32_t>(pos);
+        lx.length = 0;
+        lx.loc    = loc;
+        lx.lval   = 0;
+        return lx;
+    }
+
+    FastScanner::Lexeme FastScanner::scanString(size_t start)
+    {
+        // \"([^\"\\]|\\.)*\"：'.' 不匹配换行；找不到结尾的引号时，引号本身作为错误 token
+        const size_t n = src.size();
+        size_t       i = start + 1;
+        while (i < n)
+        {
+            char ch = src[i];
+            if (ch == '"')
+            {
+                pos = i + 1;
+                return make(token::TOKEN_STR_CONST, start);
+            }
+            if (ch == '\\')
+            {
+                if (i + 1 >= n || src[i + 1] == '\n') break;
+                i += 2;
+                continue;
+            }
+            ++i;
+        }
+        pos = start + 1;
+        return make(token::TOKEN_ERR_TOKEN, start);
+    }
+
+    size_t FastScanner::matchHexFloat(size_t start) const
+    {
+        // 0[xX]([0-9a-fA-F]+(\.[0-9a-fA-F]*)?|\.[0-9a-fA-F]+)[pP][-+]?[0-9]+
+        if (at(start) != '0' || (at(start + 1) | 0x20) != 'x') return 0;
+        size_t i = start + 2;
+        size_t h = skip(i, C_HEX);
+        if (h > i)
+        {
+            i = h;
+            if (at(i) == '.') i = skip(i + 1, C_HEX);
+        }
+        else
+        {
+            if (at(i) != '.') return 0;
+            h = skip(i + 1, C_HEX);
+            if (h == i + 1) return 0;
+            i = h;
+        }
+        if ((at(i) | 0x20) != 'p') return 0;
+        ++i;
+        if (at(i) == '+' || at(i) == '-') ++i;
+        size_t d = skip(i, C_DIGIT);
+        return d > i ? d - start : 0;
+    }
+
+    size_t FastScanner::matchHexInt(size_t start) const
+    {
+        // 0[xX][0-9A-Fa-f]+
+        if (at(start) != '0' || (at(start + 1) | 0x20) != 'x') return 0;
+        size_t h = skip(start + 2, C_HEX);
+        return h > start + 2 ? h - start : 0;
+    }
+
+    size_t FastScanner::matchDecFloat(size_t start) const
+    {
+        // ([0-9]+\.[0-9]*|\.[0-9]+|[0-9]+)([eE][+-]?[0-9]+)?
+        size_t i = start;
+        size_t d = skip(i, C_DIGIT);
+        if (d > i)
+        {
+            i = d;
+            if (at(i) == '.') i = skip(i + 1, C_DIGIT);
+        }
+        else
+        {
+            if (at(i) != '.') return 0;
+            d = skip(i + 1, C_DIGIT);
+            if (d == i + 1) return 0;
+            i = d;
+        }
+        if ((at(i) | 0x20) == 'e')
+        {
+            size_t j = i + 1;
+            if (at(j) == '+' || at(j) == '-') ++j;
+            size_t e = skip(j, C_DIGIT);
+            if (e > j) i = e;
+        }
+        return i - start;
+    }
+
+    FastScanner::Lexeme FastScanner::scanNumber(size_t start)
+    {
+        // lexer.l 中的数字规则按顺序为：0、十进制、八进制、十六进制浮点、十六进制整数、十进制浮点，
+        // 取最长匹配，等长时取靠前的规则（如 "0128" 按浮点数 128.0 处理，"0123" 按八进制处理）
+        enum Rule
+        {
+            R_ZERO,
+            R_DEC,
+            R_OCT,
+            R_HEX_FLOAT,
+            R_HEX_INT,
+            R_DEC_FLOAT,
+            R_COUNT
+        };
+        size_t len[R_COUNT] = {};
+        char   c            = at(start);
+        len[R_ZERO]         = c == '0' ? 1 : 0;
+        len[R_DEC]          = c >= '1' && c <= '9' ? skip(start + 1, C_DIGIT) - start : 0;
+        len[R_OCT]          = c == '0' && is(at(start + 1), C_OCT) ? skip(start + 1, C_OCT) - start : 0;
+        len[R_HEX_FLOAT]    = matchHexFloat(start);
+        len[R_HEX_INT]      = matchHexInt(start);
+        len[R_DEC_FLOAT]    = matchDecFloat(start);
+
+        int rule = R_ZERO;
+        for (int r = R_DEC; r < R_COUNT; ++r)
+            if (len[r] > len[rule]) rule = r;
+
+        pos                   = start + len[rule];
+        Lexeme           lx   = make(token::TOKEN_INT_CONST, start);
+        std::string_view text = src.substr(start, len[rule]);
+
+        auto errorToken = [&](const std::string& msg) {
+            _parser.reportError(loc, msg);
+            lx.token = token::TOKEN_ERR_TOKEN;
+            lx.lval  = 0;
+        };
+        auto intToken = [&](const char* what, bool decimal) {
+            try
+            {
+                bool      isLL   = false;
+                long long result = withCString(text, [&](const char* s) { return convertToInt(s, '\0', isLL); });
+                if (isLL || (decimal && (result > std::numeric_limits<int>::max() ||
+                                            result < std::numeric_limits<int>::min())))
+                {
+                    lx.token = token::TOKEN_LL_CONST;
+                    lx.lval  = result;
+                }
+                else
+                    lx.ival = static_cast<int>(result);
+            }
+            catch (const std::exception& e)
+            {
+                errorToken(std::string("Error parsing ") + what + ": " + e.what());
+            }
+        };
+
+        switch (rule)
+        {
+            case R_ZERO: lx.ival = 0; break;
+            case R_DEC: intToken("decimal int", true); break;
+            case R_OCT: intToken("octal int", false); break;
+            case R_HEX_INT: intToken("hexadecimal int", false); break;
+            case R_HEX_FLOAT:
+                try
+                {
+                    lx.dval  = withCString(text, [](const char* s) { return convertToFloatHex(s); });
+                    lx.token = token::TOKEN_FLOAT_CONST;
+                }
+                catch (const std::exception& e)
+                {
+                    errorToken(std::string("Error parsing hex float: ") + e.what());
+                }
+                break;
+            case R_DEC_FLOAT:
+                try
+                {
+                    lx.dval  = withCString(text, [](const char* s) { return std::stod(s); });
+                    lx.token = token::TOKEN_FLOAT_CONST;
+                }
+                catch (const std::exception& e)
+                {
+                    errorToken(std::string("Error parsing float: ") + e.what());
+                }
+                break;
+            default: ERROR("Unknown number rule");
+        }
+        return lx;
+    }
+
+    YaccParser::symbol_type FastScanner::nextToken()
+    {
+        Lexeme lx = scan();
+        switch (lx.token)
+        {
+            case token::TOKEN_INT_CONST: return YaccParser::make_INT_CONST(lx.ival, lx.loc);
+            case token::TOKEN_LL_CONST: return YaccParser::make_LL_CONST(lx.lval, lx.loc);
+            case token::TOKEN_FLOAT_CONST: return YaccParser::make_FLOAT_CONST(lx.dval, lx.loc);
+            case token::TOKEN_IDENT: return YaccParser::make_IDENT(std::string(text(lx)), lx.loc);
+            case token::TOKEN_STR_CONST:
+                return YaccParser::make_STR_CONST(std::string(text(lx).substr(1, lx.length - 2)), lx.loc);
+            case token::TOKEN_ERR_TOKEN: return YaccParser::make_ERR_TOKEN(std::string(text(lx)), lx.loc);
+            default: return YaccParser::symbol_type(lx.token, lx.loc);
+        }
+    }
+}  // namespace FE
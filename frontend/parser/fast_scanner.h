@@ -0,0 +1,74 @@
+#ifndef __FRONTEND_PARSER_FAST_SCANNER_H__
+#define __FRONTEND_PARSER_FAST_SCANNER_H__
+
+#include <frontend/parser/yacc.h>
+#include <frontend/parser/location.hh>
+#include <cstdint>
+#include <string_view>
+
+namespace FE
+{
+    class Parser;
+
+    /*
+     * 直接在内存中的源文件上扫描的手写词法分析器，逐条规则与 lexer.l 等价：
+     * 最长匹配、等长时取 lexer.l 中靠前的规则，位置信息的推进方式（含制表符与块注释）也相同
+     *
+     * - 词素是源缓冲区上的 [offset, offset + length)，扫描过程中不复制
+     * - 字符按 256 项的分类表判断，空白、标识符、数字用表驱动的循环整段跳过；
+     *   行注释与块注释的结尾用 memchr / find 查找（libc 中为向量化实现）
+     * - scan() 给出不构造语义值的原始结果，-lexer 直接据此填 TokenList；
+     *   nextToken() 再包装成语法分析器使用的 symbol_type
+     */
+    class FastScanner
+    {
+      public:
+        struct Lexeme
+        {
+            YaccParser::token_kind_type token;
+            uint32_t                    offset;
+            uint32_t                    length;
+            location                    loc;
+            union
+            {
+                int       ival;
+                long long lval;
+                double    dval;
+            };
+        };
+
+      private:
+        Parser&          _parser;
+        std::string_view src;
+        size_t           pos;
+        location         loc;
+
+      public:
+        explicit FastScanner(Parser& parser) : _parser(parser), src(), pos(0), loc() {}
+
+        void             reset(std::string_view source);
+        std::string_view source() const { return src; }
+        std::string_view text(const Lexeme& lx) const { return src.substr(lx.offset, lx.length); }
+
+        Lexeme                  scan();
+        YaccParser::symbol_type nextToken();
+
+      private:
+        char at(size_t i) const { return i < src.size() ? src[i] : '\0'; }
+        // 从 i 开始跳过属于 mask 类的字符，返回第一个不属于的位置
+        size_t skip(size_t i, uint8_t mask) const;
+        // 消耗 len 个字符，与 Flex 的 YY_USER_ACTION 一致：loc.step(); loc.columns(len);
+        void advance(size_t len);
+
+        Lexeme make(YaccParser::token_kind_type token, size_t start);
+        Lexeme scanNumber(size_t start);
+        Lexeme scanString(size_t start);
+
+        // 各数字规则从 start 开始能匹配的长度，0 表示不匹配
+        size_t matchHexFloat(size_t start) const;
+        size_t matchHexInt(size_t start) const;
+        size_t matchDecFloat(size_t start) const;
+    };
+}  // namespace FE
+
+#endif  // __FRONTEND_PARSER_FAST_SCANNER_H__
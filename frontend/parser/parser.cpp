@@ -8,45 +8,112 @@ namespace FE
 
     void Parser::reportError(const location& loc, const std::string& message) { _parser.error(loc, message); }
 
-    std::vector<Token> Parser::parseTokens_impl()
+    TokenList Parser::parseTokens_impl()
     {
-        std::vector<Token> tokens;
+        using TokenType = TokenList::TokenType;
+
+        TokenList tokens;
+        tokens.kindNames.reserve(YaccParser::YYNTOKENS);
+        for (int k = 0; k < YaccParser::YYNTOKENS; ++k)
+            tokens.kindNames.push_back(YaccParser::symbol_name(static_cast<YaccParser::symbol_kind_type>(k)));
+
+        if (_scanner.usesSource())
+        {
+            // 词素与字符串属性直接指向源文件
+            FastScanner& scanner = _scanner.fast();
+            tokens.text          = scanner.source();
+            tokens.reserve(tokens.text.size() / 8);
+            while (true)
+            {
+                FastScanner::Lexeme lx = scanner.scan();
+                if (lx.token == YaccParser::token::TOKEN_END) break;
+
+                TokenList::Value value;
+                value.lval          = 0;
+                TokenType valueType = TokenType::T_NONE;
+                switch (lx.token)
+                {
+                    case YaccParser::token::TOKEN_LL_CONST:
+                        value.lval = lx.lval;
+                        valueType  = TokenType::T_LL;
+                        break;
+                    case YaccParser::token::TOKEN_INT_CONST:
+                        value.ival = lx.ival;
+                        valueType  = TokenType::T_INT;
+                        break;
+                    case YaccParser::token::TOKEN_FLOAT_CONST:
+                        value.fval = static_cast<float>(lx.dval);
+                        valueType  = TokenType::T_FLOAT;
+                        break;
+                    case YaccParser::token::TOKEN_STR_CONST:
+                        value.sval = {lx.offset + 1, lx.length - 2};
+                        valueType  = TokenType::T_STRING;
+                        break;
+                    case YaccParser::token::TOKEN_IDENT:
+                    case YaccParser::token::TOKEN_ERR_TOKEN:
+                        value.sval = {lx.offset, lx.length};
+                        valueType  = TokenType::T_STRING;
+                        break;
+                    default: break;
+                }
+
+                auto kind = YaccParser::by_kind(lx.token).kind();
+                tokens.push(static_cast<uint16_t>(kind),
+                    {lx.offset, lx.length},
+                    lx.loc.begin.line,
+                    lx.loc.begin.column - 1,
+                    valueType,
+                    value);
+            }
+            return tokens;
+        }
+
+        // 从 istream 读入：词素与字符串属性依次追加到 ownedText
+        auto append = [&tokens](std::string_view s) {
+            TokenList::Span span{static_cast<uint32_t>(tokens.ownedText.size()), static_cast<uint32_t>(s.size())};
+            tokens.ownedText.append(s);
+            return span;
+        };
         while (true)
         {
             type token = _scanner.nextToken();
             if (token.kind() == kind::S_END) break;
 
-            Token result;
-            result.token_name    = token.name();
-            result.line_number   = token.location.begin.line;
-            result.column_number = token.location.begin.column - 1;
-            result.lexeme        = _scanner.YYText();
+            TokenList::Span  lexeme = append(std::string_view(_scanner.YYText(), _scanner.YYLeng()));
+            TokenList::Value value;
+            value.lval          = 0;
+            TokenType valueType = TokenType::T_NONE;
 
             switch (token.kind())
             {
                 case kind::S_LL_CONST:
-                    result.lval = token.value.as<long long>();
-                    result.type = Token::TokenType::T_LL;
+                    value.lval = token.value.as<long long>();
+                    valueType  = TokenType::T_LL;
                     break;
                 case kind::S_INT_CONST:
-                    result.ival = token.value.as<int>();
-                    result.type = Token::TokenType::T_INT;
+                    value.ival = token.value.as<int>();
+                    valueType  = TokenType::T_INT;
+                    break;
+                case kind::S_FLOAT_CONST:
+                    value.fval = static_cast<float>(token.value.as<double>());
+                    valueType  = TokenType::T_FLOAT;
                     break;
-                    case kind::S_FLOAT_CONST:  
-                result.fval = token.value.as<double>();
-                result.type = Token::TokenType::T_FLOAT;
-                break;
                 case kind::S_IDENT:
                 case kind::S_SLASH_COMMENT:
                 case kind::S_ERR_TOKEN:
                 case kind::S_STR_CONST:
-                    result.sval = token.value.as<std::string>();
-                    result.type = Token::TokenType::T_STRING;
+                    value.sval = append(token.value.as<std::string>());
+                    valueType  = TokenType::T_STRING;
                     break;
-                default: result.type = Token::TokenType::T_NONE; break;
+                default: break;
             }
 
-            tokens.push_back(result);
+            tokens.push(static_cast<uint16_t>(token.kind()),
+                lexeme,
+                token.location.begin.line,
+                token.location.begin.column - 1,
+                valueType,
+                value);
         }
 
         return tokens;
@@ -14,13 +14,18 @@ namespace FE
       private:
         Scanner    _scanner;
         YaccParser _parser;
+        Arena      _astArena;  // AST 节点与子节点列表的内存，语法分析出错时残留的节点也一并释放
 
       public:
         AST::Root* ast;
 
       public:
         Parser(std::istream* inStream, std::ostream* outStream)
-            : iParser<Parser>(inStream, outStream), _scanner(*this), _parser(_scanner, *this), ast(nullptr)
+            : iParser<Parser>(inStream, outStream),
+              _scanner(*this),
+              _parser(_scanner, *this),
+              _astArena(64 * 1024),
+              ast(nullptr)
         {
             _scanner.switch_streams(inStream, outStream);
         }
@@ -28,9 +33,27 @@ namespace FE
 
         void reportError(const location& loc, const std::string& message);
 
+        // 改为直接扫描内存中的源文件（如 MappedFile::view()），source 须在分析结束前保持有效
+        void setSource(std::string_view source) { _scanner.setSource(source); }
+
+        // 语法动作中创建节点：new (parser.arena()) XxxNode(...)
+        Arena& arena() { return _astArena; }
+        template <typename T>
+        AST::NodeList<T>* newList()
+        {
+            return _astArena.create<AST::NodeList<T>>(ArenaAllocator<T*>(_astArena));
+        }
+
+        // IR 生成结束后即可调用，提前归还整棵 AST 的内存；之后 ast 及其所有节点失效
+        void releaseAST()
+        {
+            ast = nullptr;
+            _astArena.release();
+        }
+
       private:
-        std::vector<Token> parseTokens_impl();
-        AST::Root*         parseAST_impl();
+        TokenList  parseTokens_impl();
+        AST::Root* parseAST_impl();
     };
 }  // namespace FE
 
@@ -8,9 +8,11 @@
 #endif
 
 #undef YY_DECL
-#define YY_DECL FE::YaccParser::symbol_type FE::Scanner::nextToken()
+#define YY_DECL FE::YaccParser::symbol_type FE::Scanner::flexNextToken()
 
 #include <frontend/parser/yacc.h>
+#include <frontend/parser/fast_scanner.h>
+#include <string_view>
 
 namespace FE
 {
@@ -19,13 +21,27 @@ namespace FE
     class Scanner : public yyFlexLexer
     {
       private:
-        Parser& _parser;
+        Parser&     _parser;
+        FastScanner _fast;
+        bool        _useFast;  // 设置了内存中的源文件后改用 FastScanner，不再读 istream
 
       public:
-        Scanner(Parser& parser) : _parser(parser) {}
+        Scanner(Parser& parser) : _parser(parser), _fast(parser), _useFast(false) {}
         virtual ~Scanner() {}
 
-        virtual YaccParser::symbol_type nextToken();
+        void setSource(std::string_view source)
+        {
+            _fast.reset(source);
+            _useFast = true;
+        }
+        bool         usesSource() const { return _useFast; }
+        FastScanner& fast() { return _fast; }
+
+        YaccParser::symbol_type nextToken() { return _useFast ? _fast.nextToken() : flexNextToken(); }
+
+      private:
+        // lexer.l 生成的 Flex 扫描器
+        virtual YaccParser::symbol_type flexNextToken();
     };
 }  // namespace FE
 
@@ -279,23 +279,23 @@ namespace FE
 
             case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
             case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                value.YY_MOVE_OR_COPY<std::vector<FE::AST::ExprNode*>*>(YY_MOVE(that.value));
+                value.YY_MOVE_OR_COPY<FE::AST::NodeList<FE::AST::ExprNode>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                value.YY_MOVE_OR_COPY<std::vector<FE::AST::InitDecl*>*>(YY_MOVE(that.value));
+                value.YY_MOVE_OR_COPY<FE::AST::NodeList<FE::AST::InitDecl>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                value.YY_MOVE_OR_COPY<std::vector<FE::AST::ParamDeclarator*>*>(YY_MOVE(that.value));
+                value.YY_MOVE_OR_COPY<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                value.YY_MOVE_OR_COPY<std::vector<FE::AST::StmtNode*>*>(YY_MOVE(that.value));
+                value.YY_MOVE_OR_COPY<FE::AST::NodeList<FE::AST::StmtNode>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                value.YY_MOVE_OR_COPY<std::vector<FE::AST::VarDeclarator*>*>(YY_MOVE(that.value));
+                value.YY_MOVE_OR_COPY<FE::AST::NodeList<FE::AST::VarDeclarator>*>(YY_MOVE(that.value));
                 break;
 
             default: break;
@@ -394,23 +394,23 @@ namespace FE
 
             case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
             case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                value.move<std::vector<FE::AST::ExprNode*>*>(YY_MOVE(that.value));
+                value.move<FE::AST::NodeList<FE::AST::ExprNode>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                value.move<std::vector<FE::AST::InitDecl*>*>(YY_MOVE(that.value));
+                value.move<FE::AST::NodeList<FE::AST::InitDecl>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                value.move<std::vector<FE::AST::ParamDeclarator*>*>(YY_MOVE(that.value));
+                value.move<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                value.move<std::vector<FE::AST::StmtNode*>*>(YY_MOVE(that.value));
+                value.move<FE::AST::NodeList<FE::AST::StmtNode>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                value.move<std::vector<FE::AST::VarDeclarator*>*>(YY_MOVE(that.value));
+                value.move<FE::AST::NodeList<FE::AST::VarDeclarator>*>(YY_MOVE(that.value));
                 break;
 
             default: break;
@@ -508,23 +508,23 @@ namespace FE
 
             case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
             case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                value.copy<std::vector<FE::AST::ExprNode*>*>(that.value);
+                value.copy<FE::AST::NodeList<FE::AST::ExprNode>*>(that.value);
                 break;
 
             case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                value.copy<std::vector<FE::AST::InitDecl*>*>(that.value);
+                value.copy<FE::AST::NodeList<FE::AST::InitDecl>*>(that.value);
                 break;
 
             case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                value.copy<std::vector<FE::AST::ParamDeclarator*>*>(that.value);
+                value.copy<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(that.value);
                 break;
 
             case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                value.copy<std::vector<FE::AST::StmtNode*>*>(that.value);
+                value.copy<FE::AST::NodeList<FE::AST::StmtNode>*>(that.value);
                 break;
 
             case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                value.copy<std::vector<FE::AST::VarDeclarator*>*>(that.value);
+                value.copy<FE::AST::NodeList<FE::AST::VarDeclarator>*>(that.value);
                 break;
 
             default: break;
@@ -621,23 +621,23 @@ namespace FE
 
             case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
             case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                value.move<std::vector<FE::AST::ExprNode*>*>(that.value);
+                value.move<FE::AST::NodeList<FE::AST::ExprNode>*>(that.value);
                 break;
 
             case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                value.move<std::vector<FE::AST::InitDecl*>*>(that.value);
+                value.move<FE::AST::NodeList<FE::AST::InitDecl>*>(that.value);
                 break;
 
             case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                value.move<std::vector<FE::AST::ParamDeclarator*>*>(that.value);
+                value.move<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(that.value);
                 break;
 
             case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                value.move<std::vector<FE::AST::StmtNode*>*>(that.value);
+                value.move<FE::AST::NodeList<FE::AST::StmtNode>*>(that.value);
                 break;
 
             case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                value.move<std::vector<FE::AST::VarDeclarator*>*>(that.value);
+                value.move<FE::AST::NodeList<FE::AST::VarDeclarator>*>(that.value);
                 break;
 
             default: break;
@@ -936,23 +936,23 @@ namespace FE
 
                     case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
                     case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                        yylhs.value.emplace<std::vector<FE::AST::ExprNode*>*>();
+                        yylhs.value.emplace<FE::AST::NodeList<FE::AST::ExprNode>*>();
                         break;
 
                     case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                        yylhs.value.emplace<std::vector<FE::AST::InitDecl*>*>();
+                        yylhs.value.emplace<FE::AST::NodeList<FE::AST::InitDecl>*>();
                         break;
 
                     case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                        yylhs.value.emplace<std::vector<FE::AST::ParamDeclarator*>*>();
+                        yylhs.value.emplace<FE::AST::NodeList<FE::AST::ParamDeclarator>*>();
                         break;
 
                     case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                        yylhs.value.emplace<std::vector<FE::AST::StmtNode*>*>();
+                        yylhs.value.emplace<FE::AST::NodeList<FE::AST::StmtNode>*>();
                         break;
 
                     case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                        yylhs.value.emplace<std::vector<FE::AST::VarDeclarator*>*>();
+                        yylhs.value.emplace<FE::AST::NodeList<FE::AST::VarDeclarator>*>();
                         break;
 
                     default: break;
@@ -977,7 +977,7 @@ namespace FE
 #line 189 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::Root*>() =
-                                new Root(yystack_[0].value.as<std::vector<FE::AST::StmtNode*>*>());
+                                new (parser.arena()) Root(yystack_[0].value.as<FE::AST::NodeList<FE::AST::StmtNode>*>());
                             parser.ast = yylhs.value.as<FE::AST::Root*>();
                         }
 #line 1072 "frontend/parser/yacc.cpp"
@@ -994,9 +994,9 @@ namespace FE
                         case 4:  // STMT_LIST: STMT
 #line 199 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::StmtNode*>*>() = new std::vector<StmtNode*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::StmtNode>*>() = parser.newList<StmtNode>();
                             if (yystack_[0].value.as<FE::AST::StmtNode*>())
-                                yylhs.value.as<std::vector<FE::AST::StmtNode*>*>()->push_back(
+                                yylhs.value.as<FE::AST::NodeList<FE::AST::StmtNode>*>()->push_back(
                                     yystack_[0].value.as<FE::AST::StmtNode*>());
                         }
 #line 1089 "frontend/parser/yacc.cpp"
@@ -1005,10 +1005,10 @@ namespace FE
                         case 5:  // STMT_LIST: STMT_LIST STMT
 #line 203 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::StmtNode*>*>() =
-                                yystack_[1].value.as<std::vector<FE::AST::StmtNode*>*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::StmtNode>*>() =
+                                yystack_[1].value.as<FE::AST::NodeList<FE::AST::StmtNode>*>();
                             if (yystack_[0].value.as<FE::AST::StmtNode*>())
-                                yylhs.value.as<std::vector<FE::AST::StmtNode*>*>()->push_back(
+                                yylhs.value.as<FE::AST::NodeList<FE::AST::StmtNode>*>()->push_back(
                                     yystack_[0].value.as<FE::AST::StmtNode*>());
                         }
 #line 1098 "frontend/parser/yacc.cpp"
@@ -1114,7 +1114,7 @@ namespace FE
 #line 250 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new ContinueStmt(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+                                new (parser.arena()) ContinueStmt(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
                         }
 #line 1202 "frontend/parser/yacc.cpp"
                         break;
@@ -1123,7 +1123,7 @@ namespace FE
 #line 256 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new ExprStmt(yystack_[1].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) ExprStmt(yystack_[1].value.as<FE::AST::ExprNode*>(),
                                     yystack_[1].location.begin.line,
                                     yystack_[1].location.begin.column);
                         }
@@ -1134,8 +1134,8 @@ namespace FE
 #line 262 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::VarDeclaration*>() =
-                                new VarDeclaration(yystack_[1].value.as<FE::AST::Type*>(),
-                                    yystack_[0].value.as<std::vector<FE::AST::VarDeclarator*>*>(),
+                                new (parser.arena()) VarDeclaration(yystack_[1].value.as<FE::AST::Type*>(),
+                                    yystack_[0].value.as<FE::AST::NodeList<FE::AST::VarDeclarator>*>(),
                                     false,
                                     yystack_[1].location.begin.line,
                                     yystack_[1].location.begin.column);
@@ -1147,8 +1147,8 @@ namespace FE
 #line 265 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::VarDeclaration*>() =
-                                new VarDeclaration(yystack_[1].value.as<FE::AST::Type*>(),
-                                    yystack_[0].value.as<std::vector<FE::AST::VarDeclarator*>*>(),
+                                new (parser.arena()) VarDeclaration(yystack_[1].value.as<FE::AST::Type*>(),
+                                    yystack_[0].value.as<FE::AST::NodeList<FE::AST::VarDeclarator>*>(),
                                     true,
                                     yystack_[2].location.begin.line,
                                     yystack_[2].location.begin.column);
@@ -1160,7 +1160,7 @@ namespace FE
 #line 271 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new VarDeclStmt(yystack_[1].value.as<FE::AST::VarDeclaration*>(),
+                                new (parser.arena()) VarDeclStmt(yystack_[1].value.as<FE::AST::VarDeclaration*>(),
                                     yystack_[1].location.begin.line,
                                     yystack_[1].location.begin.column);
                         }
@@ -1170,9 +1170,9 @@ namespace FE
                         case 23:  // FUNC_BODY: LBRACE RBRACE
 #line 279 "frontend/parser/yacc.y"
                         {
-                            auto vec = new std::vector<StmtNode*>();
+                            auto vec = parser.newList<StmtNode>();
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new BlockStmt(vec, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+                                new (parser.arena()) BlockStmt(vec, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
                         }
 #line 1243 "frontend/parser/yacc.cpp"
                         break;
@@ -1180,16 +1180,16 @@ namespace FE
                         case 24:  // FUNC_BODY: LBRACE STMT_LIST RBRACE
 #line 283 "frontend/parser/yacc.y"
                         {
-                            if (!yystack_[1].value.as<std::vector<FE::AST::StmtNode*>*>())
+                            if (!yystack_[1].value.as<FE::AST::NodeList<FE::AST::StmtNode>*>())
                             {
-                                auto vec                             = new std::vector<StmtNode*>();
-                                yylhs.value.as<FE::AST::StmtNode*>() = new BlockStmt(
+                                auto vec                             = parser.newList<StmtNode>();
+                                yylhs.value.as<FE::AST::StmtNode*>() = new (parser.arena()) BlockStmt(
                                     vec, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
                             }
                             else
                             {
                                 yylhs.value.as<FE::AST::StmtNode*>() =
-                                    new BlockStmt(yystack_[1].value.as<std::vector<FE::AST::StmtNode*>*>(),
+                                    new (parser.arena()) BlockStmt(yystack_[1].value.as<FE::AST::NodeList<FE::AST::StmtNode>*>(),
                                         yystack_[2].location.begin.line,
                                         yystack_[2].location.begin.column);
                             }
@@ -1202,9 +1202,9 @@ namespace FE
                         {
                             Entry* entry = Entry::getEntry(yystack_[4].value.as<std::string>());
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new FuncDeclStmt(yystack_[5].value.as<FE::AST::Type*>(),
+                                new (parser.arena()) FuncDeclStmt(yystack_[5].value.as<FE::AST::Type*>(),
                                     entry,
-                                    yystack_[2].value.as<std::vector<FE::AST::ParamDeclarator*>*>(),
+                                    yystack_[2].value.as<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(),
                                     yystack_[0].value.as<FE::AST::StmtNode*>(),
                                     yystack_[5].location.begin.line,
                                     yystack_[5].location.begin.column);
@@ -1215,10 +1215,10 @@ namespace FE
                         case 26:  // FOR_STMT: FOR LPAREN VAR_DECLARATION SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT
 #line 301 "frontend/parser/yacc.y"
                         {
-                            VarDeclStmt* initStmt = new VarDeclStmt(yystack_[6].value.as<FE::AST::VarDeclaration*>(),
+                            VarDeclStmt* initStmt = new (parser.arena()) VarDeclStmt(yystack_[6].value.as<FE::AST::VarDeclaration*>(),
                                 yystack_[6].location.begin.line,
                                 yystack_[6].location.begin.column);
-                            yylhs.value.as<FE::AST::StmtNode*>() = new ForStmt(initStmt,
+                            yylhs.value.as<FE::AST::StmtNode*>() = new (parser.arena()) ForStmt(initStmt,
                                 yystack_[4].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::StmtNode*>(),
@@ -1231,10 +1231,10 @@ namespace FE
                         case 27:  // FOR_STMT: FOR LPAREN EXPR SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT
 #line 305 "frontend/parser/yacc.y"
                         {
-                            StmtNode* initStmt = new ExprStmt(yystack_[6].value.as<FE::AST::ExprNode*>(),
+                            StmtNode* initStmt = new (parser.arena()) ExprStmt(yystack_[6].value.as<FE::AST::ExprNode*>(),
                                 yystack_[6].value.as<FE::AST::ExprNode*>()->line_num,
                                 yystack_[6].value.as<FE::AST::ExprNode*>()->col_num);
-                            yylhs.value.as<FE::AST::StmtNode*>() = new ForStmt(initStmt,
+                            yylhs.value.as<FE::AST::StmtNode*>() = new (parser.arena()) ForStmt(initStmt,
                                 yystack_[4].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::StmtNode*>(),
@@ -1248,7 +1248,7 @@ namespace FE
 #line 312 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new IfStmt(yystack_[2].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) IfStmt(yystack_[2].value.as<FE::AST::ExprNode*>(),
                                     yystack_[0].value.as<FE::AST::StmtNode*>(),
                                     nullptr,
                                     yystack_[4].location.begin.line,
@@ -1261,7 +1261,7 @@ namespace FE
 #line 315 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new IfStmt(yystack_[4].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) IfStmt(yystack_[4].value.as<FE::AST::ExprNode*>(),
                                     yystack_[2].value.as<FE::AST::StmtNode*>(),
                                     yystack_[0].value.as<FE::AST::StmtNode*>(),
                                     yystack_[6].location.begin.line,
@@ -1273,7 +1273,7 @@ namespace FE
                         case 30:  // RETURN_STMT: RETURN SEMICOLON
 #line 321 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::StmtNode*>() = new ReturnStmt(
+                            yylhs.value.as<FE::AST::StmtNode*>() = new (parser.arena()) ReturnStmt(
                                 nullptr, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
                         }
 #line 1307 "frontend/parser/yacc.cpp"
@@ -1283,7 +1283,7 @@ namespace FE
 #line 324 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new ReturnStmt(yystack_[1].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) ReturnStmt(yystack_[1].value.as<FE::AST::ExprNode*>(),
                                     yystack_[2].location.begin.line,
                                     yystack_[2].location.begin.column);
                         }
@@ -1294,7 +1294,7 @@ namespace FE
 #line 330 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new WhileStmt(yystack_[2].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) WhileStmt(yystack_[2].value.as<FE::AST::ExprNode*>(),
                                     yystack_[0].value.as<FE::AST::StmtNode*>(),
                                     yystack_[4].location.begin.line,
                                     yystack_[4].location.begin.column);
@@ -1306,7 +1306,7 @@ namespace FE
 #line 336 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new BreakStmt(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+                                new (parser.arena()) BreakStmt(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
                         }
 #line 1331 "frontend/parser/yacc.cpp"
                         break;
@@ -1315,7 +1315,7 @@ namespace FE
 #line 342 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new ContinueStmt(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+                                new (parser.arena()) ContinueStmt(yystack_[1].location.begin.line, yystack_[1].location.begin.column);
                         }
 #line 1339 "frontend/parser/yacc.cpp"
                         break;
@@ -1323,9 +1323,9 @@ namespace FE
                         case 35:  // BLOCK_STMT: LBRACE RBRACE
 #line 348 "frontend/parser/yacc.y"
                         {
-                            auto vec = new std::vector<StmtNode*>();
+                            auto vec = parser.newList<StmtNode>();
                             yylhs.value.as<FE::AST::StmtNode*>() =
-                                new BlockStmt(vec, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
+                                new (parser.arena()) BlockStmt(vec, yystack_[1].location.begin.line, yystack_[1].location.begin.column);
                         }
 #line 1348 "frontend/parser/yacc.cpp"
                         break;
@@ -1333,16 +1333,16 @@ namespace FE
                         case 36:  // BLOCK_STMT: LBRACE STMT_LIST RBRACE
 #line 352 "frontend/parser/yacc.y"
                         {
-                            if (!yystack_[1].value.as<std::vector<FE::AST::StmtNode*>*>())
+                            if (!yystack_[1].value.as<FE::AST::NodeList<FE::AST::StmtNode>*>())
                             {
-                                auto vec                             = new std::vector<StmtNode*>();
-                                yylhs.value.as<FE::AST::StmtNode*>() = new BlockStmt(
+                                auto vec                             = parser.newList<StmtNode>();
+                                yylhs.value.as<FE::AST::StmtNode*>() = new (parser.arena()) BlockStmt(
                                     vec, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
                             }
                             else
                             {
                                 yylhs.value.as<FE::AST::StmtNode*>() =
-                                    new BlockStmt(yystack_[1].value.as<std::vector<FE::AST::StmtNode*>*>(),
+                                    new (parser.arena()) BlockStmt(yystack_[1].value.as<FE::AST::NodeList<FE::AST::StmtNode>*>(),
                                         yystack_[2].location.begin.line,
                                         yystack_[2].location.begin.column);
                             }
@@ -1355,7 +1355,7 @@ namespace FE
                         {
                             Entry* entry = Entry::getEntry(yystack_[0].value.as<std::string>());
                             yylhs.value.as<FE::AST::ParamDeclarator*>() =
-                                new ParamDeclarator(yystack_[1].value.as<FE::AST::Type*>(),
+                                new (parser.arena()) ParamDeclarator(yystack_[1].value.as<FE::AST::Type*>(),
                                     entry,
                                     nullptr,
                                     yystack_[1].location.begin.line,
@@ -1367,12 +1367,12 @@ namespace FE
                         case 38:  // PARAM_DECLARATOR: TYPE IDENT LBRACKET RBRACKET
 #line 370 "frontend/parser/yacc.y"
                         {
-                            std::vector<ExprNode*>* dim = new std::vector<ExprNode*>();
-                            dim->emplace_back(new LiteralExpr(
+                            NodeList<ExprNode>* dim = parser.newList<ExprNode>();
+                            dim->emplace_back(new (parser.arena()) LiteralExpr(
                                 -1, yystack_[1].location.begin.line, yystack_[1].location.begin.column));
                             Entry* entry = Entry::getEntry(yystack_[2].value.as<std::string>());
                             yylhs.value.as<FE::AST::ParamDeclarator*>() =
-                                new ParamDeclarator(yystack_[3].value.as<FE::AST::Type*>(),
+                                new (parser.arena()) ParamDeclarator(yystack_[3].value.as<FE::AST::Type*>(),
                                     entry,
                                     dim,
                                     yystack_[3].location.begin.line,
@@ -1386,9 +1386,9 @@ namespace FE
                         {
                             Entry* entry = Entry::getEntry(yystack_[1].value.as<std::string>());
                             yylhs.value.as<FE::AST::ParamDeclarator*>() =
-                                new ParamDeclarator(yystack_[2].value.as<FE::AST::Type*>(),
+                                new (parser.arena()) ParamDeclarator(yystack_[2].value.as<FE::AST::Type*>(),
                                     entry,
-                                    yystack_[0].value.as<std::vector<FE::AST::ExprNode*>*>(),
+                                    yystack_[0].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>(),
                                     yystack_[2].location.begin.line,
                                     yystack_[2].location.begin.column);
                         }
@@ -1399,15 +1399,15 @@ namespace FE
 #line 386 "frontend/parser/yacc.y"
                         {
                             /* 第一维空 []，后面跟剩余维度 */
-                            yystack_[0].value.as<std::vector<FE::AST::ExprNode*>*>()->insert(
-                                yystack_[0].value.as<std::vector<FE::AST::ExprNode*>*>()->begin(),
-                                new LiteralExpr(
+                            yystack_[0].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>()->insert(
+                                yystack_[0].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>()->begin(),
+                                new (parser.arena()) LiteralExpr(
                                     -1, yystack_[2].location.begin.line, yystack_[2].location.begin.column));
                             Entry* entry = Entry::getEntry(yystack_[3].value.as<std::string>());
                             yylhs.value.as<FE::AST::ParamDeclarator*>() =
-                                new ParamDeclarator(yystack_[4].value.as<FE::AST::Type*>(),
+                                new (parser.arena()) ParamDeclarator(yystack_[4].value.as<FE::AST::Type*>(),
                                     entry,
-                                    yystack_[0].value.as<std::vector<FE::AST::ExprNode*>*>(),
+                                    yystack_[0].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>(),
                                     yystack_[4].location.begin.line,
                                     yystack_[4].location.begin.column);
                         }
@@ -1417,8 +1417,8 @@ namespace FE
                         case 41:  // PARAM_DECLARATOR_LIST: %empty
 #line 398 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::ParamDeclarator*>*>() =
-                                new std::vector<ParamDeclarator*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ParamDeclarator>*>() =
+                                parser.newList<ParamDeclarator>();
                         }
 #line 1410 "frontend/parser/yacc.cpp"
                         break;
@@ -1426,9 +1426,9 @@ namespace FE
                         case 42:  // PARAM_DECLARATOR_LIST: PARAM_DECLARATOR
 #line 402 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::ParamDeclarator*>*>() =
-                                new std::vector<ParamDeclarator*>();
-                            yylhs.value.as<std::vector<FE::AST::ParamDeclarator*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ParamDeclarator>*>() =
+                                parser.newList<ParamDeclarator>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ParamDeclarator>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::ParamDeclarator*>());
                         }
 #line 1419 "frontend/parser/yacc.cpp"
@@ -1437,9 +1437,9 @@ namespace FE
                         case 43:  // PARAM_DECLARATOR_LIST: PARAM_DECLARATOR_LIST COMMA PARAM_DECLARATOR
 #line 406 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::ParamDeclarator*>*>() =
-                                yystack_[2].value.as<std::vector<FE::AST::ParamDeclarator*>*>();
-                            yylhs.value.as<std::vector<FE::AST::ParamDeclarator*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ParamDeclarator>*>() =
+                                yystack_[2].value.as<FE::AST::NodeList<FE::AST::ParamDeclarator>*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ParamDeclarator>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::ParamDeclarator*>());
                         }
 #line 1428 "frontend/parser/yacc.cpp"
@@ -1449,7 +1449,7 @@ namespace FE
 #line 413 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::VarDeclarator*>() =
-                                new VarDeclarator(yystack_[0].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) VarDeclarator(yystack_[0].value.as<FE::AST::ExprNode*>(),
                                     nullptr,
                                     yystack_[0].location.begin.line,
                                     yystack_[0].location.begin.column);
@@ -1461,7 +1461,7 @@ namespace FE
 #line 417 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::VarDeclarator*>() =
-                                new VarDeclarator(yystack_[2].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) VarDeclarator(yystack_[2].value.as<FE::AST::ExprNode*>(),
                                     yystack_[0].value.as<FE::AST::InitDecl*>(),
                                     yystack_[2].location.begin.line,
                                     yystack_[2].location.begin.column);
@@ -1472,8 +1472,8 @@ namespace FE
                         case 46:  // VAR_DECLARATOR_LIST: VAR_DECLARATOR
 #line 423 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::VarDeclarator*>*>() = new std::vector<VarDeclarator*>();
-                            yylhs.value.as<std::vector<FE::AST::VarDeclarator*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::VarDeclarator>*>() = parser.newList<VarDeclarator>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::VarDeclarator>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::VarDeclarator*>());
                         }
 #line 1453 "frontend/parser/yacc.cpp"
@@ -1482,9 +1482,9 @@ namespace FE
                         case 47:  // VAR_DECLARATOR_LIST: VAR_DECLARATOR_LIST COMMA VAR_DECLARATOR
 #line 427 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::VarDeclarator*>*>() =
-                                yystack_[2].value.as<std::vector<FE::AST::VarDeclarator*>*>();
-                            yylhs.value.as<std::vector<FE::AST::VarDeclarator*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::VarDeclarator>*>() =
+                                yystack_[2].value.as<FE::AST::NodeList<FE::AST::VarDeclarator>*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::VarDeclarator>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::VarDeclarator*>());
                         }
 #line 1462 "frontend/parser/yacc.cpp"
@@ -1494,7 +1494,7 @@ namespace FE
 #line 434 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::InitDecl*>() =
-                                new Initializer(yystack_[0].value.as<FE::AST::ExprNode*>(),
+                                new (parser.arena()) Initializer(yystack_[0].value.as<FE::AST::ExprNode*>(),
                                     yystack_[0].location.begin.line,
                                     yystack_[0].location.begin.column);
                         }
@@ -1505,7 +1505,7 @@ namespace FE
 #line 438 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::InitDecl*>() =
-                                new InitializerList(yystack_[1].value.as<std::vector<FE::AST::InitDecl*>*>(),
+                                new (parser.arena()) InitializerList(yystack_[1].value.as<FE::AST::NodeList<FE::AST::InitDecl>*>(),
                                     yystack_[2].location.begin.line,
                                     yystack_[2].location.begin.column);
                         }
@@ -1515,8 +1515,8 @@ namespace FE
                         case 50:  // INITIALIZER_LIST: INITIALIZER
 #line 444 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::InitDecl*>*>() = new std::vector<InitDecl*>();
-                            yylhs.value.as<std::vector<FE::AST::InitDecl*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::InitDecl>*>() = parser.newList<InitDecl>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::InitDecl>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::InitDecl*>());
                         }
 #line 1487 "frontend/parser/yacc.cpp"
@@ -1525,9 +1525,9 @@ namespace FE
                         case 51:  // INITIALIZER_LIST: INITIALIZER_LIST COMMA INITIALIZER
 #line 448 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::InitDecl*>*>() =
-                                yystack_[2].value.as<std::vector<FE::AST::InitDecl*>*>();
-                            yylhs.value.as<std::vector<FE::AST::InitDecl*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::InitDecl>*>() =
+                                yystack_[2].value.as<FE::AST::NodeList<FE::AST::InitDecl>*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::InitDecl>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::InitDecl*>());
                         }
 #line 1496 "frontend/parser/yacc.cpp"
@@ -1544,7 +1544,7 @@ namespace FE
                         case 53:  // ASSIGN_EXPR: LEFT_VAL_EXPR ASSIGN ASSIGN_EXPR
 #line 458 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::ASSIGN,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::ASSIGN,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1556,8 +1556,8 @@ namespace FE
                         case 54:  // EXPR_LIST: NOCOMMA_EXPR
 #line 464 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>() = new std::vector<ExprNode*>();
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>() = parser.newList<ExprNode>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::ExprNode*>());
                         }
 #line 1521 "frontend/parser/yacc.cpp"
@@ -1566,9 +1566,9 @@ namespace FE
                         case 55:  // EXPR_LIST: EXPR_LIST COMMA NOCOMMA_EXPR
 #line 468 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>() =
-                                yystack_[2].value.as<std::vector<FE::AST::ExprNode*>*>();
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>() =
+                                yystack_[2].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::ExprNode*>());
                         }
 #line 1530 "frontend/parser/yacc.cpp"
@@ -1593,10 +1593,10 @@ namespace FE
                             }
                             else
                             {
-                                auto vec = new std::vector<ExprNode*>();
+                                auto vec = parser.newList<ExprNode>();
                                 vec->push_back(yystack_[2].value.as<FE::AST::ExprNode*>());
                                 vec->push_back(yystack_[0].value.as<FE::AST::ExprNode*>());
-                                yylhs.value.as<FE::AST::ExprNode*>() = new CommaExpr(vec,
+                                yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) CommaExpr(vec,
                                     yystack_[2].value.as<FE::AST::ExprNode*>()->line_num,
                                     yystack_[2].value.as<FE::AST::ExprNode*>()->col_num);
                             }
@@ -1623,7 +1623,7 @@ namespace FE
                         case 60:  // LOGICAL_OR_EXPR: LOGICAL_OR_EXPR OR LOGICAL_AND_EXPR
 #line 504 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::OR,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::OR,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1643,7 +1643,7 @@ namespace FE
                         case 62:  // LOGICAL_AND_EXPR: LOGICAL_AND_EXPR AND LOGICAL_AND_EXPR
 #line 513 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::AND,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::AND,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1663,7 +1663,7 @@ namespace FE
                         case 64:  // EQUALITY_EXPR: EQUALITY_EXPR EQ EQUALITY_EXPR
 #line 522 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::EQ,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::EQ,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1675,7 +1675,7 @@ namespace FE
                         case 65:  // EQUALITY_EXPR: EQUALITY_EXPR NEQ EQUALITY_EXPR
 #line 525 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::NEQ,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::NEQ,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1695,7 +1695,7 @@ namespace FE
                         case 67:  // RELATIONAL_EXPR: RELATIONAL_EXPR GT RELATIONAL_EXPR
 #line 535 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::GT,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::GT,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1707,7 +1707,7 @@ namespace FE
                         case 68:  // RELATIONAL_EXPR: RELATIONAL_EXPR GE RELATIONAL_EXPR
 #line 538 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::GE,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::GE,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1719,7 +1719,7 @@ namespace FE
                         case 69:  // RELATIONAL_EXPR: RELATIONAL_EXPR LT RELATIONAL_EXPR
 #line 541 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::LT,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::LT,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1731,7 +1731,7 @@ namespace FE
                         case 70:  // RELATIONAL_EXPR: RELATIONAL_EXPR LE RELATIONAL_EXPR
 #line 544 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::LE,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::LE,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1751,7 +1751,7 @@ namespace FE
                         case 72:  // ADDSUB_EXPR: ADDSUB_EXPR PLUS ADDSUB_EXPR
 #line 554 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::ADD,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::ADD,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1763,7 +1763,7 @@ namespace FE
                         case 73:  // ADDSUB_EXPR: ADDSUB_EXPR MINUS ADDSUB_EXPR
 #line 557 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::SUB,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::SUB,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1783,7 +1783,7 @@ namespace FE
                         case 75:  // MULDIV_EXPR: MULDIV_EXPR MUL MULDIV_EXPR
 #line 567 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::MUL,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::MUL,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1795,7 +1795,7 @@ namespace FE
                         case 76:  // MULDIV_EXPR: MULDIV_EXPR DIV MULDIV_EXPR
 #line 570 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::DIV,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::DIV,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1807,7 +1807,7 @@ namespace FE
                         case 77:  // MULDIV_EXPR: MULDIV_EXPR MOD MULDIV_EXPR
 #line 574 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new BinaryExpr(Operator::MOD,
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) BinaryExpr(Operator::MOD,
                                 yystack_[2].value.as<FE::AST::ExprNode*>(),
                                 yystack_[0].value.as<FE::AST::ExprNode*>(),
                                 yystack_[2].location.begin.line,
@@ -1828,7 +1828,7 @@ namespace FE
 #line 582 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::ExprNode*>() =
-                                new UnaryExpr(yystack_[1].value.as<FE::AST::Operator>(),
+                                new (parser.arena()) UnaryExpr(yystack_[1].value.as<FE::AST::Operator>(),
                                     yystack_[0].value.as<FE::AST::ExprNode*>(),
                                     yystack_[0].value.as<FE::AST::ExprNode*>()->line_num,
                                     yystack_[0].value.as<FE::AST::ExprNode*>()->col_num);
@@ -1875,17 +1875,17 @@ namespace FE
                             if (funcName != "starttime" && funcName != "stoptime")
                             {
                                 Entry* entry                         = Entry::getEntry(funcName);
-                                yylhs.value.as<FE::AST::ExprNode*>() = new CallExpr(
+                                yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) CallExpr(
                                     entry, nullptr, yystack_[2].location.begin.line, yystack_[2].location.begin.column);
                             }
                             else
                             {
                                 funcName                     = "_sysy_" + funcName;
-                                std::vector<ExprNode*>* args = new std::vector<ExprNode*>();
-                                args->emplace_back(new LiteralExpr(static_cast<int>(yystack_[2].location.begin.line),
+                                NodeList<ExprNode>* args = parser.newList<ExprNode>();
+                                args->emplace_back(new (parser.arena()) LiteralExpr(static_cast<int>(yystack_[2].location.begin.line),
                                     yystack_[2].location.begin.line,
                                     yystack_[2].location.begin.column));
-                                yylhs.value.as<FE::AST::ExprNode*>() = new CallExpr(Entry::getEntry(funcName),
+                                yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) CallExpr(Entry::getEntry(funcName),
                                     args,
                                     yystack_[2].location.begin.line,
                                     yystack_[2].location.begin.column);
@@ -1898,8 +1898,8 @@ namespace FE
 #line 618 "frontend/parser/yacc.y"
                         {
                             Entry* entry                         = Entry::getEntry(yystack_[3].value.as<std::string>());
-                            yylhs.value.as<FE::AST::ExprNode*>() = new CallExpr(entry,
-                                yystack_[1].value.as<std::vector<FE::AST::ExprNode*>*>(),
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) CallExpr(entry,
+                                yystack_[1].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>(),
                                 yystack_[3].location.begin.line,
                                 yystack_[3].location.begin.column);
                         }
@@ -1918,8 +1918,8 @@ namespace FE
                         case 87:  // ARRAY_DIMENSION_EXPR_LIST: ARRAY_DIMENSION_EXPR
 #line 631 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>() = new std::vector<ExprNode*>();
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>() = parser.newList<ExprNode>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::ExprNode*>());
                         }
 #line 1809 "frontend/parser/yacc.cpp"
@@ -1928,9 +1928,9 @@ namespace FE
                         case 88:  // ARRAY_DIMENSION_EXPR_LIST: ARRAY_DIMENSION_EXPR_LIST ARRAY_DIMENSION_EXPR
 #line 635 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>() =
-                                yystack_[1].value.as<std::vector<FE::AST::ExprNode*>*>();
-                            yylhs.value.as<std::vector<FE::AST::ExprNode*>*>()->push_back(
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>() =
+                                yystack_[1].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>();
+                            yylhs.value.as<FE::AST::NodeList<FE::AST::ExprNode>*>()->push_back(
                                 yystack_[0].value.as<FE::AST::ExprNode*>());
                         }
 #line 1818 "frontend/parser/yacc.cpp"
@@ -1940,7 +1940,7 @@ namespace FE
 #line 643 "frontend/parser/yacc.y"
                         {
                             Entry* entry                         = Entry::getEntry(yystack_[0].value.as<std::string>());
-                            yylhs.value.as<FE::AST::ExprNode*>() = new LeftValExpr(
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) LeftValExpr(
                                 entry, nullptr, yystack_[0].location.begin.line, yystack_[0].location.begin.column);
                         }
 #line 1827 "frontend/parser/yacc.cpp"
@@ -1950,8 +1950,8 @@ namespace FE
 #line 647 "frontend/parser/yacc.y"
                         {
                             Entry* entry                         = Entry::getEntry(yystack_[1].value.as<std::string>());
-                            yylhs.value.as<FE::AST::ExprNode*>() = new LeftValExpr(entry,
-                                yystack_[0].value.as<std::vector<FE::AST::ExprNode*>*>(),
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) LeftValExpr(entry,
+                                yystack_[0].value.as<FE::AST::NodeList<FE::AST::ExprNode>*>(),
                                 yystack_[1].location.begin.line,
                                 yystack_[1].location.begin.column);
                         }
@@ -1961,7 +1961,7 @@ namespace FE
                         case 91:  // LITERAL_EXPR: INT_CONST
 #line 654 "frontend/parser/yacc.y"
                         {
-                            yylhs.value.as<FE::AST::ExprNode*>() = new LiteralExpr((int)yystack_[0].value.as<int>(),
+                            yylhs.value.as<FE::AST::ExprNode*>() = new (parser.arena()) LiteralExpr((int)yystack_[0].value.as<int>(),
                                 yystack_[0].location.begin.line,
                                 yystack_[0].location.begin.column);
                         }
@@ -1972,7 +1972,7 @@ namespace FE
 #line 657 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::ExprNode*>() =
-                                new LiteralExpr((float)yystack_[0].value.as<double>(),
+                                new (parser.arena()) LiteralExpr((float)yystack_[0].value.as<double>(),
                                     yystack_[0].location.begin.line,
                                     yystack_[0].location.begin.column);
                         }
@@ -1983,7 +1983,7 @@ namespace FE
 #line 660 "frontend/parser/yacc.y"
                         {
                             yylhs.value.as<FE::AST::ExprNode*>() =
-                                new LiteralExpr((long long)yystack_[0].value.as<long long>(),
+                                new (parser.arena()) LiteralExpr((long long)yystack_[0].value.as<long long>(),
                                     yystack_[0].location.begin.line,
                                     yystack_[0].location.begin.column);
                         }
@@ -461,19 +461,19 @@ namespace FE
 
                 // EXPR_LIST
                 // ARRAY_DIMENSION_EXPR_LIST
-                char dummy14[sizeof(std::vector<FE::AST::ExprNode*>*)];
+                char dummy14[sizeof(FE::AST::NodeList<FE::AST::ExprNode>*)];
 
                 // INITIALIZER_LIST
-                char dummy15[sizeof(std::vector<FE::AST::InitDecl*>*)];
+                char dummy15[sizeof(FE::AST::NodeList<FE::AST::InitDecl>*)];
 
                 // PARAM_DECLARATOR_LIST
-                char dummy16[sizeof(std::vector<FE::AST::ParamDeclarator*>*)];
+                char dummy16[sizeof(FE::AST::NodeList<FE::AST::ParamDeclarator>*)];
 
                 // STMT_LIST
-                char dummy17[sizeof(std::vector<FE::AST::StmtNode*>*)];
+                char dummy17[sizeof(FE::AST::NodeList<FE::AST::StmtNode>*)];
 
                 // VAR_DECLARATOR_LIST
-                char dummy18[sizeof(std::vector<FE::AST::VarDeclarator*>*)];
+                char dummy18[sizeof(FE::AST::NodeList<FE::AST::VarDeclarator>*)];
             };
 
             /// The size of the largest semantic type.
@@ -815,23 +815,23 @@ namespace FE
 
                     case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
                     case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                        value.move<std::vector<FE::AST::ExprNode*>*>(std::move(that.value));
+                        value.move<FE::AST::NodeList<FE::AST::ExprNode>*>(std::move(that.value));
                         break;
 
                     case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                        value.move<std::vector<FE::AST::InitDecl*>*>(std::move(that.value));
+                        value.move<FE::AST::NodeList<FE::AST::InitDecl>*>(std::move(that.value));
                         break;
 
                     case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                        value.move<std::vector<FE::AST::ParamDeclarator*>*>(std::move(that.value));
+                        value.move<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(std::move(that.value));
                         break;
 
                     case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                        value.move<std::vector<FE::AST::StmtNode*>*>(std::move(that.value));
+                        value.move<FE::AST::NodeList<FE::AST::StmtNode>*>(std::move(that.value));
                         break;
 
                     case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                        value.move<std::vector<FE::AST::VarDeclarator*>*>(std::move(that.value));
+                        value.move<FE::AST::NodeList<FE::AST::VarDeclarator>*>(std::move(that.value));
                         break;
 
                     default: break;
@@ -980,53 +980,53 @@ namespace FE
 #endif
 
 #if 201103L <= YY_CPLUSPLUS
-            basic_symbol(typename Base::kind_type t, std::vector<FE::AST::ExprNode*>*&& v, location_type&& l)
+            basic_symbol(typename Base::kind_type t, FE::AST::NodeList<FE::AST::ExprNode>*&& v, location_type&& l)
                 : Base(t), value(std::move(v)), location(std::move(l))
             {}
 #else
-            basic_symbol(typename Base::kind_type t, const std::vector<FE::AST::ExprNode*>*& v, const location_type& l)
+            basic_symbol(typename Base::kind_type t, const FE::AST::NodeList<FE::AST::ExprNode>*& v, const location_type& l)
                 : Base(t), value(v), location(l)
             {}
 #endif
 
 #if 201103L <= YY_CPLUSPLUS
-            basic_symbol(typename Base::kind_type t, std::vector<FE::AST::InitDecl*>*&& v, location_type&& l)
+            basic_symbol(typename Base::kind_type t, FE::AST::NodeList<FE::AST::InitDecl>*&& v, location_type&& l)
                 : Base(t), value(std::move(v)), location(std::move(l))
             {}
 #else
-            basic_symbol(typename Base::kind_type t, const std::vector<FE::AST::InitDecl*>*& v, const location_type& l)
+            basic_symbol(typename Base::kind_type t, const FE::AST::NodeList<FE::AST::InitDecl>*& v, const location_type& l)
                 : Base(t), value(v), location(l)
             {}
 #endif
 
 #if 201103L <= YY_CPLUSPLUS
-            basic_symbol(typename Base::kind_type t, std::vector<FE::AST::ParamDeclarator*>*&& v, location_type&& l)
+            basic_symbol(typename Base::kind_type t, FE::AST::NodeList<FE::AST::ParamDeclarator>*&& v, location_type&& l)
                 : Base(t), value(std::move(v)), location(std::move(l))
             {}
 #else
             basic_symbol(
-                typename Base::kind_type t, const std::vector<FE::AST::ParamDeclarator*>*& v, const location_type& l)
+                typename Base::kind_type t, const FE::AST::NodeList<FE::AST::ParamDeclarator>*& v, const location_type& l)
                 : Base(t), value(v), location(l)
             {}
 #endif
 
 #if 201103L <= YY_CPLUSPLUS
-            basic_symbol(typename Base::kind_type t, std::vector<FE::AST::StmtNode*>*&& v, location_type&& l)
+            basic_symbol(typename Base::kind_type t, FE::AST::NodeList<FE::AST::StmtNode>*&& v, location_type&& l)
                 : Base(t), value(std::move(v)), location(std::move(l))
             {}
 #else
-            basic_symbol(typename Base::kind_type t, const std::vector<FE::AST::StmtNode*>*& v, const location_type& l)
+            basic_symbol(typename Base::kind_type t, const FE::AST::NodeList<FE::AST::StmtNode>*& v, const location_type& l)
                 : Base(t), value(v), location(l)
             {}
 #endif
 
 #if 201103L <= YY_CPLUSPLUS
-            basic_symbol(typename Base::kind_type t, std::vector<FE::AST::VarDeclarator*>*&& v, location_type&& l)
+            basic_symbol(typename Base::kind_type t, FE::AST::NodeList<FE::AST::VarDeclarator>*&& v, location_type&& l)
                 : Base(t), value(std::move(v)), location(std::move(l))
             {}
 #else
             basic_symbol(
-                typename Base::kind_type t, const std::vector<FE::AST::VarDeclarator*>*& v, const location_type& l)
+                typename Base::kind_type t, const FE::AST::NodeList<FE::AST::VarDeclarator>*& v, const location_type& l)
                 : Base(t), value(v), location(l)
             {}
 #endif
@@ -1131,23 +1131,23 @@ namespace FE
 
                     case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
                     case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                        value.template destroy<std::vector<FE::AST::ExprNode*>*>();
+                        value.template destroy<FE::AST::NodeList<FE::AST::ExprNode>*>();
                         break;
 
                     case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                        value.template destroy<std::vector<FE::AST::InitDecl*>*>();
+                        value.template destroy<FE::AST::NodeList<FE::AST::InitDecl>*>();
                         break;
 
                     case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                        value.template destroy<std::vector<FE::AST::ParamDeclarator*>*>();
+                        value.template destroy<FE::AST::NodeList<FE::AST::ParamDeclarator>*>();
                         break;
 
                     case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                        value.template destroy<std::vector<FE::AST::StmtNode*>*>();
+                        value.template destroy<FE::AST::NodeList<FE::AST::StmtNode>*>();
                         break;
 
                     case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                        value.template destroy<std::vector<FE::AST::VarDeclarator*>*>();
+                        value.template destroy<FE::AST::NodeList<FE::AST::VarDeclarator>*>();
                         break;
 
                     default: break;
@@ -2423,23 +2423,23 @@ namespace FE
 
             case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
             case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                value.copy<std::vector<FE::AST::ExprNode*>*>(YY_MOVE(that.value));
+                value.copy<FE::AST::NodeList<FE::AST::ExprNode>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                value.copy<std::vector<FE::AST::InitDecl*>*>(YY_MOVE(that.value));
+                value.copy<FE::AST::NodeList<FE::AST::InitDecl>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                value.copy<std::vector<FE::AST::ParamDeclarator*>*>(YY_MOVE(that.value));
+                value.copy<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                value.copy<std::vector<FE::AST::StmtNode*>*>(YY_MOVE(that.value));
+                value.copy<FE::AST::NodeList<FE::AST::StmtNode>*>(YY_MOVE(that.value));
                 break;
 
             case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                value.copy<std::vector<FE::AST::VarDeclarator*>*>(YY_MOVE(that.value));
+                value.copy<FE::AST::NodeList<FE::AST::VarDeclarator>*>(YY_MOVE(that.value));
                 break;
 
             default: break;
@@ -2546,23 +2546,23 @@ namespace FE
 
             case symbol_kind::S_EXPR_LIST:                  // EXPR_LIST
             case symbol_kind::S_ARRAY_DIMENSION_EXPR_LIST:  // ARRAY_DIMENSION_EXPR_LIST
-                value.move<std::vector<FE::AST::ExprNode*>*>(YY_MOVE(s.value));
+                value.move<FE::AST::NodeList<FE::AST::ExprNode>*>(YY_MOVE(s.value));
                 break;
 
             case symbol_kind::S_INITIALIZER_LIST:  // INITIALIZER_LIST
-                value.move<std::vector<FE::AST::InitDecl*>*>(YY_MOVE(s.value));
+                value.move<FE::AST::NodeList<FE::AST::InitDecl>*>(YY_MOVE(s.value));
                 break;
 
             case symbol_kind::S_PARAM_DECLARATOR_LIST:  // PARAM_DECLARATOR_LIST
-                value.move<std::vector<FE::AST::ParamDeclarator*>*>(YY_MOVE(s.value));
+                value.move<FE::AST::NodeList<FE::AST::ParamDeclarator>*>(YY_MOVE(s.value));
                 break;
 
             case symbol_kind::S_STMT_LIST:  // STMT_LIST
-                value.move<std::vector<FE::AST::StmtNode*>*>(YY_MOVE(s.value));
+                value.move<FE::AST::NodeList<FE::AST::StmtNode>*>(YY_MOVE(s.value));
                 break;
 
             case symbol_kind::S_VAR_DECLARATOR_LIST:  // VAR_DECLARATOR_LIST
-                value.move<std::vector<FE::AST::VarDeclarator*>*>(YY_MOVE(s.value));
+                value.move<FE::AST::NodeList<FE::AST::VarDeclarator>*>(YY_MOVE(s.value));
                 break;
 
             default: break;
@@ -128,12 +128,12 @@
 %nterm <FE::AST::Operator> UNARY_OP
 %nterm <FE::AST::Type*> TYPE
 %nterm <FE::AST::InitDecl*> INITIALIZER
-%nterm <std::vector<FE::AST::InitDecl*>*> INITIALIZER_LIST
+%nterm <FE::AST::NodeList<FE::AST::InitDecl>*> INITIALIZER_LIST
 %nterm <FE::AST::VarDeclarator*> VAR_DECLARATOR
-%nterm <std::vector<FE::AST::VarDeclarator*>*> VAR_DECLARATOR_LIST
+%nterm <FE::AST::NodeList<FE::AST::VarDeclarator>*> VAR_DECLARATOR_LIST
 %nterm <FE::AST::VarDeclaration*> VAR_DECLARATION
 %nterm <FE::AST::ParamDeclarator*> PARAM_DECLARATOR
-%nterm <std::vector<FE::AST::ParamDeclarator*>*> PARAM_DECLARATOR_LIST
+%nterm <FE::AST::NodeList<FE::AST::ParamDeclarator>*> PARAM_DECLARATOR_LIST
 
 %nterm <FE::AST::ExprNode*> LITERAL_EXPR
 %nterm <FE::AST::ExprNode*> BASIC_EXPR
@@ -148,10 +148,10 @@
 %nterm <FE::AST::ExprNode*> ASSIGN_EXPR
 %nterm <FE::AST::ExprNode*> NOCOMMA_EXPR
 %nterm <FE::AST::ExprNode*> EXPR
-%nterm <std::vector<FE::AST::ExprNode*>*> EXPR_LIST
+%nterm <FE::AST::NodeList<FE::AST::ExprNode>*> EXPR_LIST
 
 %nterm <FE::AST::ExprNode*> ARRAY_DIMENSION_EXPR
-%nterm <std::vector<FE::AST::ExprNode*>*> ARRAY_DIMENSION_EXPR_LIST
+%nterm <FE::AST::NodeList<FE::AST::ExprNode>*> ARRAY_DIMENSION_EXPR_LIST
 %nterm <FE::AST::ExprNode*> LEFT_VAL_EXPR
 
 %nterm <FE::AST::StmtNode*> EXPR_STMT
@@ -167,7 +167,7 @@
 %nterm <FE::AST::StmtNode*> FUNC_BODY
 %nterm <FE::AST::StmtNode*> STMT
 
-%nterm <std::vector<FE::AST::StmtNode*>*> STMT_LIST
+%nterm <FE::AST::NodeList<FE::AST::StmtNode>*> STMT_LIST
 %nterm <FE::AST::Root*> PROGRAM
 
 %start PROGRAM
@@ -187,7 +187,7 @@
 //语法树匹配从这里开始
 PROGRAM:
     STMT_LIST {
-        $$ = new Root($1);
+        $$ = new (parser.arena()) Root($1);
         parser.ast = $$;
     }
     | PROGRAM END {
@@ -197,7 +197,7 @@ PROGRAM:
 
 STMT_LIST:
     STMT {
-        $$ = new std::vector<StmtNode*>();
+        $$ = parser.newList<StmtNode>();
         if ($1) $$->push_back($1);
     }
     | STMT_LIST STMT {
@@ -248,28 +248,28 @@ STMT:
 
 CONTINUE_STMT:
     CONTINUE SEMICOLON {
-        $$ = new ContinueStmt(@1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ContinueStmt(@1.begin.line, @1.begin.column);
     }
     ;
 
 EXPR_STMT:
     EXPR SEMICOLON {
-        $$ = new ExprStmt($1, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ExprStmt($1, @1.begin.line, @1.begin.column);
     }
     ;
 
 VAR_DECLARATION:
     TYPE VAR_DECLARATOR_LIST {
-        $$ = new VarDeclaration($1, $2, false, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) VarDeclaration($1, $2, false, @1.begin.line, @1.begin.column);
     }
     | CONST TYPE VAR_DECLARATOR_LIST {
-        $$ = new VarDeclaration($2, $3, true, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) VarDeclaration($2, $3, true, @1.begin.line, @1.begin.column);
     }
     ;
 
 VAR_DECL_STMT:
     VAR_DECLARATION SEMICOLON {
-        $$ = new VarDeclStmt($1, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) VarDeclStmt($1, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -277,15 +277,15 @@ VAR_DECL_STMT:
 
 FUNC_BODY:
     LBRACE RBRACE {
-        auto vec = new std::vector<StmtNode*>();
-        $$ = new BlockStmt(vec, @1.begin.line, @1.begin.column);
+        auto vec = parser.newList<StmtNode>();
+        $$ = new (parser.arena()) BlockStmt(vec, @1.begin.line, @1.begin.column);
     }
     | LBRACE STMT_LIST RBRACE {
         if (!$2) {
-            auto vec = new std::vector<StmtNode*>();
-            $$ = new BlockStmt(vec, @1.begin.line, @1.begin.column);
+            auto vec = parser.newList<StmtNode>();
+            $$ = new (parser.arena()) BlockStmt(vec, @1.begin.line, @1.begin.column);
         } else {
-            $$ = new BlockStmt($2, @1.begin.line, @1.begin.column);
+            $$ = new (parser.arena()) BlockStmt($2, @1.begin.line, @1.begin.column);
         }
     }
     ;
@@ -293,68 +293,68 @@ FUNC_BODY:
 FUNC_DECL_STMT:
     TYPE IDENT LPAREN PARAM_DECLARATOR_LIST RPAREN FUNC_BODY {
         Entry* entry = Entry::getEntry($2);
-        $$ = new FuncDeclStmt($1, entry, $4, $6, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) FuncDeclStmt($1, entry, $4, $6, @1.begin.line, @1.begin.column);
     }
     ;
 
 FOR_STMT:
     FOR LPAREN VAR_DECLARATION SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT {
-        VarDeclStmt* initStmt = new VarDeclStmt($3, @3.begin.line, @3.begin.column);
-        $$ = new ForStmt(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
+        VarDeclStmt* initStmt = new (parser.arena()) VarDeclStmt($3, @3.begin.line, @3.begin.column);
+        $$ = new (parser.arena()) ForStmt(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
     }
     | FOR LPAREN EXPR SEMICOLON EXPR SEMICOLON EXPR RPAREN STMT {
-        StmtNode* initStmt = new ExprStmt($3, $3->line_num, $3->col_num);
-        $$ = new ForStmt(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
+        StmtNode* initStmt = new (parser.arena()) ExprStmt($3, $3->line_num, $3->col_num);
+        $$ = new (parser.arena()) ForStmt(initStmt, $5, $7, $9, @1.begin.line, @1.begin.column);
     }
     ;
 
 IF_STMT:
     IF LPAREN EXPR RPAREN STMT %prec THEN {
-        $$ = new IfStmt($3, $5, nullptr, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) IfStmt($3, $5, nullptr, @1.begin.line, @1.begin.column);
     }
     | IF LPAREN EXPR RPAREN STMT ELSE STMT {
-        $$ = new IfStmt($3, $5, $7, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) IfStmt($3, $5, $7, @1.begin.line, @1.begin.column);
     }
     ;
 
 RETURN_STMT:
     RETURN SEMICOLON {
-        $$ = new ReturnStmt(nullptr, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ReturnStmt(nullptr, @1.begin.line, @1.begin.column);
     }
     | RETURN EXPR SEMICOLON {
-        $$ = new ReturnStmt($2, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ReturnStmt($2, @1.begin.line, @1.begin.column);
     }
     ;
 
 WHILE_STMT:
     WHILE LPAREN EXPR RPAREN STMT {
-        $$ = new WhileStmt($3, $5, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) WhileStmt($3, $5, @1.begin.line, @1.begin.column);
     }
     ;
 
 BREAK_STMT:
     BREAK SEMICOLON {
-        $$ = new BreakStmt(@1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BreakStmt(@1.begin.line, @1.begin.column);
     }
     ;
 
 CONTINUE_STMT:
     CONTINUE SEMICOLON {
-        $$ = new ContinueStmt(@1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ContinueStmt(@1.begin.line, @1.begin.column);
     }
     ;
 
 BLOCK_STMT:
     LBRACE RBRACE {
-        auto vec = new std::vector<StmtNode*>();
-        $$ = new BlockStmt(vec, @1.begin.line, @1.begin.column);
+        auto vec = parser.newList<StmtNode>();
+        $$ = new (parser.arena()) BlockStmt(vec, @1.begin.line, @1.begin.column);
     }
     | LBRACE STMT_LIST RBRACE {
         if (!$2) {
-            auto vec = new std::vector<StmtNode*>();
-            $$ = new BlockStmt(vec, @1.begin.line, @1.begin.column);
+            auto vec = parser.newList<StmtNode>();
+            $$ = new (parser.arena()) BlockStmt(vec, @1.begin.line, @1.begin.column);
         } else {
-            $$ = new BlockStmt($2, @1.begin.line, @1.begin.column);
+            $$ = new (parser.arena()) BlockStmt($2, @1.begin.line, @1.begin.column);
         }
     }
     ;
@@ -364,21 +364,21 @@ PARAM_DECLARATOR:
     TYPE IDENT
     {
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, nullptr, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ParamDeclarator($1, entry, nullptr, @1.begin.line, @1.begin.column);
     }
     | TYPE IDENT LBRACKET RBRACKET
     {
-        std::vector<ExprNode*>* dim = new std::vector<ExprNode*>();
-        dim->emplace_back(new LiteralExpr(-1, @3.begin.line, @3.begin.column));
+        NodeList<ExprNode>* dim = parser.newList<ExprNode>();
+        dim->emplace_back(new (parser.arena()) LiteralExpr(-1, @3.begin.line, @3.begin.column));
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, dim, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ParamDeclarator($1, entry, dim, @1.begin.line, @1.begin.column);
     }
     //TODO(Lab2)：考虑函数形参更多情况
     //匹配 int a[10]
     | TYPE IDENT ARRAY_DIMENSION_EXPR_LIST
     {
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ParamDeclarator($1, entry, $3, @1.begin.line, @1.begin.column);
     }
     |
     // 匹配 int a[][10]
@@ -386,9 +386,9 @@ PARAM_DECLARATOR:
     {
         /* 第一维空 []，后面跟剩余维度 */
         $5->insert($5->begin(),
-                   new LiteralExpr(-1, @3.begin.line, @3.begin.column));
+                   new (parser.arena()) LiteralExpr(-1, @3.begin.line, @3.begin.column));
         Entry* entry = Entry::getEntry($2);
-        $$ = new ParamDeclarator($1, entry, $5, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) ParamDeclarator($1, entry, $5, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -396,11 +396,11 @@ PARAM_DECLARATOR:
 
 PARAM_DECLARATOR_LIST:
     /* empty */ {
-        $$ = new std::vector<ParamDeclarator*>();
+        $$ = parser.newList<ParamDeclarator>();
     }
     |
     PARAM_DECLARATOR {
-        $$ = new std::vector<ParamDeclarator*>();
+        $$ = parser.newList<ParamDeclarator>();
         $$->push_back($1);
     }
     | PARAM_DECLARATOR_LIST COMMA PARAM_DECLARATOR {
@@ -411,17 +411,17 @@ PARAM_DECLARATOR_LIST:
 
 VAR_DECLARATOR:
     LEFT_VAL_EXPR {
-        $$ = new VarDeclarator($1, nullptr, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) VarDeclarator($1, nullptr, @1.begin.line, @1.begin.column);
     }
     // 有初始值的情况
     | LEFT_VAL_EXPR ASSIGN INITIALIZER {
-        $$ = new VarDeclarator($1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) VarDeclarator($1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 
 VAR_DECLARATOR_LIST:
     VAR_DECLARATOR {
-        $$ = new std::vector<VarDeclarator*>();
+        $$ = parser.newList<VarDeclarator>();
         $$->push_back($1);
     }
     | VAR_DECLARATOR_LIST COMMA VAR_DECLARATOR {
@@ -432,17 +432,17 @@ VAR_DECLARATOR_LIST:
 
 INITIALIZER:
     ASSIGN_EXPR {
-        $$ = new Initializer($1, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) Initializer($1, @1.begin.line, @1.begin.column);
     }
     // 匹配一个初始化列表作为初始值
     | LBRACE INITIALIZER_LIST RBRACE {
-        $$ = new InitializerList($2, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) InitializerList($2, @1.begin.line, @1.begin.column);
     }
     ;
 
 INITIALIZER_LIST:
     INITIALIZER {
-        $$ = new std::vector<InitDecl*>();
+        $$ = parser.newList<InitDecl>();
         $$->push_back($1);
     }
     | INITIALIZER_LIST COMMA INITIALIZER {
@@ -456,13 +456,13 @@ ASSIGN_EXPR:
         $$ = $1;
     }
     | LEFT_VAL_EXPR ASSIGN ASSIGN_EXPR {
-        $$ = new BinaryExpr(Operator::ASSIGN, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::ASSIGN, $1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 
 EXPR_LIST:
     NOCOMMA_EXPR {
-        $$ = new std::vector<ExprNode*>();
+        $$ = parser.newList<ExprNode>();
         $$->push_back($1);
     }
     | EXPR_LIST COMMA NOCOMMA_EXPR {
@@ -481,10 +481,10 @@ EXPR:
             ce->exprs->push_back($3);
             $$ = ce;
         } else {
-            auto vec = new std::vector<ExprNode*>();
+            auto vec = parser.newList<ExprNode>();
             vec->push_back($1);
             vec->push_back($3);
-            $$ = new CommaExpr(vec, $1->line_num, $1->col_num);
+            $$ = new (parser.arena()) CommaExpr(vec, $1->line_num, $1->col_num);
         }
     }
     ;
@@ -502,7 +502,7 @@ LOGICAL_OR_EXPR:
         $$ = $1;
     }
     | LOGICAL_OR_EXPR OR LOGICAL_AND_EXPR {
-        $$ = new BinaryExpr(Operator::OR, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::OR, $1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 LOGICAL_AND_EXPR:
@@ -511,7 +511,7 @@ LOGICAL_AND_EXPR:
         $$ = $1;
     }
     | LOGICAL_AND_EXPR AND LOGICAL_AND_EXPR {
-        $$ = new BinaryExpr(Operator::AND, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::AND, $1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 EQUALITY_EXPR:
@@ -520,10 +520,10 @@ EQUALITY_EXPR:
         $$ = $1;
     }
     | EQUALITY_EXPR EQ EQUALITY_EXPR {
-        $$ = new BinaryExpr(Operator::EQ, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::EQ, $1, $3, @1.begin.line, @1.begin.column);
     }
     | EQUALITY_EXPR NEQ EQUALITY_EXPR {
-        $$ = new BinaryExpr(Operator::NEQ, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::NEQ, $1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 RELATIONAL_EXPR:
@@ -533,16 +533,16 @@ RELATIONAL_EXPR:
         $$ = $1;
     }
     | RELATIONAL_EXPR GT RELATIONAL_EXPR {
-        $$ = new BinaryExpr(Operator::GT, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::GT, $1, $3, @1.begin.line, @1.begin.column);
     }
     | RELATIONAL_EXPR GE RELATIONAL_EXPR {
-        $$ = new BinaryExpr(Operator::GE, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::GE, $1, $3, @1.begin.line, @1.begin.column);
     }
     | RELATIONAL_EXPR LT RELATIONAL_EXPR {
-        $$ = new BinaryExpr(Operator::LT, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::LT, $1, $3, @1.begin.line, @1.begin.column);
     }
     | RELATIONAL_EXPR LE RELATIONAL_EXPR {
-        $$ = new BinaryExpr(Operator::LE, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::LE, $1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 ADDSUB_EXPR:
@@ -552,10 +552,10 @@ ADDSUB_EXPR:
         $$ = $1;
     }
     | ADDSUB_EXPR PLUS ADDSUB_EXPR {
-        $$ = new BinaryExpr(Operator::ADD, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::ADD, $1, $3, @1.begin.line, @1.begin.column);
     }
     | ADDSUB_EXPR MINUS ADDSUB_EXPR {
-        $$ = new BinaryExpr(Operator::SUB, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::SUB, $1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 MULDIV_EXPR:
@@ -565,14 +565,14 @@ MULDIV_EXPR:
         $$ = $1;
     }
     | MULDIV_EXPR MUL MULDIV_EXPR {
-        $$ = new BinaryExpr(Operator::MUL, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::MUL, $1, $3, @1.begin.line, @1.begin.column);
     }
     | MULDIV_EXPR DIV MULDIV_EXPR {
-        $$ = new BinaryExpr(Operator::DIV, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::DIV, $1, $3, @1.begin.line, @1.begin.column);
     }
     // 取模运算优先级和乘除一致
     | MULDIV_EXPR MOD MULDIV_EXPR {
-        $$ = new BinaryExpr(Operator::MOD, $1, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) BinaryExpr(Operator::MOD, $1, $3, @1.begin.line, @1.begin.column);
     }
     ;
 UNARY_EXPR:
@@ -580,7 +580,7 @@ UNARY_EXPR:
         $$ = $1;
     }
     | UNARY_OP UNARY_EXPR {
-        $$ = new UnaryExpr($1, $2, $2->line_num, $2->col_num);
+        $$ = new (parser.arena()) UnaryExpr($1, $2, $2->line_num, $2->col_num);
     }
     ;
 
@@ -605,19 +605,19 @@ FUNC_CALL_EXPR:
         if (funcName != "starttime" && funcName != "stoptime")
         {
             Entry* entry = Entry::getEntry(funcName);
-            $$ = new CallExpr(entry, nullptr, @1.begin.line, @1.begin.column);
+            $$ = new (parser.arena()) CallExpr(entry, nullptr, @1.begin.line, @1.begin.column);
         }
         else
         {    
             funcName = "_sysy_" + funcName;
-            std::vector<ExprNode*>* args = new std::vector<ExprNode*>();
-            args->emplace_back(new LiteralExpr(static_cast<int>(@1.begin.line), @1.begin.line, @1.begin.column));
-            $$ = new CallExpr(Entry::getEntry(funcName), args, @1.begin.line, @1.begin.column);
+            NodeList<ExprNode>* args = parser.newList<ExprNode>();
+            args->emplace_back(new (parser.arena()) LiteralExpr(static_cast<int>(@1.begin.line), @1.begin.line, @1.begin.column));
+            $$ = new (parser.arena()) CallExpr(Entry::getEntry(funcName), args, @1.begin.line, @1.begin.column);
         }
     }
     | IDENT LPAREN EXPR_LIST RPAREN {
         Entry* entry = Entry::getEntry($1);
-        $$ = new CallExpr(entry, $3, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) CallExpr(entry, $3, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -629,7 +629,7 @@ ARRAY_DIMENSION_EXPR:
 
 ARRAY_DIMENSION_EXPR_LIST:
       ARRAY_DIMENSION_EXPR {
-          $$ = new std::vector<ExprNode*>();
+          $$ = parser.newList<ExprNode>();
           $$->push_back($1);
       }
     | ARRAY_DIMENSION_EXPR_LIST ARRAY_DIMENSION_EXPR {
@@ -642,23 +642,23 @@ ARRAY_DIMENSION_EXPR_LIST:
 LEFT_VAL_EXPR:
     IDENT {
         Entry* entry = Entry::getEntry($1);
-        $$ = new LeftValExpr(entry, nullptr, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) LeftValExpr(entry, nullptr, @1.begin.line, @1.begin.column);
     }
     | IDENT ARRAY_DIMENSION_EXPR_LIST {
         Entry* entry = Entry::getEntry($1);
-        $$ = new LeftValExpr(entry, $2, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) LeftValExpr(entry, $2, @1.begin.line, @1.begin.column);
     }
     ;
 
 LITERAL_EXPR:
     INT_CONST {
-        $$ = new LiteralExpr((int)$1, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) LiteralExpr((int)$1, @1.begin.line, @1.begin.column);
     }
     | FLOAT_CONST {
-        $$ = new LiteralExpr((float)$1, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) LiteralExpr((float)$1, @1.begin.line, @1.begin.column);
     }
     | LL_CONST {
-        $$ = new LiteralExpr((long long)$1, @1.begin.line, @1.begin.column);
+        $$ = new (parser.arena()) LiteralExpr((long long)$1, @1.begin.line, @1.begin.column);
     }
     ;
 
@@ -1,81 +1,76 @@
 #include <frontend/symbol/symbol_table.h>
 #include <debug.h>
-#include <map>
 
 namespace FE::Sym
 {
-    //ջʽ���ű�
-    struct Scope
-    {
-        std::map<Entry*, FE::AST::VarAttr> symbols;     //��ǰ������
-        Scope* parent;                                  //ָ���������ָ��
-        Scope(Scope* p = nullptr) : parent(p) {}
-    };
-
-    // ��ǰ������ָ��
-    static Scope* currentScope = nullptr;
-
-    //���÷��ű�
+    // 重置符号表
     void SymTable::reset_impl()
     {
-        while (currentScope) {
-            Scope* tmp = currentScope;
-            currentScope = currentScope->parent;
-            delete tmp;
-        }
+        bindings.clear();
+        top.clear();
+        scopeMarks.clear();
     }
 
-    //������������
-    void SymTable::enterScope_impl()
-    {
-        currentScope = new Scope(currentScope);
-    }
+    // 进入新作用域
+    void SymTable::enterScope_impl() { scopeMarks.push_back(bindings.size()); }
 
-    //�˳���ǰ������
+    // 退出当前作用域：逆序弹出本层绑定，恢复被遮蔽的外层绑定
     void SymTable::exitScope_impl()
     {
-        if (currentScope) {
-            Scope* tmp = currentScope;
-            currentScope = currentScope->parent;
-            delete tmp;
+        if (scopeMarks.empty()) return;
+
+        size_t mark = scopeMarks.back();
+        scopeMarks.pop_back();
+        while (bindings.size() > mark)
+        {
+            const Binding& b = bindings.back();
+            if (b.prev < 0)
+                top.erase(b.entry);
+            else
+                top[b.entry] = b.prev;
+            bindings.pop_back();
         }
     }
 
-    //���ӷ��ŵ���ǰ������
-    void SymTable::addSymbol_impl(Entry* entry, FE::AST::VarAttr& attr)
+    // 添加符号到当前作用域
+    FE::AST::VarAttr* SymTable::addSymbol_impl(Entry* entry, FE::AST::VarAttr&& attr)
     {
-        if (currentScope) {
-            currentScope->symbols[entry] = attr;
+        if (scopeMarks.empty()) return nullptr;
+
+        int  idx           = static_cast<int>(bindings.size());
+        auto [it, created] = top.try_emplace(entry, idx);
+        int  prev          = created ? -1 : it->second;
+
+        // 同一作用域内重复添加时覆盖原属性，不产生新的遮蔽层
+        if (prev >= 0 && static_cast<size_t>(prev) >= scopeMarks.back())
+        {
+            bindings[prev].attr = std::move(attr);
+            return &bindings[prev].attr;
         }
+
+        it->second = idx;
+        bindings.push_back(Binding{entry, prev, std::move(attr)});
+        return &bindings.back().attr;
     }
 
-    //��ȡ��������
+    // 获取符号属性
     FE::AST::VarAttr* SymTable::getSymbol_impl(Entry* entry)
     {
-        Scope* scope = currentScope;
-        while (scope) {
-            auto it = scope->symbols.find(entry);
-            if (it != scope->symbols.end()) {
-                return &it->second;
-            }
-            scope = scope->parent;
-        }
-        return nullptr;
+        auto it = top.find(entry);
+        if (it == top.end()) return nullptr;
+        return &bindings[it->second].attr;
     }
 
-    bool SymTable::isGlobalScope_impl()
-    {
-        return currentScope && currentScope->parent == nullptr;
-    }
+    bool SymTable::isGlobalScope_impl() { return scopeMarks.size() == 1; }
+
+    int SymTable::getScopeDepth_impl() { return static_cast<int>(scopeMarks.size()); }
 
-    int SymTable::getScopeDepth_impl()
+    void SymTable::releaseGlobals_impl(std::map<Entry*, FE::AST::VarAttr>& out)
     {
-        int depth = 0;
-        Scope* scope = currentScope;
-        while (scope) {
-            depth++;
-            scope = scope->parent;
-        }
-        return depth;
+        if (scopeMarks.empty()) return;
+
+        // 全局作用域的绑定位于栈底 [0, scopeMarks[1])，此时通常只剩全局作用域
+        size_t end = scopeMarks.size() > 1 ? scopeMarks[1] : bindings.size();
+        for (size_t i = 0; i < end; ++i) out[bindings[i].entry] = std::move(bindings[i].attr);
     }
 }  // namespace FE::Sym
@@ -2,23 +2,46 @@
 #define __FRONTEND_SYMBOL_SYMBOL_TABLE_H__
 
 #include <frontend/symbol/isymbol_table.h>
-#include <map>
+#include <deque>
+#include <unordered_map>
+#include <vector>
 
 namespace FE::Sym
 {
+    /*
+     * 作用域哈希表：
+     * - 所有作用域的符号按声明顺序压在同一个 bindings 栈上，属性只存这一份，外部通过指针引用
+     * - 每个 Entry 在 top 中记录最内层的绑定，绑定的 prev 指向被它遮蔽的外层绑定，
+     *   因此查找只需一次哈希，与嵌套深度无关
+     * - 退出作用域时只弹出本作用域的绑定并恢复 top，代价与该作用域内的符号数成正比
+     */
     class SymTable : public iSymTable<SymTable>
     {
         friend iSymTable<SymTable>;
 
+        struct Binding
+        {
+            Entry*           entry;
+            int              prev;  // 被遮蔽的外层绑定下标，-1 表示无
+            FE::AST::VarAttr attr;
+        };
+
+        // deque 两端增删不会使已有元素的引用失效，getSymbol 返回的指针在绑定弹出前一直有效
+        std::deque<Binding>             bindings;
+        std::unordered_map<Entry*, int> top;
+        std::vector<size_t>             scopeMarks;  // 每层作用域开始时 bindings 的大小
+
         void reset_impl();
 
-        void              addSymbol_impl(Entry* entry, FE::AST::VarAttr& attr);
+        FE::AST::VarAttr* addSymbol_impl(Entry* entry, FE::AST::VarAttr&& attr);
         FE::AST::VarAttr* getSymbol_impl(Entry* entry);
         void              enterScope_impl();
         void              exitScope_impl();
 
         bool isGlobalScope_impl();
         int  getScopeDepth_impl();
+
+        void releaseGlobals_impl(std::map<Entry*, FE::AST::VarAttr>& out);
     };
 }  // namespace FE::Sym
 
@@ -6,6 +6,9 @@
 #include <vector>
 #include <array>
 #include <map>
+#include <algorithm>
+#include <cstring>
+#include <utility>
 
 #define AST_TYPEGROUP_DECL  \
     X(BASIC, basic type, 0) \
@@ -214,6 +217,71 @@ namespace FE::AST
         }
     };
 
+    /*
+     * 数组初始值的稀疏表示：按行优先展开后，只保存显式给出的元素及其下标（下标严格递增），
+     * 其余位置一律为 0。int a[1000000] = {1}; 只占一个元素，前端、IR 与后端都按此结构传递。
+     * 标量常量同样用它保存唯一的初始值（下标 0）
+     */
+    class SparseInitList
+    {
+      public:
+        using Item           = std::pair<size_t, VarValue>;
+        using const_iterator = std::vector<Item>::const_iterator;
+
+      private:
+        std::vector<Item> items;
+
+      public:
+        // idx 必须大于已有元素的最大下标
+        void set(size_t idx, const VarValue& v)
+        {
+            ASSERT((items.empty() || idx > items.back().first) && "SparseInitList indices must increase");
+            items.emplace_back(idx, v);
+        }
+        void push_back(const VarValue& v) { set(items.empty() ? 0 : items.back().first + 1, v); }
+        void reserve(size_t n) { items.reserve(n); }
+
+        bool            empty() const { return items.empty(); }
+        size_t          size() const { return items.size(); }  // 显式元素个数，不是数组长度
+        const VarValue& front() const { return items.front().second; }
+
+        const_iterator begin() const { return items.begin(); }
+        const_iterator end() const { return items.end(); }
+        // 第一个下标不小于 idx 的元素
+        const_iterator lowerBound(size_t idx) const
+        {
+            return std::lower_bound(
+                items.begin(), items.end(), idx, [](const Item& it, size_t i) { return it.first < i; });
+        }
+
+        // idx 处的值，未显式给出时为 int 0
+        VarValue at(size_t idx) const
+        {
+            auto it = lowerBound(idx);
+            return it != items.end() && it->first == idx ? it->second : VarValue(0);
+        }
+        // [begin, end) 中是否存在比特位不全为 0 的元素（-0.0f 不算零）
+        bool hasNonZero(size_t begin, size_t end) const
+        {
+            for (auto it = lowerBound(begin); it != items.end() && it->first < end; ++it)
+                if (!isZero(it->second)) return true;
+            return false;
+        }
+
+        static bool isZero(const VarValue& v)
+        {
+            if (v.type == floatType)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &v.floatValue, sizeof(bits));
+                return bits == 0;
+            }
+            if (v.type == llType) return v.llValue == 0;
+            if (v.type == boolType) return !v.boolValue;
+            return v.intValue == 0;
+        }
+    };
+
     struct ExprValue
     {
         VarValue value;
@@ -239,7 +307,7 @@ namespace FE::AST
         int   scopeLevel;
 
         std::vector<int>      arrayDims;
-        std::vector<VarValue> initList;
+        SparseInitList        initList;
 
         VarAttr() : isConstDecl(false), type(voidType), scopeLevel(-1), arrayDims(), initList() {}
         VarAttr(Type* t, bool isConst = false, int level = -1)
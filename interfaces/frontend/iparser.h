@@ -28,8 +28,8 @@ namespace FE
         void setOutStream(std::ostream* outStream) { this->outStream = outStream; }
 
       public:
-        std::vector<Token> parseTokens() { return static_cast<Derived*>(this)->parseTokens_impl(); }
-        AST::Root*         parseAST() { return static_cast<Derived*>(this)->parseAST_impl(); }
+        TokenList  parseTokens() { return static_cast<Derived*>(this)->parseTokens_impl(); }
+        AST::Root* parseAST() { return static_cast<Derived*>(this)->parseAST_impl(); }
     };
 }  // namespace FE
 
@@ -3,6 +3,7 @@
 
 #include <frontend/ast/ast_defs.h>
 #include <frontend/symbol/symbol_entry.h>
+#include <map>
 
 namespace FE::Sym
 {
@@ -16,7 +17,11 @@ namespace FE::Sym
       public:
         void reset() { static_cast<Derived*>(this)->reset_impl(); }
 
-        void addSymbol(Entry* entry, AST::VarAttr& attr) { static_cast<Derived*>(this)->addSymbol_impl(entry, attr); }
+        // 属性移入符号表，返回表内的那一份（在其所在作用域退出前有效）
+        AST::VarAttr* addSymbol(Entry* entry, AST::VarAttr&& attr)
+        {
+            return static_cast<Derived*>(this)->addSymbol_impl(entry, std::move(attr));
+        }
         AST::VarAttr* getSymbol(Entry* entry) { return static_cast<Derived*>(this)->getSymbol_impl(entry); }
 
         void enterScope() { static_cast<Derived*>(this)->enterScope_impl(); }
@@ -24,6 +29,12 @@ namespace FE::Sym
 
         bool isGlobalScope() { return static_cast<Derived*>(this)->isGlobalScope_impl(); }
         int  getScopeDepth() { return static_cast<Derived*>(this)->getScopeDepth_impl(); }
+
+        // 把全局作用域中的符号属性移出到 out，之后表中这些属性不再可用，只应在检查结束时调用
+        void releaseGlobals(std::map<Entry*, AST::VarAttr>& out)
+        {
+            static_cast<Derived*>(this)->releaseGlobals_impl(out);
+        }
     };
 }  // namespace FE::Sym
 
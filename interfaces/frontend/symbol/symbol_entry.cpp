@@ -3,9 +3,11 @@ using namespace std;
 using namespace FE::Sym;
 
 unordered_map<string, Entry*> Entry::entryMap;
+mutex                         Entry::entryMapMutex;
 
 void Entry::clear()
 {
+    lock_guard<mutex> lock(entryMapMutex);
     for (auto& [name, entry] : entryMap)
     {
         if (!entry) continue;
@@ -17,8 +19,10 @@ void Entry::clear()
 
 Entry* Entry::getEntry(string name)
 {
-    if (entryMap.find(name) == entryMap.end()) entryMap[name] = new Entry(name);
-    return entryMap[name];
+    lock_guard<mutex> lock(entryMapMutex);
+    auto              it = entryMap.find(name);
+    if (it == entryMap.end()) it = entryMap.emplace(name, new Entry(name)).first;
+    return it->second;
 }
 
 Entry::Entry(string name) : name(name) {}
@@ -1,6 +1,7 @@
 #ifndef __FRONTEND_SYMBOL_SYMBOL_ENTRY_H__
 #define __FRONTEND_SYMBOL_SYMBOL_ENTRY_H__
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -12,6 +13,7 @@ namespace FE::Sym
 
       private:
         static std::unordered_map<std::string, Entry*> entryMap;
+        static std::mutex                              entryMapMutex;  // getEntry 可能被多个线程同时调用
         static void                                    clear();
 
       public:
@@ -1,18 +1,22 @@
 #ifndef __INTERFACES_FRONTEND_TOKEN_H__
 #define __INTERFACES_FRONTEND_TOKEN_H__
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace FE
 {
-    struct Token
+    /*
+     * 词法分析的结果（-lexer 输出用），按列存放（struct of arrays）：
+     * - 词素与字符串属性都是 buffer() 中的 [offset, offset + length)，不为单个 Token 分配字符串
+     * - 词素取自内存映射的源文件（text）；从 istream 读入时词素与属性依次追加到 ownedText
+     * - Token 名称按 kind 编号存一份在 kindNames 中
+     */
+    struct TokenList
     {
-        std::string token_name;     ///< 词法分析中使用的 token 名称
-        std::string lexeme;         ///< 该 token 的原始文本内容
-        int         line_number;    ///< 该 token 所在的行号
-        int         column_number;  ///< 该 token 所在的列号
-
-        enum class TokenType
+        enum class TokenType : uint8_t
         {
             T_INT,
             T_LL,
@@ -20,15 +24,61 @@ namespace FE
             T_DOUBLE,
             T_STRING,
             T_NONE
-        } type;
-        union
+        };
+
+        struct Span
+        {
+            uint32_t offset;
+            uint32_t length;
+        };
+
+        union Value
         {
             int       ival;
             long long lval;
             float     fval;
             double    dval;
+            Span      sval;  ///< T_STRING：属性值在 text 中的位置
         };
-        std::string sval;
+
+        std::string_view         text;
+        std::string              ownedText;
+        std::vector<std::string> kindNames;
+
+        std::vector<uint16_t>  kinds;    ///< 词法分析中使用的 token 编号，名称见 kindNames
+        std::vector<Span>      lexemes;  ///< 该 token 的原始文本内容
+        std::vector<int>       lines;    ///< 该 token 所在的行号
+        std::vector<int>       columns;  ///< 该 token 所在的列号
+        std::vector<TokenType> types;
+        std::vector<Value>     values;
+
+        size_t size() const { return kinds.size(); }
+        void   reserve(size_t n)
+        {
+            kinds.reserve(n);
+            lexemes.reserve(n);
+            lines.reserve(n);
+            columns.reserve(n);
+            types.reserve(n);
+            values.reserve(n);
+        }
+        void push(uint16_t kind, Span lexeme, int line, int column, TokenType type, Value value)
+        {
+            kinds.push_back(kind);
+            lexemes.push_back(lexeme);
+            lines.push_back(line);
+            columns.push_back(column);
+            types.push_back(type);
+            values.push_back(value);
+        }
+
+        std::string_view name(size_t i) const { return kindNames[kinds[i]]; }
+        std::string_view buffer() const { return ownedText.empty() ? text : std::string_view(ownedText); }
+        std::string_view lexeme(size_t i) const { return buffer().substr(lexemes[i].offset, lexemes[i].length); }
+        std::string_view str(size_t i) const
+        {
+            return buffer().substr(values[i].sval.offset, values[i].sval.length);
+        }
     };
 }  // namespace FE
 
@@ -1,49 +1,60 @@
 #include <middleend/ir_defs.h>
+#include <out_buffer.h>
 
-std::ostream& operator<<(std::ostream& os, ME::DataType dt)
+std::string_view toStringView(ME::DataType dt)
 {
     switch (dt)
     {
 #define X(name, str, val) \
-    case ME::DataType::name: return os << #str;
+    case ME::DataType::name: return #str;
         IR_DATATYPE
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
 
-std::ostream& operator<<(std::ostream& os, ME::Operator op)
+std::string_view toStringView(ME::Operator op)
 {
     switch (op)
     {
 #define X(name, str, val) \
-    case ME::Operator::name: return os << #str;
+    case ME::Operator::name: return #str;
         IR_OPCODE
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
 
-std::ostream& operator<<(std::ostream& os, ME::ICmpOp cop)
+std::string_view toStringView(ME::ICmpOp cop)
 {
     switch (cop)
     {
 #define X(name, str, val) \
-    case ME::ICmpOp::name: return os << #str;
+    case ME::ICmpOp::name: return #str;
         IR_ICMP
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
 
-std::ostream& operator<<(std::ostream& os, ME::FCmpOp cop)
+std::string_view toStringView(ME::FCmpOp cop)
 {
     switch (cop)
     {
 #define X(name, str, val) \
-    case ME::FCmpOp::name: return os << #str;
+    case ME::FCmpOp::name: return #str;
         IR_FCMP
 #undef X
-        default: return os << "unknown";
+        default: return "unknown";
     }
 }
+
+std::ostream& operator<<(std::ostream& os, ME::DataType dt) { return os << toStringView(dt); }
+std::ostream& operator<<(std::ostream& os, ME::Operator op) { return os << toStringView(op); }
+std::ostream& operator<<(std::ostream& os, ME::ICmpOp cop) { return os << toStringView(cop); }
+std::ostream& operator<<(std::ostream& os, ME::FCmpOp cop) { return os << toStringView(cop); }
+
+OutBuffer& operator<<(OutBuffer& out, ME::DataType dt) { return out << toStringView(dt); }
+OutBuffer& operator<<(OutBuffer& out, ME::Operator op) { return out << toStringView(op); }
+OutBuffer& operator<<(OutBuffer& out, ME::ICmpOp cop) { return out << toStringView(cop); }
+OutBuffer& operator<<(OutBuffer& out, ME::FCmpOp cop) { return out << toStringView(cop); }
@@ -3,6 +3,9 @@
 
 #include <iostream>
 #include <map>
+#include <string_view>
+
+class OutBuffer;
 
 #define IR_DATATYPE  \
     X(UNK, unk, 0)   \
@@ -129,9 +132,20 @@ namespace ME
     using LabelMap = std::map<size_t, size_t>;
 }  // namespace ME
 
+// 返回指向静态字符串的名字，不分配内存
+std::string_view toStringView(ME::DataType dt);
+std::string_view toStringView(ME::Operator op);
+std::string_view toStringView(ME::ICmpOp cop);
+std::string_view toStringView(ME::FCmpOp cop);
+
 std::ostream& operator<<(std::ostream& os, ME::DataType dt);
 std::ostream& operator<<(std::ostream& os, ME::Operator op);
 std::ostream& operator<<(std::ostream& os, ME::ICmpOp cop);
 std::ostream& operator<<(std::ostream& os, ME::FCmpOp cop);
 
+OutBuffer& operator<<(OutBuffer& out, ME::DataType dt);
+OutBuffer& operator<<(OutBuffer& out, ME::Operator op);
+OutBuffer& operator<<(OutBuffer& out, ME::ICmpOp cop);
+OutBuffer& operator<<(OutBuffer& out, ME::FCmpOp cop);
+
 #endif  // __INTERFACES_MIDDLEEND_IR_DEFS_H__
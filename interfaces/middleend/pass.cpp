@@ -6,6 +6,6 @@ namespace ME
 {
     void FunctionPass::runOnModule(Module& module)
     {
-        for (auto* function : module.functions) runOnFunction(*function);
+        for (auto* function : module.functions) Analysis::AM.invalidate(*function, runOnFunction(*function));
     }
 }  // namespace ME
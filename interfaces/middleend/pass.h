@@ -1,6 +1,8 @@
 #ifndef __INTERFACES_MIDDLEEND_PASS_H__
 #define __INTERFACES_MIDDLEEND_PASS_H__
 
+#include <middleend/pass/analysis/analysis_manager.h>
+
 namespace ME
 {
     class Module;
@@ -9,12 +11,17 @@ namespace ME
 
 namespace ME
 {
+    using Analysis::PreservedAnalyses;
+
     class Pass
-    {
+    { /*
+       * runOnFunction 返回该 Pass 运行后仍然有效的分析，
+       * 调用者据此通过 AM.invalidate(function, preserved) 只丢弃失效的分析
+       */
       public:
-        virtual ~Pass()                                = default;
-        virtual void runOnModule(Module& module)       = 0;
-        virtual void runOnFunction(Function& function) = 0;
+        virtual ~Pass()                                             = default;
+        virtual void              runOnModule(Module& module)       = 0;
+        virtual PreservedAnalyses runOnFunction(Function& function) = 0;
     };
 
     class ModulePass : public Pass
@@ -22,8 +29,8 @@ namespace ME
        * 全局优化Pass的基类
        */
       public:
-        virtual void runOnModule(Module& module) override       = 0;
-        virtual void runOnFunction(Function& function) override = 0;
+        virtual void              runOnModule(Module& module) override       = 0;
+        virtual PreservedAnalyses runOnFunction(Function& function) override = 0;
     };
 
     class FunctionPass : public Pass
@@ -31,8 +38,8 @@ namespace ME
        * 过程内优化Pass的基类
        */
       public:
-        virtual void runOnModule(Module& module) override;
-        virtual void runOnFunction(Function& function) override = 0;
+        virtual void              runOnModule(Module& module) override;
+        virtual PreservedAnalyses runOnFunction(Function& function) override = 0;
     };
 }  // namespace ME
 
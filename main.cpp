@@ -6,15 +6,18 @@
 
 #include <middleend/visitor/codegen/ast_codegen.h>
 #include <middleend/visitor/printer/module_printer.h>
+#include <middleend/visitor/serializer/ir_serializer.h>
+#include <middleend/visitor/serializer/ir_text_reader.h>
 #include <middleend/module/ir_module.h>
-#include <middleend/pass/unify_return.h>
-#include <middleend/pass/mem2reg.h>
-#include <middleend/pass/dce.h>
-#include <middleend/pass/adce.h>
+#include <middleend/pass/pass_manager.h>
 #include <backend/mir/m_module.h>
 #include <backend/target/registry.h>
 #include <backend/target/target.h>
+#include <backend/target/function_cache.h>
+#include <mapped_file.h>
 
+#include <charconv>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -41,10 +44,167 @@
 
 using namespace std;
 
-string truncateString(const string& str, size_t width)
+string truncateString(string_view str, size_t width)
 {
-    if (str.length() > width) return str.substr(0, width - 3) + "...";
-    return str;
+    if (str.length() > width) return string(str.substr(0, width - 3)) + "...";
+    return string(str);
+}
+
+static double elapsedMs(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// 解析命令行中的正整数：只接受十进制数字，为 0、溢出或超过 maxValue 时返回 false
+static bool parsePositive(const string& value, size_t& result, size_t maxValue = SIZE_MAX)
+{
+    size_t parsed  = 0;
+    auto [end, ec] = from_chars(value.data(), value.data() + value.size(), parsed);
+    if (value.empty() || ec != errc() || end != value.data() + value.size()) return false;
+    if (parsed == 0 || parsed > maxValue) return false;
+    result = parsed;
+    return true;
+}
+
+/*
+ * 中端优化与输出：-llvm 打印 IR，-emit-ir-bin 保存二进制 IR，-S 交给后端生成汇编。
+ * 由 SysY 源码生成的模块与 -load-ir / -load-ir-bin 读入的模块都从这里继续；
+ * timer 非空时中端 Pass 与后端各阶段的耗时都记入其中
+ */
+static int compileModule(ME::Module& m, const string& step, const string& march, int optimizeLevel,
+    const string& passPipeline, ME::PassTimer* timer, ME::CompileBudget* budget, BE::Targeting::FunctionCache* cache,
+    size_t jobs, ostream* outStream)
+{
+    string pipeline = passPipeline.empty() ? ME::getDefaultPipeline(optimizeLevel) : passPipeline;
+
+    // -cache-dir：用优化前的 IR 查找函数缓存，命中的函数暂时移出模块，不参与中端优化，后端直接输出缓存的汇编
+    vector<ME::Function*> allFunctions;
+    if (cache)
+    {
+        cache->setOptions(march + "\n" + pipeline);
+        cache->probe(m);
+        allFunctions = m.functions;
+        m.functions.clear();
+        for (size_t i = 0; i < allFunctions.size(); ++i)
+            if (!cache->isHit(i)) m.functions.push_back(allFunctions[i]);
+    }
+
+    if (optimizeLevel > 0 || !passPipeline.empty())
+    {
+        /*
+         * Lab 4: �м�����Ż�
+         *
+         * ѡ���˲��ֵ�ͬѧ���������������ʽ�� mem2reg �Լ����������ɴ��/������������������
+         * ��ɱ�Ҫ�Ż��󣬿ɼ���ʵ��������Ż���
+         * - ϡ������������������ʵ�ֿ�ô�Ĵ�����
+         * - ���������ѭ������������
+         * - ��������Ĺ����ӱ���ʽ����
+         * - ��������
+         * - �������������������ڿ�������ͼ����ɾ����ѭ����
+         * - �ѶȲ��������� pass �������Ż�
+         */
+        // ������� pass ������Ϊ�ο�����Ҫ��ʾ�����ͨ��cache��ȡ����pass�Ľ��
+        // -passes= 指定的流水线优先于 -O 等级对应的默认流水线；-j N 时函数级 Pass 按函数并行执行
+        string error;
+        if (!ME::runPassPipeline(m, pipeline, jobs, timer, budget, error))
+        {
+            if (cache) m.functions = allFunctions;
+            cerr << "Error: invalid pass pipeline: " << error << endl;
+            return 1;
+        }
+        // -opt-fuel / -func-budget-ms 时列出因预算用完而跳过或降级了 Pass 的函数
+        if (budget && budget->enabled()) budget->report(cerr);
+    }
+
+    if (cache)
+    {
+        // 因预算被跳过或降级了优化的函数不写回，以后不设预算编译时不会命中降级的结果
+        if (budget && budget->enabled())
+            for (size_t i = 0; i < allFunctions.size(); ++i)
+            {
+                ME::FunctionBudget* functionBudget = cache->isHit(i) ? nullptr : budget->get(*allFunctions[i]);
+                if (functionBudget && functionBudget->throttled()) cache->discard(i);
+            }
+        m.functions = allFunctions;
+    }
+
+    if (step == "-llvm")
+    {
+        // ��һ���ֵĴ�ӡ������ʵ���ṩ�������δ�� IR �ṹ�иĶ�������ֱ��ʹ��
+        ME::IRPrinter printer;
+        OutBuffer     out(*outStream);
+        printer.visit(m, out);
+        return 0;
+    }
+
+    if (step == "-emit-ir-bin")
+    {
+        // 保存（优化后的）IR 快照，之后可用 -load-ir-bin 跳过前端直接交给后端
+        ME::IRBinaryWriter writer;
+        writer.write(m, *outStream);
+        return 0;
+    }
+
+    if (step != "-S")
+    {
+        cerr << "Unknown step: " << step << endl;
+        return 1;
+    }
+
+    /*
+     * Lab 5: ��˴�������
+     *
+     * �����￪ʼ�����ˡ������Ķ� `backend/README.md` �˽���Ŀ¼�ṹ����ˮ������׶�ְ��
+     * ��ָ��ѡ�� �� ֡���� �� �Ĵ������� �� ջ���ͣ���
+     *
+     * ��˵�"���������"���ڴ��ļ������ڸ�Ŀ��ܹ��� Target �ࣺ
+     * - AArch64: `backend/targets/aarch64/aarch64_target.cpp` �� `AArch64Target::runPipeline`
+     * - RISC-V:  `backend/targets/riscv64/rv64_target.cpp` �� `RV64::Target::runPipeline`
+     * main ��ͨ�� `BE::Targeting::TargetRegistry::getTarget(march)` ��ȡ������ʵ����
+     * Ȼ����� `target->runPipeline(&m, &backendModule, outStream)` ����������衣
+     *
+     * ���� `BE::Targeting::TargetRegistry`��
+     * - ���ã�ά��"Ŀ���ַ��� �� Target ����/ʵ��"��ȫ��ע�������Ϊ���ѡ���븴�õ���ڡ�
+     * - ע�᣺���ܹ����� target Դ�ļ���ͨ����̬����ע�Ṥ�����������磺
+     *   AArch64 �� `aarch64_target.cpp` ��ע�� "aarch64"/"armv8"��
+     *   RISC?V �� `rv64_target.cpp` ��ע�� "riscv64"/"riscv"/"rv64"��
+     * - ��ȡ��ʹ�������� `-march` ���ַ�����Ĭ�� "riscv64"������ `getTarget(march)`��
+     *     `auto* tgt = BE::Targeting::TargetRegistry::getTarget(march);`
+     *   ���Ѵ������򷵻ػ���ʵ��������ͨ����Ӧ�������������棻�Ҳ����򷵻� `nullptr`��
+     *
+     * ��Ҫ����
+     * - ѡ��������ָ��ѡ��DAG ISel ��ֱ�� IR��MIR������������ FrameIndex �ȳ���� MIR��
+     * - �� AArch64/RV64 �� `runPipeline` �ڰ� README.md ������˳����� Pass��
+     *
+     * ����˵����
+     * - ��Ŀ��Ŀ¼���ṩ�� arm2bin.sh �� rv2bin.sh �ű����������ڽ� AArch64 �� RISC-V �Ļ�����ת��Ϊ�������ļ���
+     *     Ĭ������Ϊ `test.s`�����Ϊ `test.bin`����ͨ�������в����޸ġ�
+     * - ���ں�˵��ԣ���ͬѧ������ gdb ���ߡ�arm2bin.sh �� rv2bin.sh �ű����Ѿ������� -g ѡ��������ɵ�����Ϣ��
+     *     ��������ʹ�� gdb-multiarch ���������� AArch64 �� RISC-V �ĳ��򡣾�������ʾ�����£�
+     *     ```bash
+     *     qemu-riscv64 -g {port} {exec} &      // {port} Ϊ���Զ˿ڣ�{exec} Ϊ��ִ���ļ���& ��ʾ��̨����
+     *                                          // �� `qemu-riscv64 -g 1234 test.bin &`
+     *                                          // ��Ȼ���� & Ҳ���ԣ��¿�һ���ն����� gdb ����
+     *     gdb-multiarch {exec}
+     *     (gdb) target remote:{port}
+     *     ```
+     *     gdb ��ʹ�����Ŵ���� OS �����Ѿ������˽⣬������Թ���
+     */
+    BE::Module backendModule;
+    auto*      tgt = BE::Targeting::TargetRegistry::getTarget(march);
+    if (!tgt)
+    {
+        cerr << "Unknown target: " << march << endl;
+        return 1;
+    }
+
+    tgt->setJobs(jobs);
+    tgt->setTimer(timer);
+    tgt->setFunctionCache(cache);
+    tgt->runPipeline(&m, &backendModule, outStream);
+    if (cache) cache->finish();
+
+    return 0;
 }
 
 int main(int argc, char** argv)
@@ -54,14 +214,31 @@ int main(int argc, char** argv)
     string   step          = "-llvm";
     string   march         = "armv8";
     int      optimizeLevel = 0;
+    string   passPipeline  = "";
+    bool     timePasses    = false;
+    size_t   jobs          = 1;
+    size_t   optFuel       = 0;
+    size_t   funcBudgetMs  = 0;
+    string   cacheDir      = "";
+    size_t   cacheSizeMB   = 64;
+    bool     cacheStats    = false;
+    bool     loadIRBin     = false;
+    bool     loadIR        = false;
     ostream* outStream     = &cout;
     ofstream outFile;
+    // 中端与后端共用一个计时器，编译结束后统一输出
+    ME::PassTimer timer;
 
     for (int i = 1; i < argc; i++)
     {
         string arg = argv[i];
 
-        if (arg == "-lexer" || arg == "-parser" || arg == "-llvm" || arg == "-S") { step = arg; }
+        if (arg == "-lexer" || arg == "-parser" || arg == "-llvm" || arg == "-S" || arg == "-emit-ir-bin")
+        {
+            step = arg;
+        }
+        else if (arg == "-load-ir-bin") { loadIRBin = true; }
+        else if (arg == "-load-ir") { loadIR = true; }
         else if (arg == "-o")
         {
             if (i + 1 < argc)
@@ -86,6 +263,56 @@ int main(int argc, char** argv)
         else if (arg == "-O0") { optimizeLevel = 0; }
         else if (arg == "-O2") { optimizeLevel = 2; }
         else if (arg == "-O3") { optimizeLevel = 3; }
+        else if (arg.rfind("-passes=", 0) == 0)
+        {
+            passPipeline = arg.substr(8);
+            if (passPipeline.empty())
+            {
+                cerr << "Error: -passes= option requires a pass list (e.g., mem2reg,adce,dce)" << endl;
+                return 1;
+            }
+        }
+        else if (arg == "-time-passes") { timePasses = true; }
+        else if (arg == "-j" || (arg.rfind("-j", 0) == 0 && arg.size() > 2))
+        {
+            string value = arg.size() > 2 ? arg.substr(2) : (i + 1 < argc ? string(argv[++i]) : string());
+            if (!parsePositive(value, jobs))
+            {
+                cerr << "Error: -j option requires a positive thread count" << endl;
+                return 1;
+            }
+        }
+        else if (arg.rfind("-opt-fuel=", 0) == 0 || arg.rfind("-func-budget-ms=", 0) == 0)
+        {
+            // 每个函数的优化预算：步数（按 Pass 处理的指令数计）与毫秒数，用完后昂贵的 Pass 跳过或降级
+            string option = arg.substr(0, arg.find('=') + 1);
+            string value  = arg.substr(option.size());
+            if (!parsePositive(value, option == "-opt-fuel=" ? optFuel : funcBudgetMs))
+            {
+                cerr << "Error: " << option << " option requires a positive number" << endl;
+                return 1;
+            }
+        }
+        else if (arg.rfind("-cache-dir=", 0) == 0)
+        {
+            cacheDir = arg.substr(11);
+            if (cacheDir.empty())
+            {
+                cerr << "Error: -cache-dir= option requires a directory" << endl;
+                return 1;
+            }
+        }
+        else if (arg.rfind("-cache-size=", 0) == 0)
+        {
+            // 缓存目录的大小上限（MiB），超出时按最近最少使用淘汰；换算成字节后必须仍能用 uint64_t 表示
+            string value = arg.substr(12);
+            if (!parsePositive(value, cacheSizeMB, static_cast<size_t>(UINT64_MAX >> 20)))
+            {
+                cerr << "Error: -cache-size= option requires a positive size in MiB" << endl;
+                return 1;
+            }
+        }
+        else if (arg == "-cache-stats") { cacheStats = true; }
         else if (arg[0] != '-') { inputFile = arg; }
         else
         {
@@ -93,17 +320,55 @@ int main(int argc, char** argv)
             return 1;
         }
     }
+    ME::CompileBudget             budget(optFuel, static_cast<double>(funcBudgetMs));
+    BE::Targeting::FunctionCache cache(cacheDir, static_cast<uint64_t>(cacheSizeMB) << 20);
+    BE::Targeting::FunctionCache* cachePtr = cacheDir.empty() ? nullptr : &cache;
 
     if (inputFile.empty())
     {
         cerr << "Error: No input file specified" << endl;
-        cerr << "Usage: " << argv[0] << " [-lexer|-parser|-llvm|-S] [-o output_file] input_file [-O]" << endl;
+        cerr << "Usage: " << argv[0] << " [-lexer|-parser|-llvm|-S|-emit-ir-bin] [-o output_file] input_file [-O]"
+             << " [-passes=p1,p2,...] [-time-passes] [-j N] [-opt-fuel=N] [-func-budget-ms=N] [-load-ir|-load-ir-bin]"
+             << " [-cache-dir=DIR] [-cache-size=MiB] [-cache-stats]" << endl;
+        return 1;
+    }
+
+    if (loadIR && loadIRBin)
+    {
+        cerr << "Error: -load-ir and -load-ir-bin cannot be used together" << endl;
+        return 1;
+    }
+    if ((loadIR || loadIRBin) && (step == "-lexer" || step == "-parser"))
+    {
+        cerr << "Error: " << (loadIR ? "-load-ir" : "-load-ir-bin")
+             << " input can only be used with -llvm, -S or -emit-ir-bin" << endl;
+        return 1;
+    }
+    // 缓存的是各函数的汇编文本，只对 -S 有意义
+    if (cachePtr)
+    {
+        string error;
+        if (step != "-S")
+        {
+            cerr << "Error: -cache-dir= can only be used with -S" << endl;
+            return 1;
+        }
+        if (!cache.open(error))
+        {
+            cerr << "Error: " << error << endl;
+            return 1;
+        }
+    }
+    // 标准输出上还有下面的提示信息，二进制 IR 只能写入文件
+    if (step == "-emit-ir-bin" && outputFile.empty())
+    {
+        cerr << "Error: -emit-ir-bin requires an output file (-o)" << endl;
         return 1;
     }
 
     if (!outputFile.empty())
     {
-        outFile.open(outputFile);
+        outFile.open(outputFile, step == "-emit-ir-bin" ? ios::out | ios::binary : ios::out);
         if (!outFile)
         {
             cerr << "Cannot open output file " << outputFile << endl;
@@ -117,7 +382,7 @@ int main(int argc, char** argv)
     cout << "Output: " << (outputFile.empty() ? "standard output" : outputFile) << endl;
     cout << "Optimize level: " << optimizeLevel << endl;
 
-    ifstream       in(inputFile);
+    ifstream       in(inputFile, loadIRBin ? ios::in | ios::binary : ios::in);
     istream*       inStream = &in;
     FE::AST::Node* ast      = nullptr;
     int            ret      = 0;
@@ -129,6 +394,50 @@ int main(int argc, char** argv)
         goto cleanup_outfile;
     }
 
+    if (loadIR || loadIRBin)
+    {
+        /*
+         * 读取 -llvm 打印的文本 IR 或 -emit-ir-bin 保存的二进制 IR，跳过词法/语法/语义分析与 IR 生成：
+         * - 配合 -passes= -llvm 只运行指定的 Pass，相当于 opt
+         * - 配合 -S 直接交给后端，相当于 llc
+         * 加上 -time-passes 时读取本身也计入报告
+         */
+        ME::Module m;
+        string     error;
+        bool       loaded = false;
+        auto       start  = chrono::steady_clock::now();
+        if (loadIR)
+        {
+            ME::IRTextReader reader;
+            loaded = reader.read(in, m, error);
+        }
+        else
+        {
+            ME::IRBinaryReader reader;
+            loaded = reader.read(in, m, error);
+        }
+        double readMs = elapsedMs(start);
+
+        if (!loaded)
+        {
+            cerr << "Error: cannot load " << (loadIR ? "textual" : "binary") << " IR from " << inputFile << ": "
+                 << error << endl;
+            ret = 1;
+            goto cleanup_files;
+        }
+        if (timePasses)
+        {
+            long long insts = static_cast<long long>(ME::PassTimer::countInsts(m));
+            timer.add(loadIR ? "ir-reader" : "ir-bin-reader", readMs, insts);
+        }
+
+        ret = compileModule(m, step, march, optimizeLevel, passPipeline, timePasses ? &timer : nullptr, &budget,
+            cachePtr, jobs, outStream);
+        if (ret == 0 && timePasses) timer.report(cerr);
+        if (ret == 0 && cachePtr && cacheStats) cache.report(cerr);
+        goto cleanup_files;
+    }
+
     /*
      * Lab 1: �ʷ�����
      *
@@ -154,7 +463,11 @@ int main(int argc, char** argv)
      * �� `testcase/lexer/` Ŀ¼���ṩ��һЩ���������Լ����ǵ�Ԥ��������������в鿴��
      */
     {
+        // 源文件映射进内存后由手写扫描器直接扫描；无法映射时仍由 Flex 扫描器读 istream
+        MappedFile source;
+        string     mapError;
         FE::Parser parser(inStream, outStream);
+        if (source.open(inputFile, mapError)) parser.setSource(source.view());
 
         if (step == "-lexer")
         {
@@ -164,25 +477,23 @@ int main(int argc, char** argv)
             *outStream << setw(STR_PW) << "Token" << setw(STR_PW) << "Lexeme" << setw(STR_PW) << "Property"
                        << setw(INT_PW) << "Line" << setw(INT_PW) << "Column" << endl;
 
-            for (auto& token : tokens)
+            for (size_t i = 0; i < tokens.size(); ++i)
             {
-                *outStream << setw(STR_PW) << truncateString(token.token_name, STR_REAL_WIDTH) << setw(STR_PW)
-                           << truncateString(token.lexeme, STR_REAL_WIDTH);
-
-                if (token.type == FE::Token::TokenType::T_INT)
-                    *outStream << setw(STR_PW) << token.ival;
-                else if (token.type == FE::Token::TokenType::T_LL)
-                    *outStream << setw(STR_PW) << token.lval;
-                else if (token.type == FE::Token::TokenType::T_FLOAT)
-                    *outStream << setw(STR_PW) << token.fval;
-                else if (token.type == FE::Token::TokenType::T_DOUBLE)
-                    *outStream << setw(STR_PW) << token.dval;
-                else if (token.type == FE::Token::TokenType::T_STRING)
-                    *outStream << setw(STR_PW) << token.sval;
-                else
-                    *outStream << setw(STR_PW) << " ";
-
-                *outStream << setw(INT_PW) << token.line_number << setw(INT_PW) << token.column_number << endl;
+                *outStream << setw(STR_PW) << truncateString(tokens.name(i), STR_REAL_WIDTH) << setw(STR_PW)
+                           << truncateString(tokens.lexeme(i), STR_REAL_WIDTH);
+
+                const auto& value = tokens.values[i];
+                switch (tokens.types[i])
+                {
+                    case FE::TokenList::TokenType::T_INT: *outStream << setw(STR_PW) << value.ival; break;
+                    case FE::TokenList::TokenType::T_LL: *outStream << setw(STR_PW) << value.lval; break;
+                    case FE::TokenList::TokenType::T_FLOAT: *outStream << setw(STR_PW) << value.fval; break;
+                    case FE::TokenList::TokenType::T_DOUBLE: *outStream << setw(STR_PW) << value.dval; break;
+                    case FE::TokenList::TokenType::T_STRING: *outStream << setw(STR_PW) << tokens.str(i); break;
+                    default: *outStream << setw(STR_PW) << " "; break;
+                }
+
+                *outStream << setw(INT_PW) << tokens.lines[i] << setw(INT_PW) << tokens.columns[i] << endl;
             }
 
             ret = 0;
@@ -218,7 +529,10 @@ int main(int argc, char** argv)
          * �������ʾ��:
          * �� `testcase/parser/` Ŀ¼���ṩ��һЩ���������Լ����ǵ�Ԥ��������������в鿴��
          */
-        ast = parser.parseAST();
+        // -time-passes 时前端各阶段也计入报告，便于发现大输入下的超线性开销
+        auto start = chrono::steady_clock::now();
+        ast        = parser.parseAST();
+        if (timePasses) timer.add("parse", elapsedMs(start), 0);
         if (!ast)
         {
             cerr << "Parsing failed." << endl;
@@ -233,7 +547,7 @@ int main(int argc, char** argv)
             apply(printer, *ast, osPtr);
 
             ret = 0;
-            goto cleanup_ast;
+            goto cleanup_files;
         }
 
         /*
@@ -267,14 +581,16 @@ int main(int argc, char** argv)
          * ά���������ԣ�����������͡������Ĳ������Թ������� IR ����ʹ�á�
          * ��˿���б����˽�Ϊ�򵥵ļ��� `visit` ������ʵ����Ϊʾ��������Բο�������ʵ�������ڵ�ļ���߼���
          */
+        start = chrono::steady_clock::now();
         FE::AST::ASTChecker checker;
         bool                accept = apply(checker, *ast);
+        if (timePasses) timer.add("semantic-check", elapsedMs(start), 0);
         if (!accept)
         {
             cerr << "Semantic check failed with " << checker.errors.size() << " errors." << endl;
             for (const auto& err : checker.errors) cerr << "Error: " << err << endl;
             ret = 1;
-            goto cleanup_ast;
+            goto cleanup_files;
         }
 
         /*
@@ -308,118 +624,21 @@ int main(int argc, char** argv)
         ME::ASTCodeGen codegen(checker.getGlbSymbols(), checker.getFuncDecls());
         ME::Module     m;
 
+        start = chrono::steady_clock::now();
         apply(codegen, *ast, &m);
+        if (timePasses)
+            timer.add("ir-codegen", elapsedMs(start), static_cast<long long>(ME::PassTimer::countInsts(m)));
 
-        if (optimizeLevel > 0)
-        {
-            /*
-             * Lab 4: �м�����Ż�
-             *
-             * ѡ���˲��ֵ�ͬѧ���������������ʽ�� mem2reg �Լ����������ɴ��/������������������
-             * ��ɱ�Ҫ�Ż��󣬿ɼ���ʵ��������Ż���
-             * - ϡ������������������ʵ�ֿ�ô�Ĵ�����
-             * - ���������ѭ������������
-             * - ��������Ĺ����ӱ���ʽ����
-             * - ��������
-             * - �������������������ڿ�������ͼ����ɾ����ѭ����
-             * - �ѶȲ��������� pass �������Ż�
-             */
-            // ������� pass ������Ϊ�ο�����Ҫ��ʾ�����ͨ��cache��ȡ����pass�Ľ��
-            ME::UnifyReturnPass unifyReturnPass;
-            unifyReturnPass.runOnModule(m);
-
-            ME::Mem2RegPass mem2RegPass;
-            ME::DCEPass dcePass;
-            ME::ADCEPass adcePass; 
-            for (auto* func : m.functions)
-    {
-        if (func->blocks.empty()) continue;
-        
-        // Pass ִ��˳��
-        // 1. Mem2Reg - ���ڴ��������Ϊ�Ĵ�������
-        mem2RegPass.runOnFunction(*func);
-        
-        // 2. ADCE - ��������������
-        adcePass.runOnFunction(*func);
-        
-        // 3. DCE - ��ͨ����������������ʣ�ࣩ
-        dcePass.runOnFunction(*func);
-    }
-}
+        // IR 生成后不再需要 AST，立即归还，降低优化与寄存器分配期间的内存峰值
+        parser.releaseAST();
+        ast = nullptr;
 
-        if (step == "-llvm")
-        {
-            // ��һ���ֵĴ�ӡ������ʵ���ṩ�������δ�� IR �ṹ�иĶ�������ֱ��ʹ��
-            ME::IRPrinter printer;
-            printer.visit(m, *outStream);
-            ret = 0;
-            goto cleanup_ast;
-        }
-
-        if (step != "-S")
-        {
-            cerr << "Unknown step: " << step << endl;
-            ret = 1;
-            goto cleanup_ast;
-        }
-
-        /*
-         * Lab 5: ��˴�������
-         *
-         * �����￪ʼ�����ˡ������Ķ� `backend/README.md` �˽���Ŀ¼�ṹ����ˮ������׶�ְ��
-         * ��ָ��ѡ�� �� ֡���� �� �Ĵ������� �� ջ���ͣ���
-         *
-         * ��˵�"���������"���ڴ��ļ������ڸ�Ŀ��ܹ��� Target �ࣺ
-         * - AArch64: `backend/targets/aarch64/aarch64_target.cpp` �� `AArch64Target::runPipeline`
-         * - RISC-V:  `backend/targets/riscv64/rv64_target.cpp` �� `RV64::Target::runPipeline`
-         * main ��ͨ�� `BE::Targeting::TargetRegistry::getTarget(march)` ��ȡ������ʵ����
-         * Ȼ����� `target->runPipeline(&m, &backendModule, outStream)` ����������衣
-         *
-         * ���� `BE::Targeting::TargetRegistry`��
-         * - ���ã�ά��"Ŀ���ַ��� �� Target ����/ʵ��"��ȫ��ע�������Ϊ���ѡ���븴�õ���ڡ�
-         * - ע�᣺���ܹ����� target Դ�ļ���ͨ����̬����ע�Ṥ�����������磺
-         *   AArch64 �� `aarch64_target.cpp` ��ע�� "aarch64"/"armv8"��
-         *   RISC?V �� `rv64_target.cpp` ��ע�� "riscv64"/"riscv"/"rv64"��
-         * - ��ȡ��ʹ�������� `-march` ���ַ�����Ĭ�� "riscv64"������ `getTarget(march)`��
-         *     `auto* tgt = BE::Targeting::TargetRegistry::getTarget(march);`
-         *   ���Ѵ������򷵻ػ���ʵ��������ͨ����Ӧ�������������棻�Ҳ����򷵻� `nullptr`��
-         *
-         * ��Ҫ����
-         * - ѡ��������ָ��ѡ��DAG ISel ��ֱ�� IR��MIR������������ FrameIndex �ȳ���� MIR��
-         * - �� AArch64/RV64 �� `runPipeline` �ڰ� README.md ������˳����� Pass��
-         *
-         * ����˵����
-         * - ��Ŀ��Ŀ¼���ṩ�� arm2bin.sh �� rv2bin.sh �ű����������ڽ� AArch64 �� RISC-V �Ļ�����ת��Ϊ�������ļ���
-         *     Ĭ������Ϊ `test.s`�����Ϊ `test.bin`����ͨ�������в����޸ġ�
-         * - ���ں�˵��ԣ���ͬѧ������ gdb ���ߡ�arm2bin.sh �� rv2bin.sh �ű����Ѿ������� -g ѡ��������ɵ�����Ϣ��
-         *     ��������ʹ�� gdb-multiarch ���������� AArch64 �� RISC-V �ĳ��򡣾�������ʾ�����£�
-         *     ```bash
-         *     qemu-riscv64 -g {port} {exec} &      // {port} Ϊ���Զ˿ڣ�{exec} Ϊ��ִ���ļ���& ��ʾ��̨����
-         *                                          // �� `qemu-riscv64 -g 1234 test.bin &`
-         *                                          // ��Ȼ���� & Ҳ���ԣ��¿�һ���ն����� gdb ����
-         *     gdb-multiarch {exec}
-         *     (gdb) target remote:{port}
-         *     ```
-         *     gdb ��ʹ�����Ŵ���� OS �����Ѿ������˽⣬������Թ���
-         */
-        BE::Module backendModule;
-        auto*      tgt = BE::Targeting::TargetRegistry::getTarget(march);
-        if (!tgt)
-        {
-            cerr << "Unknown target: " << march << endl;
-            ret = 1;
-            goto cleanup_ast;
-        }
-
-        tgt->runPipeline(&m, &backendModule, outStream);
-
-        ret = 0;
+        ret = compileModule(m, step, march, optimizeLevel, passPipeline, timePasses ? &timer : nullptr, &budget,
+            cachePtr, jobs, outStream);
+        if (ret == 0 && timePasses) timer.report(cerr);
+        if (ret == 0 && cachePtr && cacheStats) cache.report(cerr);
     }
 
-cleanup_ast:
-    delete ast;
-    ast = nullptr;
-
 cleanup_files:
     if (in.is_open()) in.close();
 
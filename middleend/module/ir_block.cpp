@@ -1,17 +1,59 @@
 #include <middleend/module/ir_block.h>
+#include <middleend/module/ir_function.h>
 
 namespace ME
 {
     Block::~Block()
     {
-        for (auto inst : insts)
+        insts.clearAndDispose([](Instruction* inst) { delete inst; });
+    }
+
+    void Block::insertFront(Instruction* inst)
+    {
+        insts.push_front(inst);
+        if (parent) parent->addDefUse(inst);
+    }
+    void Block::insertBack(Instruction* inst)
+    {
+        insts.push_back(inst);
+        if (parent) parent->addDefUse(inst);
+    }
+
+    Block::iterator Block::insertBefore(iterator pos, Instruction* inst)
+    {
+        if (parent) parent->addDefUse(inst);
+        return insts.insert(pos, inst);
+    }
+    Block::iterator Block::insertAfter(iterator pos, Instruction* inst)
+    {
+        if (parent) parent->addDefUse(inst);
+        return insts.insertAfter(pos, inst);
+    }
+
+    Block::iterator Block::erase(iterator pos)
+    {
+        Instruction* inst = *pos;
+        if (parent) parent->removeDefUse(inst);
+        iterator next = insts.erase(pos);
+        delete inst;
+        return next;
+    }
+    Block::iterator Block::erase(iterator first, iterator last)
+    {
+        while (first != last) first = erase(first);
+        return last;
+    }
+
+    Block::iterator Block::replace(iterator pos, Instruction* newInst)
+    {
+        Instruction* oldInst = *pos;
+        if (parent)
         {
-            delete inst;
-            inst = nullptr;
+            parent->removeDefUse(oldInst);
+            parent->addDefUse(newInst);
         }
-        insts.clear();
+        iterator it = insts.replace(pos, newInst);
+        delete oldInst;
+        return it;
     }
-
-    void Block::insertFront(Instruction* inst) { insts.push_front(inst); }
-    void Block::insertBack(Instruction* inst) { insts.push_back(inst); }
 }  // namespace ME
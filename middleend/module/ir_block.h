@@ -2,26 +2,32 @@
 #define __MIDDLEEND_MODULE_IR_BLOCK_H__
 
 #include <middleend/module/ir_instruction.h>
-#include <deque>
+#include <ilist.h>
 
 #define ENABLE_IRBLOCK_COMMENT
 
 namespace ME
 {
+    class Function;
+
     class Block : public Visitable
     {
       public:
-        std::deque<Instruction*> insts;
-        size_t                   blockId;
+        using InstList = IList<Instruction, Block>;
+        using iterator = InstList::iterator;
+
+        InstList  insts;    //侵入式指令链表，插入/删除为O(1)且不会使其他指令的迭代器失效
+        size_t    blockId;
+        Function* parent;  //所属函数，由Function::createBlock设置，用于同步def-use链
 
       public:
 #ifndef ENABLE_IRBLOCK_COMMENT
-        Block(size_t id = 0, const std::string& c = "") : blockId(id) {}
+        Block(size_t id = 0, const std::string& c = "") : insts(this), blockId(id), parent(nullptr) {}
         void        setComment(const std::string& c) {}
         std::string getComment() const { return ""; }
 #else
         std::string comment;
-        Block(size_t id = 0, const std::string& c = "") : blockId(id), comment(c) {}
+        Block(size_t id = 0, const std::string& c = "") : insts(this), blockId(id), parent(nullptr), comment(c) {}
         void        setComment(const std::string& c) { comment = c; }
         std::string getComment() const
         {
@@ -37,6 +43,21 @@ namespace ME
         void insertFront(Instruction* inst);
         void insertBack(Instruction* inst);
         void insert(Instruction* inst) { insertBack(inst); }
+        //在pos之前/之后插入指令，返回指向新指令的迭代器
+        iterator insertBefore(iterator pos, Instruction* inst);
+        iterator insertAfter(iterator pos, Instruction* inst);
+        //将指令从块中删除并销毁（内存池中的指令回到空闲链表），返回其后一条指令的迭代器
+        iterator erase(iterator pos);
+        iterator erase(iterator first, iterator last);
+        //用newInst替换pos处的指令，旧指令被销毁，返回指向newInst的迭代器
+        iterator replace(iterator pos, Instruction* newInst);
+        //指令所在位置的迭代器，O(1)
+        iterator iteratorTo(Instruction* inst) { return insts.iteratorTo(inst); }
+
+        /*
+         * 以上接口会在所属函数已构建def-use链时同步更新use链；
+         * 直接修改insts或指令的操作数字段不会，需要调用Function::buildDefUse()重建
+         */
     };
 }  // namespace ME
 
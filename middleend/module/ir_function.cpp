@@ -3,7 +3,7 @@
 namespace ME
 {
     Function::Function(FuncDefInst* fd)
-        : funcDef(fd), blocks(), maxLabel(0), maxReg(0), loopStartLabel(0), loopEndLabel(0)
+        : funcDef(fd), blocks(), arena(), operands(), maxLabel(0), maxReg(0), defUseBuilt(false), loopStartLabel(0), loopEndLabel(0)
     {}
     Function::~Function()
     {
@@ -12,29 +12,174 @@ namespace ME
             delete funcDef;
             funcDef = nullptr;
         }
+        /*
+         * 内存池中的对象不逐个归还：只原地调用析构函数释放它们持有的容器，
+         * 内存本身随arena析构按块一次性释放
+         */
         for (auto& [label, block] : blocks)
         {
-            delete block;
+            block->insts.clearAndDispose([this](Instruction* inst) {
+                if (Instruction::getArena(inst) == &arena)
+                    inst->~Instruction();
+                else
+                    delete inst;
+            });
+            block->~Block();
             block = nullptr;
         }
     }
 
     Block* Function::createBlock()
     {
-        Block* newBlock  = new Block(maxLabel);
-        blocks[maxLabel] = newBlock;
+        Block* newBlock  = arena.create<Block>(maxLabel);
+        newBlock->parent = this;
+        blocks.insert(maxLabel, newBlock);
 
         maxLabel++;
         return newBlock;
     }
-    Block* Function::getBlock(size_t label)
+    Block* Function::createBlock(size_t label)
     {
-        if (blocks.find(label) != blocks.end()) return blocks[label];
-        return nullptr;
+        Block* newBlock  = arena.create<Block>(label);
+        newBlock->parent = this;
+        blocks.insert(label, newBlock);
+        return newBlock;
     }
+    Block* Function::getBlock(size_t label) { return blocks.get(label); }
     void   Function::setMaxReg(size_t reg) { maxReg = reg; }
     size_t Function::getMaxReg() { return maxReg; }
     void   Function::setMaxLabel(size_t label) { maxLabel = label; }
     size_t Function::getMaxLabel() { return maxLabel; }
     size_t Function::getNewRegId() { return ++maxReg; }
+
+    void Function::removeBlock(size_t label)
+    {
+        Block* block = blocks.get(label);
+        if (!block) return;
+
+        blocks.erase(label);
+        for (auto* inst : block->insts) removeDefUse(inst);
+        block->~Block();
+        arena.deallocate(block, sizeof(Block));
+    }
+
+    void Function::buildDefUse()
+    {
+        clearDefUse();
+        defUseBuilt = true;
+        for (auto& [label, block] : blocks)
+            for (auto* inst : block->insts) addDefUse(inst);
+    }
+
+    void Function::clearDefUse()
+    {
+        useLists.clear();
+        useIndex.clear();
+        defInsts.clear();
+        defUseBuilt = false;
+    }
+
+    //只有寄存器登记use链，见ir_function.h中def-use链的说明
+    static bool tracksUses(Operand* op) { return op && op->getType() == OperandType::REG; }
+
+    void Function::addDefUse(Instruction* inst)
+    {
+        if (!defUseBuilt) return;
+        if (Operand* def = inst->getDef()) defInsts[def] = inst;
+
+        slotScratch.clear();
+        inst->getUseSlots(slotScratch);
+        for (auto* slot : slotScratch)
+            if (tracksUses(*slot)) linkUse(*slot, inst, 1);
+    }
+
+    void Function::removeDefUse(Instruction* inst)
+    {
+        if (!defUseBuilt) return;
+        if (Operand* def = inst->getDef())
+        {
+            auto it = defInsts.find(def);
+            if (it != defInsts.end() && it->second == inst) defInsts.erase(it);
+        }
+
+        slotScratch.clear();
+        inst->getUseSlots(slotScratch);
+        for (auto* slot : slotScratch) removeUse(*slot, inst);
+    }
+
+    void Function::linkUse(Operand* op, Instruction* user, size_t count)
+    {
+        auto [it, inserted] = useIndex.try_emplace({op, user}, UseEntry{0, 0});
+        if (inserted)
+        {
+            auto& users    = useLists[op];
+            it->second.pos = users.size();
+            users.push_back(user);
+        }
+        it->second.count += count;
+    }
+
+    void Function::addUse(Operand* op, Instruction* user)
+    {
+        if (!defUseBuilt || !tracksUses(op)) return;
+        linkUse(op, user, 1);
+    }
+
+    void Function::removeUse(Operand* op, Instruction* user)
+    {
+        if (!defUseBuilt || !tracksUses(op)) return;
+        auto it = useIndex.find({op, user});
+        if (it == useIndex.end()) return;
+        if (--it->second.count > 0) return;
+
+        //该指令的最后一个槽位也不再使用op：顺序无意义，用末尾元素填补并更新它的下标
+        size_t pos = it->second.pos;
+        useIndex.erase(it);
+        auto  listIt = useLists.find(op);
+        auto& users  = listIt->second;
+        users[pos]   = users.back();
+        users.pop_back();
+        if (pos < users.size()) useIndex.find({op, users[pos]})->second.pos = pos;
+        if (users.empty()) useLists.erase(listIt);
+    }
+
+    Instruction* Function::getDefInst(Operand* op) const
+    {
+        auto it = defInsts.find(op);
+        return it == defInsts.end() ? nullptr : it->second;
+    }
+
+    const std::vector<Instruction*>& Function::getUsers(Operand* op) const
+    {
+        static const std::vector<Instruction*> noUsers;
+        auto                                   it = useLists.find(op);
+        return it == useLists.end() ? noUsers : it->second;
+    }
+
+    void Function::replaceAllUsesWith(Operand* from, Operand* to)
+    {
+        if (from == to) return;
+        if (!defUseBuilt) buildDefUse();
+
+        auto it = useLists.find(from);
+        if (it == useLists.end()) return;
+        std::vector<Instruction*> users = std::move(it->second);
+        useLists.erase(it);
+
+        //每条使用者只出现一次，替换它的全部槽位，并按原使用次数并入to的use链
+        bool track = tracksUses(to);
+        for (auto* user : users)
+        {
+            auto   entry = useIndex.find({from, user});
+            size_t count = entry->second.count;
+            useIndex.erase(entry);
+
+            slotScratch.clear();
+            user->getUseSlots(slotScratch);
+            for (auto* slot : slotScratch)
+                if (*slot == from) *slot = to;
+
+            if (track) linkUse(to, user, count);
+        }
+    }
 }  // namespace ME
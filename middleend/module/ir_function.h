@@ -2,20 +2,132 @@
 #define __MIDDLEEND_MODULE_IR_FUNCTION_H__
 
 #include <middleend/module/ir_block.h>
+#include <arena.h>
+#include <iterator>
 #include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ME
 {
+    /*
+     * 基本块表：以标签ID为下标的稠密数组，标签就是块在表中的稳定下标
+     * - 查找为 O(1) 的数组访问；删除的块只留下空位，标签不会被复用
+     * - 遍历按标签升序并跳过空位，元素为 pair<标签, Block*>，用法与原先的 std::map<size_t, Block*> 一致
+     */
+    class BlockTable
+    {
+      public:
+        using value_type = std::pair<const size_t, Block*>;
+
+        class iterator
+        {
+            friend class BlockTable;
+
+          private:
+            std::vector<value_type>* slots;
+            size_t                   idx;
+
+            iterator(std::vector<value_type>* s, size_t i) : slots(s), idx(i) { skip(); }
+            void skip()
+            {
+                while (idx < slots->size() && !(*slots)[idx].second) ++idx;
+            }
+
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = value_type*;
+            using reference         = value_type&;
+
+            value_type& operator*() const { return (*slots)[idx]; }
+            value_type* operator->() const { return &(*slots)[idx]; }
+            iterator&   operator++()
+            {
+                ++idx;
+                skip();
+                return *this;
+            }
+            bool operator==(const iterator& other) const { return idx == other.idx; }
+            bool operator!=(const iterator& other) const { return idx != other.idx; }
+        };
+
+      private:
+        std::vector<value_type> slots;  // slots[i].first == i，空位的 second 为 nullptr
+        size_t                  count;
+
+      public:
+        BlockTable() : slots(), count(0) {}
+
+        iterator begin() { return iterator(&slots, 0); }
+        iterator end() { return iterator(&slots, slots.size()); }
+        bool     empty() const { return count == 0; }
+        size_t   size() const { return count; }
+        //标签上界：所有块的标签都小于该值，可直接用作按标签下标的数组大小
+        size_t   capacity() const { return slots.size(); }
+
+        Block*   get(size_t label) const { return label < slots.size() ? slots[label].second : nullptr; }
+        bool     contains(size_t label) const { return get(label) != nullptr; }
+        iterator find(size_t label) { return contains(label) ? iterator(&slots, label) : end(); }
+
+        void insert(size_t label, Block* block)
+        {
+            while (slots.size() <= label) slots.emplace_back(slots.size(), nullptr);
+            if (!slots[label].second) ++count;
+            slots[label].second = block;
+        }
+        void erase(size_t label)
+        {
+            if (!contains(label)) return;
+            slots[label].second = nullptr;
+            --count;
+        }
+        void erase(iterator it) { erase(it->first); }
+    };
+
     class Function : public Visitable
     {
       public:
-        FuncDefInst*             funcDef;
-        std::map<size_t, Block*> blocks;
+        FuncDefInst* funcDef;
+        BlockTable   blocks;
 
       private:
+        /*
+         * 函数内的基本块、指令和注释字符串都从这个内存池分配：
+         * 删除的指令回到空闲链表复用，整个函数销毁时按块一次性归还内存
+         */
+        Arena arena;
+        //函数内的寄存器、标签与立即数操作数，随函数一起销毁
+        OperandTable operands;
+
         size_t maxLabel;  //记录当前已分配的最大标签ID
         size_t maxReg;    //记录函数内已使用的最大虚拟寄存器ID
 
+        /*
+         * def-use链：寄存器 -> 使用它的指令（同一指令只出现一次），以及寄存器 -> 定义它的指令。
+         * 立即数、标签与全局变量不登记：它们在函数内共享且使用极多，而各Pass只查询寄存器的使用者。
+         * useIndex记录每个(值, 使用者)在use链中的下标与使用次数，注销时O(1)地用末尾元素填补。
+         * 由buildDefUse()构建，之后通过Block的插入/删除接口维护
+         */
+        struct UseKeyHash
+        {
+            size_t operator()(const std::pair<Operand*, Instruction*>& key) const
+            {
+                return std::hash<Operand*>()(key.first) * 31 + std::hash<Instruction*>()(key.second);
+            }
+        };
+        struct UseEntry
+        {
+            size_t pos;    // 使用者在useLists[值]中的下标
+            size_t count;  // 该指令中使用此值的槽位数
+        };
+        bool                                                                        defUseBuilt;
+        std::unordered_map<Operand*, std::vector<Instruction*>>                    useLists;
+        std::unordered_map<std::pair<Operand*, Instruction*>, UseEntry, UseKeyHash> useIndex;
+        std::unordered_map<Operand*, Instruction*>                                  defInsts;
+        std::vector<Operand**>                                                      slotScratch;  // 收集使用槽位时复用的缓冲区
+
       public: /*以下2个变量与循环优化相关，如果你正在做Lab3，可以暂时忽略它们 */
         size_t loopStartLabel;
         size_t loopEndLabel;
@@ -29,6 +141,8 @@ namespace ME
 
         //创建并返回一个基本块
         Block* createBlock();
+        //按给定标签创建基本块，不改变maxLabel；用于按原标签重建已有的IR（如读取二进制IR）
+        Block* createBlock(size_t label);
         //通过标签ID查找对应Block对象
         Block* getBlock(size_t label);
         void   setMaxReg(size_t reg);
@@ -37,6 +151,41 @@ namespace ME
         size_t getMaxLabel();
         //获取一个新的唯一的虚拟寄存器ID，并更新maxReg计数器
         size_t getNewRegId();
+        //从函数中移除并销毁基本块及其中的指令，同时注销它们的def-use信息
+        void removeBlock(size_t label);
+
+        //函数内存池：指令通过 new (function.getArena()) XxxInst(...) 创建
+        Arena&      getArena() { return arena; }
+        const char* copyString(const std::string& s) { return arena.copyString(s); }
+
+        //函数级操作数：同一函数内编号/值相同的操作数是同一个对象
+        OperandTable&   getOperands() { return operands; }
+        RegOperand*     getRegOperand(size_t id) { return operands.getRegOperand(id); }
+        LabelOperand*   getLabelOperand(size_t num) { return operands.getLabelOperand(num); }
+        ImmeI32Operand* getImmeI32Operand(int value) { return operands.getImmeI32Operand(value); }
+        ImmeF32Operand* getImmeF32Operand(float value) { return operands.getImmeF32Operand(value); }
+
+      public: /* def-use链 */
+        //扫描全部指令(重新)构建def-use链
+        void buildDefUse();
+        void clearDefUse();
+        bool hasDefUse() const { return defUseBuilt; }
+        //登记/注销一条指令的定义与全部使用，未构建def-use链时为空操作
+        void addDefUse(Instruction* inst);
+        void removeDefUse(Instruction* inst);
+        //直接修改指令的某个操作数槽位后，用这两个接口同步use链；op不是寄存器时为空操作
+        void addUse(Operand* op, Instruction* user);
+        void removeUse(Operand* op, Instruction* user);
+
+        //定义op的指令，函数参数、全局变量和立即数返回nullptr
+        Instruction* getDefInst(Operand* op) const;
+        //使用寄存器op的指令，每条指令只出现一次；非寄存器操作数返回空表
+        const std::vector<Instruction*>& getUsers(Operand* op) const;
+        //将函数内所有对from的使用替换为to，并把from的use链并入to
+        void replaceAllUsesWith(Operand* from, Operand* to);
+
+      private:
+        void linkUse(Operand* op, Instruction* user, size_t count);
     };
 }  // namespace ME
 
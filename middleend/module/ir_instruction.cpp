@@ -5,300 +5,374 @@
 
 namespace ME
 {
-    std::string LoadInst::toString() const
+    namespace
+    {
+        // 指令头部大小：保持对象按 max_align_t 对齐
+        constexpr size_t instHeaderSize = Arena::alignment;
+
+        Arena*& headerOf(void* p) { return *reinterpret_cast<Arena**>(static_cast<char*>(p) - instHeaderSize); }
+    }  // namespace
+
+    void* Instruction::operator new(size_t size)
+    {
+        char* raw = static_cast<char*>(::operator new(size + instHeaderSize));
+        void* p   = raw + instHeaderSize;
+        headerOf(p) = nullptr;
+        return p;
+    }
+
+    void* Instruction::operator new(size_t size, Arena& arena)
+    {
+        char* raw = static_cast<char*>(arena.allocate(size + instHeaderSize));
+        void* p   = raw + instHeaderSize;
+        headerOf(p) = &arena;
+        return p;
+    }
+
+    void Instruction::operator delete(void* p, size_t size)
+    {
+        if (!p) return;
+        Arena* arena = headerOf(p);
+        char*  raw   = static_cast<char*>(p) - instHeaderSize;
+        if (arena)
+            arena->deallocate(raw, size + instHeaderSize);
+        else
+            ::operator delete(raw);
+    }
+
+    // 仅在构造函数抛出异常时由编译器调用，内存留给内存池整体释放
+    void Instruction::operator delete(void* p, Arena& arena) {}
+
+    Arena* Instruction::getArena(const Instruction* inst)
+    {
+        return headerOf(const_cast<Instruction*>(inst));
+    }
+
+    std::string Instruction::toString() const
+    {
+        std::ostringstream ss;
+        {
+            OutBuffer out(ss, 256);
+            print(out);
+        }
+        return ss.str();
+    }
+
+    void LoadInst::print(OutBuffer& out) const
     {
         //����һ���ַ���������ƴ��IR�ı�
-        std::stringstream ss;
         //res��Ŀ��Ĵ�����dt���������ͣ�ptr��ָ���������getcomment()���ָ����ע�;ͼ���ĩβ
         //%r1 = load i32, ptr %addr�����ӣ�����Ҳ����ÿ��������ʾ����
-        ss << res << " = load " << dt << ", ptr " << ptr << getComment();
-        return ss.str();
+        out << res << " = load " << dt << ", ptr " << ptr << getComment();
     }
 
     //���治ͬ�ĺ������������ƣ�ֻ��ƴ�ӵ����Ͳ�ͬ
 
-    std::string StoreInst::toString() const
+    void StoreInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
-        ss << "store " << dt << " " << val << ", ptr " << ptr << getComment();
-        return ss.str();
+        out << "store " << dt << " " << val << ", ptr " << ptr << getComment();
     }
 
-    std::string ArithmeticInst::toString() const
+    void ArithmeticInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
         //%r3 = add i32 %r1, %r2
-        ss << res << " = " << opcode << " " << dt << " " << lhs << ", " << rhs << getComment();
-        return ss.str();
+        out << res << " = " << opcode << " " << dt << " " << lhs << ", " << rhs << getComment();
     }
 
-    std::string IcmpInst::toString() const
+    void IcmpInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
         //�����Ƚ�
         //%r = icmp slt i32 %a, %b
-        ss << res << " = icmp " << cond << " " << dt << " " << lhs << ", " << rhs << getComment();
-        return ss.str();
+        out << res << " = icmp " << cond << " " << dt << " " << lhs << ", " << rhs << getComment();
     }
 
-    std::string FcmpInst::toString() const
+    void FcmpInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
         //�������Ƚ�
         //%r = fcmp olt float %a, %b
-        ss << res << " = fcmp " << cond << " " << dt << " " << lhs << ", " << rhs << getComment();
-        return ss.str();
+        out << res << " = fcmp " << cond << " " << dt << " " << lhs << ", " << rhs << getComment();
     }
 
-    std::string AllocaInst::toString() const
+    void AllocaInst::print(OutBuffer& out) const
     {
         //ջ�Ϸ������
-        std::stringstream ss;
         //�����������if�ڲ��ģ�������else
         //�����飺%p = alloca i32
-        ss << res << " = alloca ";
-        if (dims.empty()) { ss << dt << getComment(); }
+        out << res << " = alloca ";
+        if (dims.empty()) { out << dt << getComment(); }
         else
         {
             //���飺%p = alloca [3 x [4 x i32]]
-            for (int dim : dims) ss << "[" << dim << " x ";
-            ss << dt << std::string(dims.size(), ']') << getComment();
+            for (int dim : dims) out << "[" << dim << " x ";
+            out << dt;
+            out.repeat(']', dims.size()) << getComment();
         }
-        return ss.str();
     }
 
-    std::string BrCondInst::toString() const
+    void BrCondInst::print(OutBuffer& out) const
     {
         //������ת
-        std::stringstream ss;
         //br i1 %cond, label %L1, label %L2
-        ss << "br i1 " << cond << ", label " << trueTar << ", label " << falseTar << getComment();
-        return ss.str();
+        out << "br i1 " << cond << ", label " << trueTar << ", label " << falseTar << getComment();
     }
 
-    std::string BrUncondInst::toString() const
+    void BrUncondInst::print(OutBuffer& out) const
     {
         //��������ת
-        std::stringstream ss;
         //br label %L3
-        ss << "br label " << target << getComment();
-        return ss.str();
+        out << "br label " << target << getComment();
     }
 
-    void initArrayGlb(
-        std::ostream& s, DataType type, const FE::AST::VarAttr& v, size_t dimDph, size_t beginPos, size_t endPos)
+    namespace
     {
-        //�˺������ڴ�ӡ��Ϊȫ������ĳ�ֵ
-        //global [3 x i32] [i32 1, i32 2, i32 3]
-        //�ж��Ƿ�ȫΪ0->�����zeroinitializer
-        if (dimDph == 0)
+        // 一维数组中连续的 0 不少于该个数时，单独成段写作 [N x T] zeroinitializer
+        constexpr size_t zeroRunThreshold = 16;
+
+        struct InitRun
         {
-            bool allZero = true;
-            //ֻ�������ά�Ȳ���ȫ���飬�������г�ֵ
-            for (auto& initVal : v.initList)
-            {
-                if (initVal.type == FE::AST::boolType || initVal.type == FE::AST::intType ||
-                    initVal.type == FE::AST::llType)
-                {
-                    int iv = initVal.getInt();
-                    //�������ͼ���Ƿ�Ϊ 0��
-                    if (iv != 0) allZero = false;
-                }
-                if (initVal.type == FE::AST::floatType)
-                {
-                    float fv = initVal.getFloat();
-                    //�����ͼ���Ƿ�Ϊ 0.0��
-                    if (fv != 0.0f) allZero = false;
-                }
-                //���������һ����Ϊ�㣬�˳���
-                if (!allZero) break;
-            }
+            size_t begin, end;
+            bool   zero;
+        };
 
-            //ȫ��Ϊ�� �� ֱ�Ӵ�ӡ zeroinitializer
-            if (allZero)
-            {
-                for (size_t i = 0; i < v.arrayDims.size(); ++i) s << "[" << v.arrayDims[i] << " x ";
-                s << type << std::string(v.arrayDims.size(), ']') << " zeroinitializer";
-                return;
-            }
+        void printArrayType(OutBuffer& s, DataType type, const std::vector<int>& dims, size_t dimDph)
+        {
+            for (size_t i = dimDph; i < dims.size(); ++i) s << "[" << dims[i] << " x ";
+            s << type;
+            s.repeat(']', dims.size() - dimDph);
         }
 
-        //������ײ�ά��
-        if (beginPos == endPos)
+        void printInitElement(OutBuffer& s, DataType type, const FE::AST::VarValue& v)
         {
             switch (type)
             {
                 case DataType::I1:
                 case DataType::I32:
-                case DataType::I64: s << type << " " << v.initList[beginPos].getInt(); break;
+                case DataType::I64: s << type << " " << v.getInt(); break;
                 case DataType::F32:
-                    s << type << " 0x" << std::hex << FLOAT_TO_DOUBLE_BITS(v.initList[beginPos].getFloat()) << std::dec;
+                    s << type << " 0x" << OutBuffer::hex(static_cast<uint64_t>(FLOAT_TO_DOUBLE_BITS(v.getFloat())));
                     break;
                 default: ERROR("Unsupported data type in global array init");
             }
+        }
+
+        // [N x T] [T a, T b, ...]，覆盖 [begin, end)
+        void printDenseRun(OutBuffer& s, DataType type, const FE::AST::SparseInitList& list, size_t begin, size_t end)
+        {
+            s << "[" << (end - begin) << " x " << type << "] [";
+            auto it = list.lowerBound(begin);
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (i != begin) s << ",";
+                if (it != list.end() && it->first == i)
+                    printInitElement(s, type, (it++)->second);
+                else
+                    printInitElement(s, type, FE::AST::VarValue(0));
+            }
+            s << "]";
+        }
+
+        // 把长度为 total 的一维数组按长段 0 切开；切不出长段 0 时返回空
+        std::vector<InitRun> splitZeroRuns(const FE::AST::SparseInitList& list, size_t total)
+        {
+            std::vector<InitRun> runs;
+            size_t               denseBegin = 0, pos = 0;
+            auto                 zeroRun    = [&](size_t end) {
+                if (end - pos < zeroRunThreshold) return;
+                if (denseBegin < pos) runs.push_back({denseBegin, pos, false});
+                runs.push_back({pos, end, true});
+                denseBegin = end;
+            };
+            for (auto& [idx, v] : list)
+            {
+                if (idx >= total) break;
+                if (FE::AST::SparseInitList::isZero(v)) continue;
+                zeroRun(idx);
+                pos = idx + 1;
+            }
+            zeroRun(total);
+            if (denseBegin < total) runs.push_back({denseBegin, total, false});
+            if (runs.size() == 1) runs.clear();
+            return runs;
+        }
+    }  // namespace
+
+    void initArrayGlb(
+        OutBuffer& s, DataType type, const FE::AST::VarAttr& v, size_t dimDph, size_t beginPos, size_t endPos)
+    {
+        //global [3 x i32] [i32 1, i32 2, i32 3]
+        //没有非零元素的子数组直接写作 zeroinitializer，只需查找稀疏列表，不必逐个元素检查
+        if (!v.initList.hasNonZero(beginPos, endPos + 1))
+        {
+            printArrayType(s, type, v.arrayDims, dimDph);
+            s << " zeroinitializer";
             return;
         }
 
-        //�ݹ鴦����ά����
-        for (size_t i = dimDph; i < v.arrayDims.size(); ++i) s << "[" << v.arrayDims[i] << " x ";
-        s << type << std::string(v.arrayDims.size() - dimDph, ']') << " [";
+        //最内层维度
+        if (dimDph + 1 == v.arrayDims.size())
+        {
+            printDenseRun(s, type, v.initList, beginPos, endPos + 1);
+            return;
+        }
 
-        //��ǰά���£�ÿһ��Ԫ�صĸ���
-        /*��� dimDph = 0�����ڴ�����������飬Ҳ���� a[0], a[1], a[2]��
-        ÿһ�� a[i] ��һ����СΪ 4��5 �Ķ�ά���顣*/
-        int step = std::accumulate(v.arrayDims.begin() + dimDph + 1, v.arrayDims.end(), 1, std::multiplies<int>());
+        printArrayType(s, type, v.arrayDims, dimDph);
+        s << " [";
+        size_t step = std::accumulate(
+            v.arrayDims.begin() + dimDph + 1, v.arrayDims.end(), size_t(1), std::multiplies<size_t>());
         for (int i = 0; i < v.arrayDims[dimDph]; ++i)
         {
             if (i != 0) s << ",";
-            //�˴���ʼ�ݹ�
             initArrayGlb(s, type, v, dimDph + 1, beginPos + i * step, beginPos + (i + 1) * step - 1);
         }
-
         s << "]";
     }
 
     //ȫ�ֱ�������
-    std::string GlbVarDeclInst::toString() const
+    void GlbVarDeclInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
-        ss << "@" << name << " = global ";
+        out << "@" << name << " = global ";
         //������
         if (initList.arrayDims.empty())
         {
-            ss << dt << " ";
+            out << dt << " ";
             if (init)
-                ss << init;
+                out << init;
             else
-                ss << "zeroinitializer";
+                out << "zeroinitializer";
         }
         //����
         else
         {
             size_t step = 1;
             for (int dim : initList.arrayDims) step *= dim;
-            //������Ԫ����
-            initArrayGlb(ss, dt, initList, 0, 0, step - 1);
+            std::vector<InitRun> runs;
+            if (initList.arrayDims.size() == 1) runs = splitZeroRuns(initList.initList, step);
+            if (runs.empty())
+            {
+                //������Ԫ����
+                initArrayGlb(out, dt, initList, 0, 0, step - 1);
+            }
+            else
+            {
+                //一维数组中的长段 0 写成 packed struct，内存布局不变：
+                //<{ [1 x i32], [999 x i32] }> <{ [1 x i32] [i32 1], [999 x i32] zeroinitializer }>
+                out << "<{ ";
+                for (size_t i = 0; i < runs.size(); ++i)
+                    out << (i ? ", [" : "[") << (runs[i].end - runs[i].begin) << " x " << dt << "]";
+                out << " }> <{ ";
+                for (size_t i = 0; i < runs.size(); ++i)
+                {
+                    if (i) out << ", ";
+                    if (runs[i].zero)
+                        out << "[" << (runs[i].end - runs[i].begin) << " x " << dt << "] zeroinitializer";
+                    else
+                        printDenseRun(out, dt, initList.initList, runs[i].begin, runs[i].end);
+                }
+                out << " }>";
+            }
         }
-        ss << getComment();
-        return ss.str();
+        out << getComment();
     }
 
-    std::string CallInst::toString() const
+    void CallInst::print(OutBuffer& out) const
     {
         //%r = call i32 @foo(i32 %a, float %b)
-        std::stringstream ss;
-        if (retType != DataType::VOID) ss << res << " = ";
-        ss << "call " << retType << " @" << funcName << "(";
+        if (retType != DataType::VOID) out << res << " = ";
+        out << "call " << retType << " @" << funcName << "(";
 
         for (auto it = args.begin(); it != args.end(); ++it)
         {
-            ss << it->first << " " << it->second;
-            if (std::next(it) != args.end()) ss << ", ";
+            out << it->first << " " << it->second;
+            if (std::next(it) != args.end()) out << ", ";
         }
-        ss << ")" << getComment();
-        return ss.str();
+        out << ")" << getComment();
     }
 
-    std::string RetInst::toString() const
+    void RetInst::print(OutBuffer& out) const
     {
         //ret i32 %x
         //ret void
-        std::stringstream ss;
-        ss << "ret " << rt;
-        if (res) ss << " " << res;
-        ss << getComment();
-        return ss.str();
+        out << "ret " << rt;
+        if (res) out << " " << res;
+        out << getComment();
     }
 
-    std::string FuncDeclInst::toString() const
+    void FuncDeclInst::print(OutBuffer& out) const
     {
         //��������������������
         //declare i32 @foo(i32, float)
-        std::stringstream ss;
-        ss << "declare " << retType << " @" << funcName << "(";
+        out << "declare " << retType << " @" << funcName << "(";
         for (auto it = argTypes.begin(); it != argTypes.end(); ++it)
         {
-            ss << *it;
-            if (std::next(it) != argTypes.end()) ss << ", ";
+            out << *it;
+            if (std::next(it) != argTypes.end()) out << ", ";
         }
-        if (isVarArg) ss << ", ...";
-        ss << ")" << getComment();
-        return ss.str();
+        if (isVarArg) out << ", ...";
+        out << ")" << getComment();
     }
 
-    std::string FuncDefInst::toString() const
+    void FuncDefInst::print(OutBuffer& out) const
     {
         //��������ͷ��
         //define i32 @foo(i32 %a, i32 %b)
-        std::stringstream ss;
-        ss << "define " << retType << " @" << funcName << "(";
+        out << "define " << retType << " @" << funcName << "(";
 
         for (auto it = argRegs.begin(); it != argRegs.end(); ++it)
         {
-            ss << it->first << " " << it->second;
-            if (std::next(it) != argRegs.end()) ss << ", ";
+            out << it->first << " " << it->second;
+            if (std::next(it) != argRegs.end()) out << ", ";
         }
-        ss << ")" << getComment();
-        return ss.str();
+        out << ")" << getComment();
     }
 
-    std::string GEPInst::toString() const
+    void GEPInst::print(OutBuffer& out) const
     {
         //���� LLVM GEP
         //%p = getelementptr [3 x [4 x i32]], ptr %base, i32 0, i32 2
-        std::stringstream ss;
-        ss << res << " = getelementptr ";
+        out << res << " = getelementptr ";
         if (dims.empty())
-            ss << dt;
+            out << dt;
         else
         {
-            for (int dim : dims) ss << "[" << dim << " x ";
-            ss << dt << std::string(dims.size(), ']');
+            for (int dim : dims) out << "[" << dim << " x ";
+            out << dt;
+            out.repeat(']', dims.size());
         }
 
-        ss << ", ptr " << basePtr;
-        for (auto& idx : idxs) ss << ", " << idxType << " " << idx;
-        ss << getComment();
-        return ss.str();
+        out << ", ptr " << basePtr;
+        for (auto& idx : idxs) out << ", " << idxType << " " << idx;
+        out << getComment();
     }
 
-    std::string SI2FPInst::toString() const
+    void SI2FPInst::print(OutBuffer& out) const
     {
         //%f = sitofp i32 %i to float
-        std::stringstream ss;
-        ss << dest << " = sitofp i32 " << src << " to float" << getComment();
-        return ss.str();
+        out << dest << " = sitofp i32 " << src << " to float" << getComment();
     }
 
-    std::string FP2SIInst::toString() const
+    void FP2SIInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
         //%i = fptosi float %f to i32
-        ss << dest << " = fptosi float " << src << " to i32" << getComment();
-        return ss.str();
+        out << dest << " = fptosi float " << src << " to i32" << getComment();
     }
 
-    std::string ZextInst::toString() const
+    void ZextInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
         //����չ
         //%z = zext i1 %x to i32
-        ss << dest << " = zext " << from << " " << src << " to " << to << getComment();
-        return ss.str();
+        out << dest << " = zext " << from << " " << src << " to " << to << getComment();
     }
 
-    std::string PhiInst::toString() const
+    void PhiInst::print(OutBuffer& out) const
     {
-        std::stringstream ss;
         //%r = phi i32 [ %a, %L1 ], [ %b, %L2 ]
-        ss << res << " = phi " << dt << " ";
+        out << res << " = phi " << dt << " ";
 
         for (auto it = incomingVals.begin(); it != incomingVals.end(); ++it)
         {
-            ss << "[ " << it->second << ", " << it->first << " ]";
-            if (std::next(it) != incomingVals.end()) ss << ", ";
+            out << "[ " << it->second << ", " << it->first << " ]";
+            if (std::next(it) != incomingVals.end()) out << ", ";
         }
-        ss << getComment();
-        return ss.str();
+        out << getComment();
     }
 }  // namespace ME
@@ -5,6 +5,8 @@
 #include <middleend/ir_visitor.h>
 #include <middleend/module/ir_operand.h>
 #include <frontend/ast/ast_defs.h>
+#include <arena.h>
+#include <ilist.h>
 #include <string>
 #include <vector>
 #include <utility>
@@ -19,35 +21,68 @@ namespace ME
    */
 
     //Instruction抽象基类确立了所有IR指令必须遵守的基本结构和接口
-    class Instruction : public Visitable, public InsVisitable
+    //指令通过IListNode挂在所属基本块的侵入式链表上，getParent()返回所在的Block
+    class Instruction : public Visitable, public InsVisitable, public IListNode<Instruction, Block>
     {
       public:
         Operator opcode;//操作码，存储指令类型
 
       public:
+        /*
+         * 注释只保存指针，不再为每条指令内嵌一个std::string：
+         * 传入的字符串需要比指令活得久（字符串字面量，或经Function::copyString复制进内存池）
+         */
 #ifndef ENABLE_IRINST_COMMENT
-        Instruction(Operator op, const std::string& c = "") : opcode(op) {}
-        void        setComment(const std::string& c) {}
-        std::string getComment() const
-        {
-            if (comment.empty()) return "";
-            return " ; " + comment;
-        }
+        Instruction(Operator op, const char* c = nullptr) : opcode(op) {}
+        void        setComment(const char* c) {}
+        std::string_view getComment() const { return {}; }
 #else
-        std::string comment;
-        Instruction(Operator op, const std::string& c = "") : opcode(op), comment(c) {}
-        void        setComment(const std::string& c) { comment = c; }
-        std::string getComment() const { return ""; }
+        const char* comment;
+        Instruction(Operator op, const char* c = nullptr) : opcode(op), comment(c) {}
+        void        setComment(const char* c) { comment = c; }
+        std::string_view getComment() const { return {}; }
 #endif
         virtual ~Instruction() = default;
 
       public:
-        virtual std::string toString() const                     = 0;
-        virtual void        accept(Visitor& visitor) override    = 0;
-        virtual void        accept(InsVisitor& visitor) override = 0;
+        /*
+         * 指令前统一留一个头部，记录它来自哪个内存池(Arena)：
+         * - new X(...)          : 普通堆分配，头部为nullptr
+         * - new (arena) X(...)  : 从函数的内存池分配
+         * delete 时据此把内存交还给堆或内存池的空闲链表，调用方无需区分
+         */
+        static void*  operator new(size_t size);
+        static void*  operator new(size_t size, Arena& arena);
+        static void   operator delete(void* p, size_t size);
+        static void   operator delete(void* p, Arena& arena);
+        static Arena* getArena(const Instruction* inst);
+
+      public:
+        //把指令文本直接写入输出缓冲区，IR打印走这条路径，不为每条指令构造临时字符串
+        virtual void print(OutBuffer& out) const                 = 0;
+        virtual void accept(Visitor& visitor) override           = 0;
+        virtual void accept(InsVisitor& visitor) override        = 0;
+
+        std::string toString() const;
 
         //块终结指令，表示后面不能再出现别的IR指令
         virtual bool isTerminator() const = 0;
+
+        //指令定义的值（结果寄存器），没有定义时返回nullptr
+        virtual Operand* getDef() const { return nullptr; }
+        //收集指令使用的值操作数所在的槽位（不含跳转标签），def-use链与RAUW都基于它实现
+        virtual void getUseSlots(std::vector<Operand**>& slots) {}
+
+        //指令使用的全部非空值操作数
+        std::vector<Operand*> getUses()
+        {
+            std::vector<Operand**> slots;
+            getUseSlots(slots);
+            std::vector<Operand*> uses;
+            for (auto* slot : slots)
+                if (*slot) uses.push_back(*slot);
+            return uses;
+        }
     };
 
     class LoadInst : public Instruction
@@ -58,15 +93,18 @@ namespace ME
         Operand* res;
 
       public:
-        LoadInst(DataType t, Operand* p, Operand* d, const std::string& c = "")
+        LoadInst(DataType t, Operand* p, Operand* d, const char* c = nullptr)
             : Instruction(Operator::LOAD, c), dt(t), ptr(p), res(d)
         {}
         ~LoadInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&ptr); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -79,15 +117,21 @@ namespace ME
         Operand* val;
 
       public:
-        StoreInst(DataType t, Operand* v, Operand* p, const std::string& c = "")
+        StoreInst(DataType t, Operand* v, Operand* p, const char* c = nullptr)
             : Instruction(Operator::STORE, c), dt(t), ptr(p), val(v)
         {}
         ~StoreInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&ptr);
+            slots.push_back(&val);
+        }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -101,15 +145,22 @@ namespace ME
         Operand* res;
 
       public:
-        ArithmeticInst(Operator op, DataType t, Operand* l, Operand* r, Operand* d, const std::string& c = "")
+        ArithmeticInst(Operator op, DataType t, Operand* l, Operand* r, Operand* d, const char* c = nullptr)
             : Instruction(op, c), dt(t), lhs(l), rhs(r), res(d)
         {}
         ~ArithmeticInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&lhs);
+            slots.push_back(&rhs);
+        }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -130,9 +181,16 @@ namespace ME
         ~IcmpInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&lhs);
+            slots.push_back(&rhs);
+        }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -153,9 +211,16 @@ namespace ME
         ~FcmpInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&lhs);
+            slots.push_back(&rhs);
+        }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -168,15 +233,17 @@ namespace ME
         std::vector<int> dims;
 
       public:
-        AllocaInst(DataType t, Operand* r, std::vector<int> d = {}, const std::string& c = "")
+        AllocaInst(DataType t, Operand* r, std::vector<int> d = {}, const char* c = nullptr)
             : Instruction(Operator::ALLOCA, c), dt(t), res(r), dims(d)
         {}
         ~AllocaInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return res; }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -189,15 +256,17 @@ namespace ME
         Operand* falseTar;
 
       public:
-        BrCondInst(Operand* c, Operand* t, Operand* f, const std::string& cm = "")
+        BrCondInst(Operand* c, Operand* t, Operand* f, const char* cm = nullptr)
             : Instruction(Operator::BR_COND, cm), cond(c), trueTar(t), falseTar(f)
         {}
         ~BrCondInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&cond); }
 
         virtual bool isTerminator() const override { return true; }
     };
@@ -208,13 +277,13 @@ namespace ME
         Operand* target;
 
       public:
-        BrUncondInst(Operand* t, const std::string& c = "") : Instruction(Operator::BR_UNCOND, c), target(t) {}
+        BrUncondInst(Operand* t, const char* c = nullptr) : Instruction(Operator::BR_UNCOND, c), target(t) {}
         ~BrUncondInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
         virtual bool isTerminator() const override { return true; }
     };
@@ -238,9 +307,9 @@ namespace ME
         ~GlbVarDeclInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -259,18 +328,21 @@ namespace ME
         Operand* res;
 
       public:
-        CallInst(DataType rt, const std::string& fn, Operand* r = nullptr, const std::string& c = "")
+        CallInst(DataType rt, const std::string& fn, Operand* r = nullptr, const char* c = nullptr)
             : Instruction(Operator::CALL, c), retType(rt), funcName(fn), args({}), res(r)
         {}
-        CallInst(DataType rt, const std::string& fn, argList a, Operand* r = nullptr, const std::string& c = "")
+        CallInst(DataType rt, const std::string& fn, argList a, Operand* r = nullptr, const char* c = nullptr)
             : Instruction(Operator::CALL, c), retType(rt), funcName(fn), args(a), res(r)
         {}
         ~CallInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { for (auto& arg : args) slots.push_back(&arg.second); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -282,15 +354,17 @@ namespace ME
         Operand* res;
 
       public:
-        RetInst(DataType t, Operand* r = nullptr, const std::string& c = "")
+        RetInst(DataType t, Operand* r = nullptr, const char* c = nullptr)
             : Instruction(Operator::RET, c), rt(t), res(r)
         {}
         ~RetInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&res); }
 
         virtual bool isTerminator() const override { return true; }
     };
@@ -306,15 +380,15 @@ namespace ME
 
       public:
         FuncDeclInst(DataType rt, const std::string& fn, std::vector<DataType> at = {}, bool is_va = false,
-            const std::string& c = "")
+            const char* c = nullptr)
             : Instruction(Operator::FUNCDECL, c), retType(rt), funcName(fn), argTypes(at), isVarArg(is_va)
         {}
         ~FuncDeclInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -333,15 +407,15 @@ namespace ME
         argList argRegs;
 
       public:
-        FuncDefInst(DataType rt, const std::string& fn, argList ar = {}, const std::string& c = "")
+        FuncDefInst(DataType rt, const std::string& fn, argList ar = {}, const char* c = nullptr)
             : Instruction(Operator::FUNCDEF, c), retType(rt), funcName(fn), argRegs(ar)
         {}
         ~FuncDefInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -365,9 +439,16 @@ namespace ME
         ~GEPInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override
+        {
+            slots.push_back(&basePtr);
+            for (auto& idx : idxs) slots.push_back(&idx);
+        }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -384,9 +465,12 @@ namespace ME
         ~SI2FPInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return dest; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&src); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -403,9 +487,12 @@ namespace ME
         ~FP2SIInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return dest; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&src); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -426,9 +513,12 @@ namespace ME
         ~ZextInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
+
+        virtual Operand* getDef() const override { return dest; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { slots.push_back(&src); }
 
         virtual bool isTerminator() const override { return false; }
     };
@@ -442,18 +532,28 @@ namespace ME
 
         using ValOp   = Operand*;
         using LabelOp = Operand*;
-        std::map<LabelOp, ValOp> incomingVals;  // label -> value
+
+        // 按标签编号而不是操作数地址排序，打印和遍历顺序与操作数在哪个线程、哪块内存上分配无关
+        struct LabelLess
+        {
+            bool operator()(const Operand* a, const Operand* b) const
+            {
+                return static_cast<const LabelOperand*>(a)->lnum < static_cast<const LabelOperand*>(b)->lnum;
+            }
+        };
+        using IncomingMap = std::map<LabelOp, ValOp, LabelLess>;
+        IncomingMap incomingVals;  // label -> value
 
       public:
-        PhiInst(DataType t, Operand* r, const std::string& c = "")
+        PhiInst(DataType t, Operand* r, const char* c = nullptr)
             : Instruction(Operator::PHI, c), dt(t), res(r), incomingVals({})
         {}
         ~PhiInst() override = default;
 
       public:
-        virtual std::string toString() const override;
-        virtual void        accept(Visitor& visitor) override { visitor.visit(*this); }
-        virtual void        accept(InsVisitor& visitor) override { visitor.visit(*this); }
+        virtual void print(OutBuffer& out) const override;
+        virtual void accept(Visitor& visitor) override { visitor.visit(*this); }
+        virtual void accept(InsVisitor& visitor) override { visitor.visit(*this); }
         void                addIncoming(ValOp v, LabelOp l)
         {
             auto it = incomingVals.find(l);
@@ -464,6 +564,9 @@ namespace ME
             incomingVals[l] = v;
         }
 
+        virtual Operand* getDef() const override { return res; }
+        virtual void     getUseSlots(std::vector<Operand**>& slots) override { for (auto& [label, val] : incomingVals) slots.push_back(&val); }
+
         virtual bool isTerminator() const override { return false; }
     };
 }  // namespace ME
@@ -1,54 +1,86 @@
 #include <middleend/module/ir_operand.h>
+#include <algorithm>
+#include <cstring>
 
 namespace ME
 {
-    OperandFactory::~OperandFactory()
+    static uint32_t floatBits(float value)
     {
-        for (auto& [k, v] : ImmeI32OperandMap) delete v;
-        for (auto& [k, v] : ImmeF32OperandMap) delete v;
-        for (auto& [k, v] : RegOperandMap) delete v;
-        for (auto& [k, v] : LabelOperandMap) delete v;
-        for (auto& [k, v] : GlobalOperandMap) delete v;
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    RegOperand* OperandTable::newRegOperand(size_t id)
+    {
+        if (id >= regs.size()) regs.resize(std::max(id + 1, regs.size() * 2), nullptr);
+        RegOperand* op = new (arena.allocate(sizeof(RegOperand))) RegOperand(id);
+        regs[id]       = op;
+        return op;
     }
 
-    RegOperand* OperandFactory::getRegOperand(size_t id)
+    LabelOperand* OperandTable::newLabelOperand(size_t num)
     {
-        auto it = RegOperandMap.find(id);
-        if (it == RegOperandMap.end())
+        if (num >= labels.size()) labels.resize(std::max(num + 1, labels.size() * 2), nullptr);
+        LabelOperand* op = new (arena.allocate(sizeof(LabelOperand))) LabelOperand(num);
+        labels[num]      = op;
+        return op;
+    }
+
+    ImmeI32Operand* OperandTable::getImmeI32Operand(int value)
+    {
+        uint32_t        key = static_cast<uint32_t>(value);
+        ImmeI32Operand* op  = immeI32s.find(key);
+        if (!op)
         {
-            RegOperand* op    = new RegOperand(id);
-            RegOperandMap[id] = op;
-            return op;
+            op = new (arena.allocate(sizeof(ImmeI32Operand))) ImmeI32Operand(value);
+            immeI32s.insert(key, op);
         }
-        return it->second;
+        return op;
     }
 
-    ImmeI32Operand* OperandFactory::getImmeI32Operand(int value)
+    ImmeF32Operand* OperandTable::getImmeF32Operand(float value)
     {
-        auto it = ImmeI32OperandMap.find(value);
-        if (it == ImmeI32OperandMap.end())
+        uint32_t        key = floatBits(value);
+        ImmeF32Operand* op  = immeF32s.find(key);
+        if (!op)
         {
-            ImmeI32Operand* op       = new ImmeI32Operand(value);
-            ImmeI32OperandMap[value] = op;
-            return op;
+            op = new (arena.allocate(sizeof(ImmeF32Operand))) ImmeF32Operand(value);
+            immeF32s.insert(key, op);
         }
-        return it->second;
+        return op;
+    }
+
+    void OperandTable::release()
+    {
+        // 操作数只含平凡成员，直接归还内存池即可，无需逐个析构
+        regs.clear();
+        labels.clear();
+        immeI32s.clear();
+        immeF32s.clear();
+        arena.release();
+    }
+
+    OperandFactory::~OperandFactory()
+    {
+        for (auto& [k, v] : GlobalOperandMap) delete v;
+    }
+
+    ImmeI32Operand* OperandFactory::getImmeI32Operand(int value)
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        return constants.getImmeI32Operand(value);
     }
 
     ImmeF32Operand* OperandFactory::getImmeF32Operand(float value)
     {
-        auto it = ImmeF32OperandMap.find(value);
-        if (it == ImmeF32OperandMap.end())
-        {
-            ImmeF32Operand* op       = new ImmeF32Operand(value);
-            ImmeF32OperandMap[value] = op;
-            return op;
-        }
-        return it->second;
+        std::lock_guard<std::mutex> lock(mtx);
+        return constants.getImmeF32Operand(value);
     }
 
     GlobalOperand* OperandFactory::getGlobalOperand(const std::string& name)
     {
+        std::lock_guard<std::mutex> lock(mtx);
         auto it = GlobalOperandMap.find(name);
         if (it == GlobalOperandMap.end())
         {
@@ -59,29 +91,31 @@ namespace ME
         return it->second;
     }
 
-    LabelOperand* OperandFactory::getLabelOperand(size_t num)
+    std::string Operand::toString() const
     {
-        auto it = LabelOperandMap.find(num);
-        if (it == LabelOperandMap.end())
+        std::ostringstream ss;
         {
-            LabelOperand* op     = new LabelOperand(num);
-            LabelOperandMap[num] = op;
-            return op;
+            OutBuffer out(ss, 256);
+            print(out);
         }
-        return it->second;
+        return ss.str();
     }
 
     OperandFactory& ofInstance = OperandFactory::getInstance();
 }  // namespace ME
 
-ME::RegOperand*     getRegOperand(size_t id) { return ME::ofInstance.getRegOperand(id); }
 ME::ImmeI32Operand* getImmeI32Operand(int value) { return ME::ofInstance.getImmeI32Operand(value); }
 ME::ImmeF32Operand* getImmeF32Operand(float value) { return ME::ofInstance.getImmeF32Operand(value); }
 ME::GlobalOperand*  getGlobalOperand(const std::string& name) { return ME::ofInstance.getGlobalOperand(name); }
-ME::LabelOperand*   getLabelOperand(size_t num) { return ME::ofInstance.getLabelOperand(num); }
 
 std::ostream& operator<<(std::ostream& os, const ME::Operand* op)
 {
     os << op->toString();
     return os;
 }
+
+OutBuffer& operator<<(OutBuffer& out, const ME::Operand* op)
+{
+    op->print(out);
+    return out;
+}
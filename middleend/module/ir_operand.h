@@ -3,14 +3,20 @@
 
 #include <middleend/ir_defs.h>
 #include <transfer.h>
+#include <out_buffer.h>
 #include <debug.h>
+#include <arena.h>
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace ME
 {
     class OperandFactory;
+    class OperandTable;
 
     class Operand
     {
@@ -22,15 +28,18 @@ namespace ME
         virtual ~Operand() = default;
 
       public:
-        OperandType         getType() const { return type; }
-        virtual std::string toString() const  = 0;
-        virtual size_t      getRegNum() const = 0;
+        OperandType  getType() const { return type; }
+        virtual void print(OutBuffer& out) const = 0;  // 直接写入输出缓冲区，不构造临时字符串
+        virtual size_t getRegNum() const       = 0;
+
+        std::string toString() const;
     };
 
     //�Ĵ���������
     class RegOperand : public Operand
     {
         friend class OperandFactory;
+        friend class OperandTable;
 
       public:
         size_t regNum;  //�Ĵ������
@@ -40,14 +49,15 @@ namespace ME
         virtual ~RegOperand() = default;
 
       public:
-        virtual std::string toString() const override { return "%reg_" + std::to_string(regNum); }
-        virtual size_t      getRegNum() const override { return regNum; }
+        virtual void   print(OutBuffer& out) const override { out << "%reg_" << regNum; }
+        virtual size_t getRegNum() const override { return regNum; }
     };
 
     //������������������
     class ImmeI32Operand : public Operand
     {
         friend class OperandFactory;
+        friend class OperandTable;
 
       public:
         int value;    //�洢����������ֵ
@@ -57,14 +67,15 @@ namespace ME
         virtual ~ImmeI32Operand() = default;
 
       public:
-        virtual std::string toString() const override { return std::to_string(value); }
-        virtual size_t      getRegNum() const override { ERROR("ImmeI32Operand does not have a register"); }
+        virtual void   print(OutBuffer& out) const override { out << value; }
+        virtual size_t getRegNum() const override { ERROR("ImmeI32Operand does not have a register"); }
     };
 
     //��������������������
     class ImmeF32Operand : public Operand
     {
         friend class OperandFactory;
+        friend class OperandTable;
 
       public:
         float value;
@@ -74,12 +85,10 @@ namespace ME
         virtual ~ImmeF32Operand() = default;
 
       public:
-        virtual std::string toString() const override
+        virtual void print(OutBuffer& out) const override
         {
-            std::stringstream ss;
             //�����ʮ�������ַ�����ʾ
-            ss << "0x" << std::hex << FLOAT_TO_DOUBLE_BITS(value);
-            return ss.str();
+            out << "0x" << OutBuffer::hex(static_cast<uint64_t>(FLOAT_TO_DOUBLE_BITS(value)));
         }
         virtual size_t getRegNum() const override { ERROR("ImmeF32Operand does not have a register"); }
     };
@@ -97,10 +106,10 @@ namespace ME
     virtual ~GlobalOperand() = default;
 
   public:
-    // 关键修复 1：toString() 必须带有 '@' 前缀 
+    // 关键修复 1：输出必须带有 '@' 前缀 
     // GlobalOperand::toString() 应该返回 "@a0"
-    virtual std::string toString() const override { 
-        return "@" + name; // 确保返回 "@a0", "@foo", ...
+    virtual void print(OutBuffer& out) const override { 
+        out << '@' << name; // 确保输出 "@a0", "@foo", ...
     }
 
     // 关键修复 2：全局变量没有虚拟寄存器号
@@ -114,6 +123,7 @@ namespace ME
     class LabelOperand : public Operand
     {
         friend class OperandFactory;
+        friend class OperandTable;
 
       public:
         size_t lnum;    //��ǩ���
@@ -123,8 +133,112 @@ namespace ME
         virtual ~LabelOperand() = default;
 
       public:
-        virtual std::string toString() const override { return "%Block" + std::to_string(lnum); }
-        virtual size_t      getRegNum() const override { ERROR("LabelOperand does not have a register"); }
+        virtual void   print(OutBuffer& out) const override { out << "%Block" << lnum; }
+        virtual size_t getRegNum() const override { ERROR("LabelOperand does not have a register"); }
+    };
+
+    /*
+     * 立即数表：以值的32位比特模式为键的开放寻址哈希表（线性探测），
+     * 槽位连续存放在一个数组里，查找不需要沿指针跳转
+     */
+    template <typename ImmeT>
+    class ImmeTable
+    {
+      private:
+        struct Slot
+        {
+            uint32_t key;
+            ImmeT*   op;  // nullptr 表示空槽
+        };
+        std::vector<Slot> slots;
+        size_t            count;
+
+        static size_t hash(uint32_t key) { return static_cast<size_t>(key * 0x9E3779B1u); }
+
+        void grow()
+        {
+            std::vector<Slot> old = std::move(slots);
+            slots.assign(old.empty() ? 16 : old.size() * 2, Slot{0, nullptr});
+            for (auto& slot : old)
+                if (slot.op) place(slot.key, slot.op);
+        }
+        void place(uint32_t key, ImmeT* op)
+        {
+            size_t mask = slots.size() - 1;
+            size_t i    = hash(key) & mask;
+            while (slots[i].op) i = (i + 1) & mask;
+            slots[i] = Slot{key, op};
+        }
+
+      public:
+        ImmeTable() : slots(), count(0) {}
+
+        ImmeT* find(uint32_t key) const
+        {
+            if (slots.empty()) return nullptr;
+            size_t mask = slots.size() - 1;
+            for (size_t i = hash(key) & mask; slots[i].op; i = (i + 1) & mask)
+                if (slots[i].key == key) return slots[i].op;
+            return nullptr;
+        }
+        void insert(uint32_t key, ImmeT* op)
+        {
+            // 装载因子保持在 3/4 以下
+            if ((count + 1) * 4 > slots.size() * 3) grow();
+            place(key, op);
+            ++count;
+        }
+        void clear()
+        {
+            slots.clear();
+            count = 0;
+        }
+    };
+
+    /*
+     * 函数级操作数表：
+     * - 虚拟寄存器与标签按编号直接索引稠密数组，查找为 O(1) 的数组访问
+     * - 立即数放在 ImmeTable 中，同一函数内值相同的立即数共享同一个对象
+     * - 操作数对象从表内的内存池分配，函数销毁（或 release()）时一次性归还
+     * 不同函数的 %reg_5 是不同的对象，因此只能在同一函数内按指针比较操作数
+     */
+    class OperandTable
+    {
+      private:
+        Arena                      arena;
+        std::vector<RegOperand*>   regs;
+        std::vector<LabelOperand*> labels;
+        ImmeTable<ImmeI32Operand>  immeI32s;
+        ImmeTable<ImmeF32Operand>  immeF32s;
+
+      public:
+        OperandTable() : arena(4 * 1024), regs(), labels(), immeI32s(), immeF32s() {}
+        ~OperandTable() = default;
+
+        OperandTable(const OperandTable&)            = delete;
+        OperandTable& operator=(const OperandTable&) = delete;
+
+      public:
+        RegOperand* getRegOperand(size_t id)
+        {
+            if (id < regs.size() && regs[id]) return regs[id];
+            return newRegOperand(id);
+        }
+        LabelOperand* getLabelOperand(size_t num)
+        {
+            if (num < labels.size() && labels[num]) return labels[num];
+            return newLabelOperand(num);
+        }
+        ImmeI32Operand* getImmeI32Operand(int value);
+        ImmeF32Operand* getImmeF32Operand(float value);
+
+        //释放表中全部操作数，之前返回的指针全部失效
+        void   release();
+        size_t getBytesUsed() const { return arena.getBytesUsed(); }
+
+      private:
+        RegOperand*   newRegOperand(size_t id);
+        LabelOperand* newLabelOperand(size_t num);
     };
 
     class OperandFactory
@@ -132,22 +246,22 @@ namespace ME
       /*
       ����Ϊһ�����������ڴ�����ͬ���͵�operand����ά��һ�����������͵������ӳ��
       */
+      /*
+      寄存器与标签操作数属于具体函数，见 Function::getRegOperand 等接口；
+      这里只保留模块级的全局变量，以及全局变量初始值等函数之外用到的立即数
+      */
       private:
-        std::map<int, ImmeI32Operand*>        ImmeI32OperandMap;
-        std::map<float, ImmeF32Operand*>      ImmeF32OperandMap;
-        std::map<size_t, RegOperand*>         RegOperandMap;
-        std::map<size_t, LabelOperand*>       LabelOperandMap;
+        OperandTable                          constants;
         std::map<std::string, GlobalOperand*> GlobalOperandMap;
+        std::mutex                            mtx;  // 模块级操作数可能被多个线程同时获取
 
         OperandFactory() = default;
         ~OperandFactory();
 
       public:
-        RegOperand*     getRegOperand(size_t id);
         ImmeI32Operand* getImmeI32Operand(int value);
         ImmeF32Operand* getImmeF32Operand(float value);
         GlobalOperand*  getGlobalOperand(const std::string& name);
-        LabelOperand*   getLabelOperand(size_t num);
 
         static OperandFactory& getInstance()
         {
@@ -157,12 +271,11 @@ namespace ME
     };
 }  // namespace ME
 
-ME::RegOperand*     getRegOperand(size_t id);
 ME::ImmeI32Operand* getImmeI32Operand(int value);
 ME::ImmeF32Operand* getImmeF32Operand(float value);
 ME::GlobalOperand*  getGlobalOperand(const std::string& name);
-ME::LabelOperand*   getLabelOperand(size_t num);
 
 std::ostream& operator<<(std::ostream& os, const ME::Operand* op);
+OutBuffer&    operator<<(OutBuffer& out, const ME::Operand* op);
 
 #endif  // __MIDDLEEND_MODULE_IR_OPERAND_H__
@@ -3,6 +3,7 @@
 #include <middleend/module/ir_operand.h>
 #include <middleend/pass/analysis/cfg.h>
 #include <middleend/pass/analysis/analysis_manager.h>
+#include <middleend/pass/pass_manager.h>
 #include <set>
 #include <map>
 #include <vector>
@@ -10,6 +11,14 @@
 
 namespace ME
 {
+    namespace
+    {
+        struct AutoRegister
+        {
+            AutoRegister() { PassRegistry::registerPassFactory("adce", []() -> Pass* { return new ADCEPass(); }); }
+        } s_auto_register;
+    }  // namespace
+
     /**
      * @brief 运行激进死代码消除 Pass (Aggressive Dead Code Elimination)
      * 
@@ -25,26 +34,43 @@ namespace ME
      * 3. 控制流简化 (Control Flow Simplification)
      *    - 为什么？删除指令后会留下空的跳转块或冗余分支，需要清理以减少代码体积和执行开销。
      */
-    void ADCEPass::runOnFunction(Function& function)
+    PreservedAnalyses ADCEPass::runOnFunction(Function& function)
     {
-        if (function.blocks.empty()) return;
+        if (function.blocks.empty()) return PreservedAnalyses::all();
+
+        // 预算已经用完时跳过，交给后面只做一遍 Mark-Sweep 的 DCE；
+        // 运行中用完时不再继续迭代，已完成的每一步变换都是完整的，最后照常清理 PHI
+        FunctionBudget* budget       = FunctionBudget::current();
+        bool            outOfBudget  = false;
+        auto            chargeBudget = [&]() {
+            if (budget && !budget->consume(PassTimer::countInsts(function))) outOfBudget = true;
+        };
+        if (budget && budget->exhausted())
+        {
+            budget->note("adce", "skipped");
+            return PreservedAnalyses::all();
+        }
+
+        // 构建 def-use 链，后续的指令/基本块删除都通过 Block/Function 接口完成，链保持同步
+        function.buildDefUse();
         
         bool globalChanged = true;
+        bool anyChanged    = false;
         int maxOuterIterations = 50; // 防止无限循环的安全上限
         
-        for (int outer = 0; outer < maxOuterIterations && globalChanged; ++outer)
+        for (int outer = 0; outer < maxOuterIterations && globalChanged && !outOfBudget; ++outer)
         {
             globalChanged = false;
             
-            // 每次迭代前更新 CFG 分析
-            Analysis::AM.invalidate(function);
+            // 每次迭代前更新 CFG 分析；第一轮可以直接复用前序 Pass 保留下来的 CFG
+            if (outer > 0) Analysis::AM.invalidate(function);
             auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
             
             // 步骤 1: 移除死循环
             // 策略：如果一个循环没有副作用（无 IO/全局写），且计算结果不被外部使用，直接删除整个循环。
             // 为什么？编译器优化应当消除无效的计算资源消耗，即使是无限循环，如果它不产生可观测行为，也是可以移除的。
             bool changed = true;
-            while (changed)
+            while (changed && !outOfBudget)
             {
                 changed = removeDeadLoops(function, cfg);
                 if (changed)
@@ -53,13 +79,14 @@ namespace ME
                     Analysis::AM.invalidate(function);
                     cfg = Analysis::AM.get<Analysis::CFG>(function);
                 }
+                chargeBudget();
             }
             
             // 步骤 2: ADCE 核心迭代 (活跃性传播 + 删除)
             // 策略：从 Side-Effect 指令开始，沿着数据依赖和控制依赖反向传播活跃性。
             // 为什么？这是基于“可观测性”的优化。只有影响最终输出（Side Effect）的指令才是必须执行的。
             changed = true;
-            while (changed)
+            while (changed && !outOfBudget)
             {
                 changed = runADCEIteration(function, cfg);
                 if (changed)
@@ -68,22 +95,29 @@ namespace ME
                     Analysis::AM.invalidate(function);
                     cfg = Analysis::AM.get<Analysis::CFG>(function);
                 }
+                chargeBudget();
             }
             
             // 步骤 3: 控制流简化
             // 策略：清理 ADCE 留下的碎片，如合并跳转块、删除不可达块、简化条件分支。
-            for (int i = 0; i < 20; ++i)
+            for (int i = 0; i < 20 && !outOfBudget; ++i)
             {
                 Analysis::AM.invalidate(function);
                 cfg = Analysis::AM.get<Analysis::CFG>(function);
-                if (!simplifyControlFlow(function, cfg))
+                bool simplified = simplifyControlFlow(function, cfg);
+                chargeBudget();
+                if (!simplified)
                     break;
                 globalChanged = true;
             }
+            anyChanged |= globalChanged;
         }
+        if (outOfBudget) budget->note("adce", "stopped iterating early");
         
         // 最后清理 PHI 节点，确保没有悬空的引用
         cleanupPhiNodes(function);
+
+        return anyChanged ? PreservedAnalyses::none() : PreservedAnalyses::all();
     }
 
     /**
@@ -113,9 +147,9 @@ namespace ME
             
             // 条件：块内只有一条 BR_UNCOND 指令
             if (block->insts.size() != 1) continue;
-            if (block->insts[0]->opcode != Operator::BR_UNCOND) continue;
+            if (block->insts.front()->opcode != Operator::BR_UNCOND) continue;
             
-            auto* br = static_cast<BrUncondInst*>(block->insts[0]);
+            auto* br = static_cast<BrUncondInst*>(block->insts.front());
             if (!br->target || br->target->getType() != OperandType::LABEL)
                 continue;
             
@@ -132,7 +166,7 @@ namespace ME
                 {
                     if (inst->opcode != Operator::PHI) break;
                     PhiInst* phi = static_cast<PhiInst*>(inst);
-                    Operand* label = getLabelOperand(blockId);
+                    Operand* label = function.getLabelOperand(blockId);
                     if (phi->incomingVals.find(label) != phi->incomingVals.end())
                     {
                         hasPhiRef = true;
@@ -200,8 +234,8 @@ namespace ME
                         if (inst->opcode != Operator::PHI) break;
                         PhiInst* phi = static_cast<PhiInst*>(inst);
                         
-                        Operand* trueLabel = getLabelOperand(trueId);
-                        Operand* falseLabel = getLabelOperand(falseId);
+                        Operand* trueLabel = function.getLabelOperand(trueId);
+                        Operand* falseLabel = function.getLabelOperand(falseId);
                         
                         bool refTrue = phi->incomingVals.find(trueLabel) != phi->incomingVals.end();
                         bool refFalse = phi->incomingVals.find(falseLabel) != phi->incomingVals.end();
@@ -228,13 +262,12 @@ namespace ME
                     --it; --it; // 查看倒数第二条指令
                     Instruction* prevInst = *it;
                     
-                    Operand* def = getDefOperand(prevInst);
+                    Operand* def = prevInst->getDef();
                     if (def && usedByCond.count(def))
                     {
                         // 这是一个计算条件的指令，将其加入删除队列并追踪其操作数
-                        std::vector<Operand*> uses = getUsedOperands(prevInst);
-                        for (auto* op : uses)
-                            if (op) usedByCond.insert(op);
+                        for (auto* op : prevInst->getUses())
+                            usedByCond.insert(op);
                         
                         if (prevInst->opcode == Operator::ICMP ||
                             prevInst->opcode == Operator::FCMP ||
@@ -244,7 +277,7 @@ namespace ME
                             prevInst->opcode == Operator::LOAD ||
                             prevInst->opcode == Operator::ZEXT)
                         {
-                            block->insts.erase(it);
+                            block->erase(it);
                             changed = true;
                         }
                         else
@@ -259,7 +292,8 @@ namespace ME
                 }
                 
                 // 将 BR_COND 替换为 BR_UNCOND
-                block->insts.back() = new BrUncondInst(getLabelOperand(trueFinal));
+                auto* newBr = new (function.getArena()) BrUncondInst(function.getLabelOperand(trueFinal));
+                block->replace(std::prev(block->insts.end()), newBr);
                 changed = true;
             }
         }
@@ -277,7 +311,7 @@ namespace ME
                     size_t targetId = static_cast<LabelOperand*>(targetOp)->lnum;
                     if (jumpTargets.count(targetId) && jumpTargets[targetId] != targetId)
                     {
-                        targetOp = getLabelOperand(jumpTargets[targetId]);
+                        targetOp = function.getLabelOperand(jumpTargets[targetId]);
                         changed = true;
                     }
                 }
@@ -349,7 +383,7 @@ namespace ME
         
         for (size_t id : blocksToRemove)
         {
-            function.blocks.erase(id);
+            function.removeBlock(id);
             changed = true;
         }
         
@@ -388,6 +422,7 @@ namespace ME
                 
                 for (auto* label : toRemove)
                 {
+                    function.removeUse(phi->incomingVals[label], phi);
                     phi->incomingVals.erase(label);
                 }
             }
@@ -419,18 +454,15 @@ namespace ME
     {
         std::set<Instruction*> liveInsts;
         std::vector<Instruction*> worklist;
-        std::map<Operand*, Instruction*> defMap;
         std::map<Instruction*, Block*> instToBlock;
         std::set<Operand*> localAllocaPtrs;
         
-        // 0. 预处理：构建 Def-Use 映射和 Block 映射
+        // 0. 预处理：构建 Block 映射 (定义指令直接从函数的 def-use 链查询)
         for (auto& [blockId, block] : function.blocks)
         {
             for (auto* inst : block->insts)
             {
                 instToBlock[inst] = block;
-                Operand* def = getDefOperand(inst);
-                if (def) defMap[def] = inst;
                 
                 // 记录局部变量 Alloca，用于简单的内存依赖分析
                 if (inst->opcode == Operator::ALLOCA)
@@ -466,15 +498,13 @@ namespace ME
             
             // 2.1 数据依赖传播 (Data Dependence)
             // 我活着，我用的数据定义者也得活着
-            std::vector<Operand*> uses = getUsedOperands(inst);
-            for (Operand* op : uses)
+            for (Operand* op : inst->getUses())
             {
-                if (!op) continue;
-                auto it = defMap.find(op);
-                if (it != defMap.end() && !liveInsts.count(it->second))
+                Instruction* defInst = function.getDefInst(op);
+                if (defInst && !liveInsts.count(defInst))
                 {
-                    liveInsts.insert(it->second);
-                    worklist.push_back(it->second);
+                    liveInsts.insert(defInst);
+                    worklist.push_back(defInst);
                 }
             }
             
@@ -485,29 +515,26 @@ namespace ME
                 auto* load = static_cast<LoadInst*>(inst);
                 if (load->ptr && localAllocaPtrs.count(load->ptr))
                 {
-                    // 简单的别名分析：遍历所有 STORE 寻找写入同一地址的指令
-                    // (注意：这是 O(N*M) 的简化实现，实际编译器会用 MemorySSA 或 AliasAnalysis)
-                    for (auto& [bid, blk] : function.blocks)
+                    // 简单的别名分析：沿该地址的 use 链寻找写入同一地址的 STORE
+                    // (实际编译器会用 MemorySSA 或 AliasAnalysis)
+                    for (auto* other : function.getUsers(load->ptr))
                     {
-                        for (auto* other : blk->insts)
+                        if (other->opcode == Operator::STORE)
                         {
-                            if (other->opcode == Operator::STORE)
+                            auto* store = static_cast<StoreInst*>(other);
+                            if (store->ptr == load->ptr && !liveInsts.count(other))
                             {
-                                auto* store = static_cast<StoreInst*>(other);
-                                if (store->ptr == load->ptr && !liveInsts.count(other))
-                                {
-                                    liveInsts.insert(other);
-                                    worklist.push_back(other);
-                                }
+                                liveInsts.insert(other);
+                                worklist.push_back(other);
                             }
                         }
                     }
                     // Alloca 本身也需要活着
-                    auto allocaIt = defMap.find(load->ptr);
-                    if (allocaIt != defMap.end() && !liveInsts.count(allocaIt->second))
+                    Instruction* allocaInst = function.getDefInst(load->ptr);
+                    if (allocaInst && !liveInsts.count(allocaInst))
                     {
-                        liveInsts.insert(allocaIt->second);
-                        worklist.push_back(allocaIt->second);
+                        liveInsts.insert(allocaInst);
+                        worklist.push_back(allocaInst);
                     }
                 }
             }
@@ -598,15 +625,13 @@ namespace ME
         while (head < worklist.size())
         {
             Instruction* inst = worklist[head++];
-            std::vector<Operand*> uses = getUsedOperands(inst);
-            for (Operand* op : uses)
+            for (Operand* op : inst->getUses())
             {
-                if (!op) continue;
-                auto it = defMap.find(op);
-                if (it != defMap.end() && !liveInsts.count(it->second))
+                Instruction* defInst = function.getDefInst(op);
+                if (defInst && !liveInsts.count(defInst))
                 {
-                    liveInsts.insert(it->second);
-                    worklist.push_back(it->second);
+                    liveInsts.insert(defInst);
+                    worklist.push_back(defInst);
                 }
             }
             // (省略了重复的 LOAD/STORE 处理逻辑，假设 Terminator 通常不涉及复杂内存依赖)
@@ -614,7 +639,8 @@ namespace ME
         }
 
         // 4. 执行删除操作 (Sweep)
-        size_t deleteCount = 0;
+        size_t deleteCount  = 0;
+        size_t rewriteCount = 0;  // 改写为无条件跳转的条件跳转，CFG 同样发生了变化
 
         for (auto& [blockId, block] : function.blocks)
         {
@@ -649,14 +675,15 @@ namespace ME
                         
                         if (target)
                         {
-                            *it = new BrUncondInst(target);
+                            it = block->replace(it, new (function.getArena()) BrUncondInst(target));
                             ++it;
+                            ++rewriteCount;
                             continue;
                         }
                     }
                     
                     deleteCount++;
-                    it = block->insts.erase(it);
+                    it = block->erase(it);
                 }
                 else
                 {
@@ -676,11 +703,11 @@ namespace ME
 
         for (size_t id : blocksToRemove)
         {
-            function.blocks.erase(id);
+            function.removeBlock(id);
             deleteCount++;
         }
         
-        return deleteCount > 0;
+        return deleteCount > 0 || rewriteCount > 0;
     }
 
     /**
@@ -694,7 +721,7 @@ namespace ME
      *    - 为什么？如果结果不被外部使用，那么计算过程也是多余的。
      * 
      * 算法流程：
-     * 1. DFS 寻找回边 (Back Edge) 以识别循环。
+     * 1. 按 RPO 寻找回边 (Back Edge) 以识别循环。
      *    - 为什么？回边 (u->v, v dom u) 是自然循环的结构特征。
      * 2. 收集循环体所有基本块。
      * 3. 验证上述两个判定标准。
@@ -702,55 +729,18 @@ namespace ME
      */
     bool ADCEPass::removeDeadLoops(Function& function, Analysis::CFG* cfg)
     {
-        size_t numBlocks = 0;
-        for (auto& [id, _] : function.blocks)
-            numBlocks = std::max(numBlocks, id + 1);
-        
-        if (numBlocks == 0) return false;
-        
-        size_t entryId = function.blocks.begin()->first;
-        
+        if (function.blocks.empty()) return false;
+
+        size_t entryId = cfg->getEntryId();
+
         // 1. 寻找自然循环 (Natural Loops)
-        // 使用 DFS 识别回边 (Back Edge: 指向 DFS 祖先的边)
-        std::map<size_t, int> dfsOrder;
-        std::set<size_t> visited;
-        std::vector<size_t> dfsStack;
-        
-        dfsStack.push_back(entryId);
-        int order = 0;
-        
-        while (!dfsStack.empty())
-        {
-            size_t cur = dfsStack.back();
-            dfsStack.pop_back();
-            
-            if (visited.count(cur)) continue;
-            visited.insert(cur);
-            dfsOrder[cur] = order++;
-            
-            if (cur < cfg->G_id.size())
-            {
-                for (auto it = cfg->G_id[cur].rbegin(); it != cfg->G_id[cur].rend(); ++it)
-                {
-                    if (!visited.count(*it))
-                        dfsStack.push_back(*it);
-                }
-            }
-        }
-        
+        // 回边 (Back Edge) 指向 DFS 祖先：按 CFG 缓存的逆后序，后继不晚于当前块的边即为回边
         std::vector<std::pair<size_t, size_t>> backEdges;
-        for (auto& [blockId, block] : function.blocks)
+        for (size_t blockId : cfg->rpo_id)
         {
-            if (blockId >= cfg->G_id.size()) continue;
-            
             for (size_t succId : cfg->G_id[blockId])
             {
-                if (dfsOrder.count(blockId) && dfsOrder.count(succId))
-                {
-                    // 如果后继节点的 DFS 序小于当前节点，说明是回边
-                    if (dfsOrder[succId] <= dfsOrder[blockId])
-                        backEdges.push_back({blockId, succId});
-                }
+                if (cfg->isBackEdge(blockId, succId)) backEdges.push_back({blockId, succId});
             }
         }
         
@@ -813,6 +803,7 @@ namespace ME
             // 3. 检查副作用 (Side Effects)
             bool hasSideEffect = false;
             std::set<Operand*> defsInLoop;
+            std::set<Instruction*> loopInsts;
             
             for (size_t bid : loopBlocks)
             {
@@ -832,7 +823,8 @@ namespace ME
                         break;
                     }
                     
-                    Operand* def = getDefOperand(inst);
+                    loopInsts.insert(inst);
+                    Operand* def = inst->getDef();
                     if (def) defsInLoop.insert(def);
                 }
                 
@@ -842,15 +834,29 @@ namespace ME
             if (hasSideEffect) continue;
             
             // 4. 检查活跃性 (External Uses)
-            // 检查循环内定义的变量是否被循环外的指令使用
+            // 检查循环内定义的变量是否被循环外的指令使用：沿 use 链查看是否有循环外的使用者
             bool usedOutside = false;
+            for (Operand* def : defsInLoop)
+            {
+                for (auto* user : function.getUsers(def))
+                {
+                    if (!loopInsts.count(user))
+                    {
+                        usedOutside = true;
+                        break;
+                    }
+                }
+                if (usedOutside) break;
+            }
+
+            // 检查循环外 PHI 节点是否引用了循环内的前驱块
             for (auto& [bid, block] : function.blocks)
             {
+                if (usedOutside) break;
                 if (loopBlocks.count(bid)) continue;
                 
                 for (auto* inst : block->insts)
                 {
-                    // 检查 PHI 节点引用
                     if (inst->opcode == Operator::PHI)
                     {
                         PhiInst* phi = static_cast<PhiInst*>(inst);
@@ -868,20 +874,7 @@ namespace ME
                         }
                         if (usedOutside) break;
                     }
-                    
-                    // 检查数据引用
-                    std::vector<Operand*> uses = getUsedOperands(inst);
-                    for (Operand* op : uses)
-                    {
-                        if (op && defsInLoop.count(op))
-                        {
-                            usedOutside = true;
-                            break;
-                        }
-                    }
-                    if (usedOutside) break;
                 }
-                if (usedOutside) break;
             }
             
             if (usedOutside) continue;
@@ -915,7 +908,7 @@ namespace ME
                     {
                         size_t targetId = static_cast<LabelOperand*>(br->target)->lnum;
                         if (targetId == headId)
-                            br->target = getLabelOperand(exitBlockId);
+                            br->target = function.getLabelOperand(exitBlockId);
                     }
                 }
                 else if (term->opcode == Operator::BR_COND)
@@ -926,20 +919,20 @@ namespace ME
                     {
                         size_t targetId = static_cast<LabelOperand*>(br->trueTar)->lnum;
                         if (targetId == headId)
-                            br->trueTar = getLabelOperand(exitBlockId);
+                            br->trueTar = function.getLabelOperand(exitBlockId);
                     }
                     if (br->falseTar && br->falseTar->getType() == OperandType::LABEL)
                     {
                         size_t targetId = static_cast<LabelOperand*>(br->falseTar)->lnum;
                         if (targetId == headId)
-                            br->falseTar = getLabelOperand(exitBlockId);
+                            br->falseTar = function.getLabelOperand(exitBlockId);
                     }
                 }
             }
             
             // 物理删除循环块
             for (size_t bid : loopBlocks)
-                function.blocks.erase(bid);
+                function.removeBlock(bid);
             
             return true; // 每次只删除一个循环，然后重新分析
         }
@@ -972,129 +965,4 @@ namespace ME
         }
     }
 
-    Operand* ADCEPass::getDefOperand(Instruction* inst)
-    {
-        switch (inst->opcode)
-        {
-            case Operator::ADD: case Operator::SUB: case Operator::MUL:
-            case Operator::DIV: case Operator::MOD: case Operator::FADD:
-            case Operator::FSUB: case Operator::FMUL: case Operator::FDIV:
-            case Operator::BITAND: case Operator::BITXOR: case Operator::SHL:
-            case Operator::LSHR: case Operator::ASHR:
-                return static_cast<ArithmeticInst*>(inst)->res;
-            case Operator::ICMP: return static_cast<IcmpInst*>(inst)->res;
-            case Operator::FCMP: return static_cast<FcmpInst*>(inst)->res;
-            case Operator::LOAD: return static_cast<LoadInst*>(inst)->res;
-            case Operator::GETELEMENTPTR: return static_cast<GEPInst*>(inst)->res;
-            case Operator::ZEXT: return static_cast<ZextInst*>(inst)->dest;
-            case Operator::SITOFP: return static_cast<SI2FPInst*>(inst)->dest;
-            case Operator::FPTOSI: return static_cast<FP2SIInst*>(inst)->dest;
-            case Operator::PHI: return static_cast<PhiInst*>(inst)->res;
-            case Operator::CALL: return static_cast<CallInst*>(inst)->res;
-            case Operator::ALLOCA: return static_cast<AllocaInst*>(inst)->res;
-            default: return nullptr;
-        }
-    }
-
-    std::vector<Operand*> ADCEPass::getUsedOperands(Instruction* inst)
-    {
-        std::vector<Operand*> ops;
-        switch (inst->opcode)
-        {
-            case Operator::ADD: case Operator::SUB: case Operator::MUL:
-            case Operator::DIV: case Operator::MOD: case Operator::FADD:
-            case Operator::FSUB: case Operator::FMUL: case Operator::FDIV:
-            case Operator::BITAND: case Operator::BITXOR: case Operator::SHL:
-            case Operator::LSHR: case Operator::ASHR:
-            {
-                auto* i = static_cast<ArithmeticInst*>(inst);
-                if (i->lhs) ops.push_back(i->lhs);
-                if (i->rhs) ops.push_back(i->rhs);
-                break;
-            }
-            case Operator::ICMP:
-            {
-                auto* i = static_cast<IcmpInst*>(inst);
-                if (i->lhs) ops.push_back(i->lhs);
-                if (i->rhs) ops.push_back(i->rhs);
-                break;
-            }
-            case Operator::FCMP:
-            {
-                auto* i = static_cast<FcmpInst*>(inst);
-                if (i->lhs) ops.push_back(i->lhs);
-                if (i->rhs) ops.push_back(i->rhs);
-                break;
-            }
-            case Operator::LOAD:
-            {
-                auto* i = static_cast<LoadInst*>(inst);
-                if (i->ptr) ops.push_back(i->ptr);
-                break;
-            }
-            case Operator::STORE:
-            {
-                auto* i = static_cast<StoreInst*>(inst);
-                if (i->ptr) ops.push_back(i->ptr);
-                if (i->val) ops.push_back(i->val);
-                break;
-            }
-            case Operator::BR_COND:
-            {
-                auto* i = static_cast<BrCondInst*>(inst);
-                if (i->cond) ops.push_back(i->cond);
-                break;
-            }
-            case Operator::RET:
-            {
-                auto* i = static_cast<RetInst*>(inst);
-                if (i->res) ops.push_back(i->res);
-                break;
-            }
-            case Operator::CALL:
-            {
-                auto* i = static_cast<CallInst*>(inst);
-                for (auto& arg : i->args)
-                    ops.push_back(arg.second);
-                break;
-            }
-            case Operator::GETELEMENTPTR:
-            {
-                auto* i = static_cast<GEPInst*>(inst);
-                if (i->basePtr) ops.push_back(i->basePtr);
-                for (auto* idx : i->idxs)
-                    ops.push_back(idx);
-                break;
-            }
-            case Operator::ZEXT:
-            {
-                auto* i = static_cast<ZextInst*>(inst);
-                if (i->src) ops.push_back(i->src);
-                break;
-            }
-            case Operator::SITOFP:
-            {
-                auto* i = static_cast<SI2FPInst*>(inst);
-                if (i->src) ops.push_back(i->src);
-                break;
-            }
-            case Operator::FPTOSI:
-            {
-                auto* i = static_cast<FP2SIInst*>(inst);
-                if (i->src) ops.push_back(i->src);
-                break;
-            }
-            case Operator::PHI:
-            {
-                auto* i = static_cast<PhiInst*>(inst);
-                for (auto& pair : i->incomingVals)
-                    ops.push_back(pair.second);
-                break;
-            }
-            default:
-                break;
-        }
-        return ops;
-    }
-
 }  // namespace ME
@@ -19,7 +19,7 @@ namespace ME
         ADCEPass()  = default;
         ~ADCEPass() = default;
 
-        void runOnFunction(Function& function) override;
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
         bool runADCEIteration(Function& function, Analysis::CFG* cfg);
@@ -31,8 +31,6 @@ namespace ME
         size_t getFinalTarget(size_t blockId, Function& function, std::set<size_t>& visited);
         
         bool isRealSideEffect(Instruction* inst);
-        Operand* getDefOperand(Instruction* inst);
-        std::vector<Operand*> getUsedOperands(Instruction* inst);
     };
 }  // namespace ME
 
@@ -24,6 +24,7 @@ namespace ME::Analysis
 
     void Manager::invalidate(Function& func)
     {
+        std::lock_guard<std::mutex> lock(mtx);
         auto it = analysisCache.find(&func);
         if (it == analysisCache.end()) return;
         for (auto& analysisPair : it->second)
@@ -33,4 +34,46 @@ namespace ME::Analysis
         }
         analysisCache.erase(it);
     }
+
+    void Manager::invalidate(Function& func, const PreservedAnalyses& preserved)
+    {
+        if (preserved.areAllPreserved()) return;
+
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = analysisCache.find(&func);
+        if (it == analysisCache.end()) return;
+        AnalysisMap& funcCache = it->second;
+
+        std::set<size_t> dropped;
+        for (auto& analysisPair : funcCache)
+            if (!preserved.isPreserved(analysisPair.first)) dropped.insert(analysisPair.first);
+
+        // 依赖链很短，反复扫描直到没有新的分析因依赖失效而被丢弃
+        bool changed = !dropped.empty();
+        while (changed)
+        {
+            changed = false;
+            for (auto& analysisPair : funcCache)
+            {
+                if (dropped.count(analysisPair.first)) continue;
+                auto depIt = dependencyMap.find(analysisPair.first);
+                if (depIt == dependencyMap.end()) continue;
+                for (size_t dep : depIt->second)
+                {
+                    if (!dropped.count(dep)) continue;
+                    dropped.insert(analysisPair.first);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+
+        for (size_t tid : dropped)
+        {
+            auto deleterIt = deleterMap.find(tid);
+            if (deleterIt != deleterMap.end()) deleterIt->second(funcCache.at(tid));
+            funcCache.erase(tid);
+        }
+        if (funcCache.empty()) analysisCache.erase(it);
+    }
 }  // namespace ME::Analysis
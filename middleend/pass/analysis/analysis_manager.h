@@ -2,6 +2,7 @@
 #define __INTERFACES_MIDDLEEND_ANALYSIS_MANAGER_H__
 
 #include <functional>
+#include <mutex>
 #include <set>
 #include <type_utils.h>
 #include <unordered_map>
@@ -12,11 +13,16 @@
  *
  * 用法速览:
  * - 注册/获取分析: 通过 AM.get<YourAnalysis>(function) 获得并缓存某函数上的分析结果。
- * - 缓存失效: 当函数 IR 发生改变后，调用 AM.invalidate(function) 使相关分析失效。
+ * - 缓存失效: 当函数 IR 发生改变后，调用 AM.invalidate(function, preserved) 使未被保留的分析失效，
+ *   不带 preserved 的 AM.invalidate(function) 会丢弃该函数的全部分析。
+ * - 依赖关系: 分析在自己的 get<> 特化中通过 registerDependency<Self, Dep>() 声明依赖，
+ *   被依赖的分析失效时，依赖它的分析也会一并失效（如 DomInfo 依赖 CFG）。
  * - 分析类需定义静态常量 TID = getTID<AP>()，用于唯一标识。
  *   该标识实际上是 getTID<AP>() 实例化后的函数地址。不同实例的 getTID<AP>()
  *   所在地址不同，因此我们可以将它用作每个类的唯一 ID
  * - 参考已有示例: CFG、DomInfo 的 get<> 特化与调用方式。
+ * - 线程安全: 缓存表由互斥锁保护，不同线程可以同时处理不同的函数；
+ *   分析本身在锁外构建，同一个函数同一时刻只能由一个线程处理。
  */
 
 namespace ME
@@ -27,6 +33,56 @@ namespace ME
 
     namespace Analysis
     {
+        /*
+         * Pass 运行后仍然有效的分析集合，由 Pass 的 runOnFunction 返回
+         * - all(): 未修改 IR，全部分析保留
+         * - none(): 全部分析失效
+         * - preserve<T>(): 在集合中加入分析 T
+         */
+        class PreservedAnalyses
+        {
+          private:
+            bool             allPreserved = false;
+            std::set<size_t> preserved;
+
+          public:
+            static PreservedAnalyses all()
+            {
+                PreservedAnalyses pa;
+                pa.allPreserved = true;
+                return pa;
+            }
+            static PreservedAnalyses none() { return PreservedAnalyses(); }
+
+            template <typename Target>
+            PreservedAnalyses& preserve()
+            {
+                if (!allPreserved) preserved.insert(Target::TID);
+                return *this;
+            }
+
+            // 与另一个集合取交集，用于合并同一函数上连续运行的多个 Pass 的结果
+            void intersect(const PreservedAnalyses& other)
+            {
+                if (other.allPreserved) return;
+                if (allPreserved)
+                {
+                    *this = other;
+                    return;
+                }
+                for (auto it = preserved.begin(); it != preserved.end();)
+                {
+                    if (other.preserved.count(*it))
+                        ++it;
+                    else
+                        it = preserved.erase(it);
+                }
+            }
+
+            bool isPreserved(size_t tid) const { return allPreserved || preserved.count(tid); }
+            bool areAllPreserved() const { return allPreserved; }
+        };
+
         class Manager
         {
           private:
@@ -38,6 +94,11 @@ namespace ME
             using Deleter = void (*)(void*);
             std::unordered_map<size_t, Deleter> deleterMap;
 
+            // 分析 TID -> 它直接依赖的分析 TID
+            std::unordered_map<size_t, std::vector<size_t>> dependencyMap;
+
+            std::mutex mtx;
+
             Manager() = default;
             ~Manager();
 
@@ -47,34 +108,51 @@ namespace ME
             template <typename Target>
             Target* get(Function& func);
 
+            // 只取已缓存的分析，不存在时返回 nullptr 而不构建；用于修改 IR 的 Pass 增量维护已有的分析
+            template <typename Target>
+            Target* getCached(Function& func)
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (analysisCache.count(&func))
+                {
+                    auto& funcCache = analysisCache.at(&func);
+                    if (funcCache.count(Target::TID)) return static_cast<Target*>(funcCache.at(Target::TID));
+                }
+                return nullptr;
+            }
+
+            // 丢弃 func 上缓存的全部分析
             void invalidate(Function& func);
+            // 只丢弃未被 preserved 保留的分析，以及（传递地）依赖于被丢弃分析的分析
+            void invalidate(Function& func, const PreservedAnalyses& preserved);
 
           private:
             template <typename Target>
             void registerDeleter()
             {
-                size_t tid = Target::TID;
+                size_t                      tid = Target::TID;
+                std::lock_guard<std::mutex> lock(mtx);
                 if (deleterMap.find(tid) == deleterMap.end())
                 {
                     deleterMap[tid] = [](void* p) { delete static_cast<Target*>(p); };
                 }
             }
 
-            template <typename Target>
-            void cache(Function& func, Target* analysis)
+            template <typename Target, typename Dependency>
+            void registerDependency()
             {
-                analysisCache[&func][Target::TID] = analysis;
+                std::lock_guard<std::mutex> lock(mtx);
+                auto&                       deps = dependencyMap[Target::TID];
+                for (size_t tid : deps)
+                    if (tid == Dependency::TID) return;
+                deps.push_back(Dependency::TID);
             }
 
             template <typename Target>
-            Target* getCached(Function& func)
+            void cache(Function& func, Target* analysis)
             {
-                if (analysisCache.count(&func))
-                {
-                    auto& funcCache = analysisCache.at(&func);
-                    if (funcCache.count(Target::TID)) return static_cast<Target*>(funcCache.at(Target::TID));
-                }
-                return nullptr;
+                std::lock_guard<std::mutex> lock(mtx);
+                analysisCache[&func][Target::TID] = analysis;
             }
         };
 
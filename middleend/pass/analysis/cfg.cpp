@@ -8,137 +8,133 @@
 
 namespace ME::Analysis
 {
-    CFG::CFG() { id2block.clear(); }
+    CFG::CFG() : func(nullptr) {}
 
     void CFG::build(ME::Function& function)
     {
         func = &function;
         id2block.clear();
-
-        for (auto& [blockId, block] : function.blocks) id2block[blockId] = block;
-
-        if (id2block.empty()) return;
-
-        size_t maxBlockId = 0;
-        for (auto& [blockId, block] : id2block) maxBlockId = std::max(maxBlockId, blockId);
-
         G.clear();
         invG.clear();
         G_id.clear();
         invG_id.clear();
+        postOrder_id.clear();
+        rpo_id.clear();
+        rpo.clear();
+        rpoIndex.clear();
+        reachable.clear();
 
-        G.resize(maxBlockId + 1);
-        invG.resize(maxBlockId + 1);
-        G_id.resize(maxBlockId + 1);
-        invG_id.resize(maxBlockId + 1);
+        if (function.blocks.empty()) return;
 
-        std::map<size_t, bool> visited;
-        size_t entryBlockId = function.blocks.begin()->first;  // 使用实际入口块
-        buildFromBlock(entryBlockId, visited);
-
-        auto blocks_temp = func->blocks;
-        func->blocks.clear();
+        size_t numIds = function.blocks.capacity();
+        id2block.assign(numIds, nullptr);
+        for (auto& [blockId, block] : function.blocks) id2block[blockId] = block;
 
-        for (auto& [blockId, block] : blocks_temp)
-            if (visited[blockId]) func->blocks[blockId] = block;
+        G.resize(numIds);
+        invG.resize(numIds);
+        G_id.resize(numIds);
+        invG_id.resize(numIds);
+        reachable.assign(numIds, false);
 
-        id2block.clear();
-        for (auto& [blockId, block] : func->blocks) id2block[blockId] = block;
+        size_t entryBlockId = function.blocks.begin()->first;  // 使用实际入口块
+        traverseFrom(entryBlockId);
 
-        for (size_t i = 0; i <= maxBlockId; ++i)
+        // 删除不可达块；DFS 只会沿可达块建边，因此边表中不含不可达块
+        std::vector<size_t> unreachable;
+        for (auto& [blockId, block] : func->blocks)
+            if (!reachable[blockId]) unreachable.push_back(blockId);
+        for (size_t blockId : unreachable)
         {
-            if (!visited[i]) continue;
-
-            auto& edges = G_id[i];
-            edges.erase(
-                std::remove_if(edges.begin(), edges.end(), [&](size_t target_id) { return !visited[target_id]; }),
-                edges.end());
+            func->removeBlock(blockId);
+            id2block[blockId] = nullptr;
         }
 
-        for (size_t i = 0; i <= maxBlockId; ++i)
+        rpo_id.assign(postOrder_id.rbegin(), postOrder_id.rend());
+        rpoIndex.assign(numIds, npos);
+        rpo.reserve(rpo_id.size());
+        for (size_t i = 0; i < rpo_id.size(); ++i)
         {
-            if (!visited[i]) continue;
-
-            auto& edges = invG_id[i];
-            edges.erase(
-                std::remove_if(edges.begin(), edges.end(), [&](size_t source_id) { return !visited[source_id]; }),
-                edges.end());
+            rpoIndex[rpo_id[i]] = i;
+            rpo.push_back(id2block[rpo_id[i]]);
         }
     }
 
-    void CFG::buildFromBlock(size_t blockId, std::map<size_t, bool>& visited)
+    void CFG::collectSuccessors(ME::Block* block, std::vector<size_t>& succs)
     {
-        if (visited[blockId] || id2block.find(blockId) == id2block.end()) return;
-
-        visited[blockId]        = true;
-        ME::Block* currentBlock = id2block[blockId];
+        succs.clear();
 
         Instruction* terminator = nullptr;
-        for (auto it = currentBlock->insts.begin(); it != currentBlock->insts.end(); ++it)
+        for (auto it = block->insts.begin(); it != block->insts.end(); ++it)
         {
             Instruction* inst = *it;
             if (!inst->isTerminator()) continue;
 
             terminator = inst;
-            // ??? terminator ???????????
-            currentBlock->insts.erase(++it, currentBlock->insts.end());
+            // 删除 terminator 之后的不可达指令
+            block->erase(++it, block->insts.end());
             break;
         }
 
         if (!terminator) return;
 
+        auto addTarget = [&](Operand* target) {
+            if (target->getType() != OperandType::LABEL) return;
+            size_t targetId = static_cast<LabelOperand*>(target)->lnum;
+            if (targetId < id2block.size() && id2block[targetId]) succs.push_back(targetId);
+        };
+
         if (terminator->opcode == Operator::BR_COND)
         {
             BrCondInst* brInst = static_cast<BrCondInst*>(terminator);
-
             if (brInst->trueTar->getType() == OperandType::LABEL && brInst->falseTar->getType() == OperandType::LABEL)
             {
-                LabelOperand* trueLabel  = static_cast<LabelOperand*>(brInst->trueTar);
-                LabelOperand* falseLabel = static_cast<LabelOperand*>(brInst->falseTar);
-
-                size_t trueLabelId  = trueLabel->lnum;
-                size_t falseLabelId = falseLabel->lnum;
-
-                if (id2block.find(trueLabelId) != id2block.end())
-                {
-                    G[blockId].push_back(id2block[trueLabelId]);
-                    G_id[blockId].push_back(trueLabelId);
-                    invG[trueLabelId].push_back(currentBlock);
-                    invG_id[trueLabelId].push_back(blockId);
-
-                    buildFromBlock(trueLabelId, visited);
-                }
-
-                if (id2block.find(falseLabelId) != id2block.end())
-                {
-                    G[blockId].push_back(id2block[falseLabelId]);
-                    G_id[blockId].push_back(falseLabelId);
-                    invG[falseLabelId].push_back(currentBlock);
-                    invG_id[falseLabelId].push_back(blockId);
-
-                    buildFromBlock(falseLabelId, visited);
-                }
+                addTarget(brInst->trueTar);
+                addTarget(brInst->falseTar);
             }
         }
         else if (terminator->opcode == Operator::BR_UNCOND)
-        {
-            BrUncondInst* brInst = static_cast<BrUncondInst*>(terminator);
+            addTarget(static_cast<BrUncondInst*>(terminator)->target);
+    }
 
-            if (brInst->target->getType() == OperandType::LABEL)
+    void CFG::traverseFrom(size_t entryId)
+    {
+        /*
+         * 用显式栈模拟递归 DFS：每个栈帧记录块的后继列表与下一个待访问的后继，
+         * 边在"走到"该后继时加入，与递归版本的加边顺序完全相同；块的后继全部处理完后出栈并记入后序
+         */
+        struct Frame
+        {
+            size_t              blockId;
+            std::vector<size_t> succs;
+            size_t              next;
+        };
+        std::vector<Frame> stack;
+
+        auto enter = [&](size_t blockId) {
+            reachable[blockId] = true;
+            stack.push_back(Frame{blockId, {}, 0});
+            collectSuccessors(id2block[blockId], stack.back().succs);
+        };
+        enter(entryId);
+
+        while (!stack.empty())
+        {
+            Frame& frame = stack.back();
+            if (frame.next == frame.succs.size())
             {
-                LabelOperand* targetLabel   = static_cast<LabelOperand*>(brInst->target);
-                size_t        targetLabelId = targetLabel->lnum;
-
-                if (id2block.find(targetLabelId) != id2block.end())
-                {
-                    G[blockId].push_back(id2block[targetLabelId]);
-                    G_id[blockId].push_back(targetLabelId);
-                    invG[targetLabelId].push_back(currentBlock);
-                    invG_id[targetLabelId].push_back(blockId);
-
-                    buildFromBlock(targetLabelId, visited);
-                }
+                postOrder_id.push_back(frame.blockId);
+                stack.pop_back();
+                continue;
             }
+
+            size_t from = frame.blockId;
+            size_t to   = frame.succs[frame.next++];
+            G[from].push_back(id2block[to]);
+            G_id[from].push_back(to);
+            invG[to].push_back(id2block[from]);
+            invG_id[to].push_back(from);
+
+            if (!reachable[to]) enter(to);  // enter 可能使 frame 引用失效，之后不再使用它
         }
     }
 
@@ -147,6 +143,7 @@ namespace ME::Analysis
     {
         if (auto* cached = getCached<CFG>(func)) return cached;
 
+        registerDeleter<CFG>();
         auto* cfg = new CFG();
         cfg->build(func);
         cache<CFG>(func, cfg);
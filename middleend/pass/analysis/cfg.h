@@ -10,6 +10,7 @@
  * CFG (控制流图) 分析
  * - 通过 Analysis::AM.get<CFG>(function) 构建并缓存函数的基本块图。
  * - 提供 blockId->Block 的映射，以及正向/反向图与其 id 版本，便于后续分析使用。
+ * - 同时缓存从入口出发的后序、逆后序(RPO)与可达块集合，数据流分析按 RPO 迭代可减少不动点轮数。
  * - 必要时需调用 AM.invalidate(function) 来清理修改了结构的函数的 CFG 缓存。
  */
 
@@ -26,8 +27,8 @@ namespace ME::Analysis
       public:
         static inline const size_t TID = getTID<CFG>();
 
-        ME::Function*                func;
-        std::map<size_t, ME::Block*> id2block;
+        ME::Function*           func;
+        std::vector<ME::Block*> id2block;  // 按块ID下标，不存在的块为 nullptr
 
         std::vector<std::vector<ME::Block*>> G{};
         std::vector<std::vector<ME::Block*>> invG{};
@@ -35,12 +36,30 @@ namespace ME::Analysis
         std::vector<std::vector<size_t>> G_id{};
         std::vector<std::vector<size_t>> invG_id{};
 
+        // 以入口为根的深度优先遍历结果，只包含可达块（不可达块在构建时已被删除）
+        std::vector<size_t>     postOrder_id{};
+        std::vector<size_t>     rpo_id{};
+        std::vector<ME::Block*> rpo{};
+        std::vector<size_t>     rpoIndex{};   // 块ID -> 在 rpo 中的位置，不可达块为 npos
+        std::vector<bool>       reachable{};  // 按块ID下标
+
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
       public:
         CFG();
         ~CFG() = default;
 
         void build(ME::Function& function);
-        void buildFromBlock(size_t blockId, std::map<size_t, bool>& visited);
+
+        size_t getEntryId() const { return rpo_id.empty() ? 0 : rpo_id.front(); }
+        bool   isReachable(size_t blockId) const { return blockId < reachable.size() && reachable[blockId]; }
+        // u->v 是否为回边（RPO 中指向自身或更早的块）
+        bool isBackEdge(size_t u, size_t v) const { return rpoIndex[v] <= rpoIndex[u]; }
+
+      private:
+        // 迭代式 DFS：截断终结指令之后的死代码、建立边并生成后序，避免深递归
+        void traverseFrom(size_t entryId);
+        void collectSuccessors(ME::Block* block, std::vector<size_t>& succs);
     };
 
     template <>
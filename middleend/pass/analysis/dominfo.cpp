@@ -8,9 +8,13 @@ namespace ME::Analysis
     /**
      * @brief ?????????????????? DomAnalyzer
      */
-    DomInfo::DomInfo() { domAnalyzer = new DomAnalyzer(); }
+    DomInfo::DomInfo() : domAnalyzer(new DomAnalyzer()), updater(nullptr), graph(), entryId(0) {}
 
-    DomInfo::~DomInfo() { delete domAnalyzer; }
+    DomInfo::~DomInfo()
+    {
+        delete updater;
+        delete domAnalyzer;
+    }
 
     /**
      * @brief ????????????
@@ -27,9 +31,9 @@ namespace ME::Analysis
         // 1. ??????? (Exit Points)
         // ???????????????? RET ??????????????????????
         std::vector<int> exitPoints;
-        for (auto& [blockId, block] : cfg.id2block)
+        for (size_t blockId : cfg.rpo_id)
         {
-            for (auto* inst : block->insts)
+            for (auto* inst : cfg.id2block[blockId]->insts)
             {
                 if (!inst->isTerminator()) continue;
                 if (inst->opcode != ME::Operator::RET) continue;
@@ -52,8 +56,32 @@ namespace ME::Analysis
         // 3. ?څ???????
         // ??????? ID ? 0??
         // solve ????????????????????
-        std::vector<int> entryPoints = {0};
+        std::vector<int> entryPoints = {(int)cfg.getEntryId()};
         domAnalyzer->solve(graph_int, entryPoints, false);
+
+        // ڽӱԱ
+        delete updater;
+        updater = nullptr;
+        graph   = std::move(graph_int);
+        entryId = entryPoints.front();
+    }
+
+    void DomInfo::applyUpdates(const std::vector<DomTreeUpdater::Update>& updates)
+    {
+        if (!updater)
+        {
+            updater = new DomTreeUpdater(*domAnalyzer);
+            updater->reset(std::move(graph), entryId);
+            graph.clear();
+        }
+        updater->applyUpdates(updates);
+    }
+
+    const DomFrontier& DomInfo::getDomFrontier()
+    {
+        // ֧߽º
+        if (updater) updater->flush();
+        return domAnalyzer->dom_frontier;
     }
 
     /**
@@ -68,6 +96,8 @@ namespace ME::Analysis
 
         // DomInfo ?????? CFG?????? CFG
         auto* cfg = get<CFG>(func);
+        registerDependency<DomInfo, CFG>();
+        registerDeleter<DomInfo>();
 
         auto* domInfo = new DomInfo();
         domInfo->build(*cfg);
@@ -14,14 +14,24 @@ namespace ME::Analysis
 
         DomAnalyzer* domAnalyzer;
 
+      private:
+        // 增量更新器在第一次 applyUpdates 时才创建，并接管构建时保存的 CFG 邻接表
+        DomTreeUpdater*               updater;
+        std::vector<std::vector<int>> graph;
+        int                           entryId;
+
       public:
         DomInfo();
         ~DomInfo();
 
         void build(CFG& cfg);
 
+        // 调用方已按 updates 修改了 CFG（节点为块 ID）：增量维护支配树，结果与在新 CFG 上重新 build 一致。
+        // 修改了 CFG 的 Pass 在此之后可以同时保留 CFG（就地重建）与 DomInfo
+        void applyUpdates(const std::vector<DomTreeUpdater::Update>& updates);
+
         const std::vector<std::vector<int>>& getDomTree() const { return domAnalyzer->dom_tree; }
-        const std::vector<std::set<int>>&    getDomFrontier() const { return domAnalyzer->dom_frontier; }
+        const DomFrontier&                   getDomFrontier();
         const std::vector<int>&              getImmDom() const { return domAnalyzer->imm_dom; }
     };
 
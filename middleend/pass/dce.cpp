@@ -1,6 +1,9 @@
 #include <middleend/pass/dce.h>
 #include <middleend/module/ir_instruction.h>
 #include <middleend/module/ir_operand.h>
+#include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/pass_manager.h>
 #include <algorithm>
 #include <map>
 #include <set>
@@ -8,6 +11,14 @@
 
 namespace ME
 {
+    namespace
+    {
+        struct AutoRegister
+        {
+            AutoRegister() { PassRegistry::registerPassFactory("dce", []() -> Pass* { return new DCEPass(); }); }
+        } s_auto_register;
+    }  // namespace
+
     /**
      * @brief  Pass (Dead Code Elimination)
      * 
@@ -18,16 +29,35 @@ namespace ME
      *   - Ϊʲôп޷ȷ֧Ƿ԰ȫƳ֧ܿŸִָУ
      * - ԣ޷ɾյĻ򲻿ɴ루Щͨ ADCE  SimplifyCFG 
      */
-    void DCEPass::runOnFunction(Function& function)
+    PreservedAnalyses DCEPass::runOnFunction(Function& function)
     {
-        bool changed = true;
+        function.buildDefUse();
+
+        bool   changed    = true;
+        bool   anyChanged = false;
+        size_t sweeps     = 0;
         // ѭִУΪɾһָܻᵼ¶ָҲ
         // Ϊʲô a = b + 1; c = a * 2;  c ˣa Ҳˡ
         // һ Mark-Sweep ֻ c ģɾ c һֲܷ a ġ
+        // Ԥټһ֣һ飺 Mark-Sweep ԵģΪģʽ
+        FunctionBudget* budget = FunctionBudget::current();
         while (changed)
         {
             changed = performDCE(function);
+            anyChanged |= changed;
+            ++sweeps;
+            if (changed && budget && !budget->consume(PassTimer::countInsts(function)))
+            {
+                budget->note("dce", "stopped after " + std::to_string(sweeps) + " sweep(s)");
+                break;
+            }
         }
+
+        if (!anyChanged) return PreservedAnalyses::all();
+        // ֻɾսָתϵ䣬CFG ֧ϢȻЧ
+        PreservedAnalyses pa;
+        pa.preserve<Analysis::CFG>().preserve<Analysis::DomInfo>();
+        return pa;
     }
 
     /**
@@ -65,6 +95,7 @@ namespace ME
      *    - ɨָʶиõָΪԾڵ (Roots)
      *    -  Roots  Worklist
      *    -  WorklistԾָʹõĲĶָ (Def-Use) ΪԾ
+     *      ָͨ Function ά def-use ֱӲѯ
      *      - Ϊʲôָ I ǻģôҲ뱻
      * 
      * 2. Sweep ():
@@ -77,95 +108,14 @@ namespace ME
     {
         std::set<Instruction*> liveInsts;
         std::vector<Instruction*> worklist;
-        std::map<Operand*, Instruction*> defMap;
 
-        // 1. ʼ׶Σӳ (DefMap) ʶָ (Seeds)
+        // 1. ʼ׶Σʶָ (Seeds)
+        // ӳֱȡԺά def-use ÿɨ蹹
         for (auto& [blockId, block] : function.blocks)
         {
             for (auto* inst : block->insts)
             {
-                // 1.1 ¼ָĸ (ڷ)
-                Operand* res = nullptr;
-                switch (inst->opcode)
-                {
-                    case Operator::ADD:
-                    case Operator::SUB:
-                    case Operator::MUL:
-                    case Operator::DIV:
-                    case Operator::MOD:
-                    case Operator::FADD:
-                    case Operator::FSUB:
-                    case Operator::FMUL:
-                    case Operator::FDIV:
-                    case Operator::BITAND:
-                    case Operator::BITXOR:
-                    case Operator::SHL:
-                    case Operator::LSHR:
-                    case Operator::ASHR: {
-                        auto* i = static_cast<ArithmeticInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    case Operator::ICMP: {
-                        auto* i = static_cast<IcmpInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    case Operator::FCMP: {
-                        auto* i = static_cast<FcmpInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    case Operator::LOAD: {
-                        auto* i = static_cast<LoadInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    case Operator::GETELEMENTPTR: {
-                        auto* i = static_cast<GEPInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    case Operator::ZEXT: {
-                        auto* i = static_cast<ZextInst*>(inst);
-                        res = i->dest;
-                        break;
-                    }
-                    case Operator::SITOFP: {
-                        auto* i = static_cast<SI2FPInst*>(inst);
-                        res = i->dest;
-                        break;
-                    }
-                    case Operator::FPTOSI: {
-                        auto* i = static_cast<FP2SIInst*>(inst);
-                        res = i->dest;
-                        break;
-                    }
-                    case Operator::PHI: {
-                        auto* i = static_cast<PhiInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    case Operator::CALL: {
-                        auto* i = static_cast<CallInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    case Operator::ALLOCA: {
-                        auto* i = static_cast<AllocaInst*>(inst);
-                        res = i->res;
-                        break;
-                    }
-                    default:
-                        break;
-                }
-
-                if (res)
-                {
-                    defMap[res] = inst;
-                }
-
-                // 1.2 ָиãǻԾĸԴ
+                // ָиãǻԾĸԴ
                 if (!isSideEffectFree(inst))
                 {
                     liveInsts.insert(inst);
@@ -180,117 +130,15 @@ namespace ME
         while (head < worklist.size())
         {
             Instruction* inst = worklist[head++];
-            
-            //  Lambda: ĶָΪԾ
-            auto addOperand = [&](Operand* op) {
-                if (op && defMap.count(op))
-                {
-                    Instruction* defInst = defMap[op];
-                    if (liveInsts.find(defInst) == liveInsts.end())
-                    {
-                        liveInsts.insert(defInst);
-                        worklist.push_back(defInst);
-                    }
-                }
-            };
 
-            // ָͣҳʹõв
-            switch (inst->opcode)
+            for (Operand* op : inst->getUses())
             {
-                case Operator::ADD:
-                case Operator::SUB:
-                case Operator::MUL:
-                case Operator::DIV:
-                case Operator::MOD:
-                case Operator::FADD:
-                case Operator::FSUB:
-                case Operator::FMUL:
-                case Operator::FDIV:
-                case Operator::BITAND:
-                case Operator::BITXOR:
-                case Operator::SHL:
-                case Operator::LSHR:
-                case Operator::ASHR: {
-                    auto* i = static_cast<ArithmeticInst*>(inst);
-                    addOperand(i->lhs);
-                    addOperand(i->rhs);
-                    break;
-                }
-                case Operator::ICMP: {
-                    auto* i = static_cast<IcmpInst*>(inst);
-                    addOperand(i->lhs);
-                    addOperand(i->rhs);
-                    break;
-                }
-                case Operator::FCMP: {
-                    auto* i = static_cast<FcmpInst*>(inst);
-                    addOperand(i->lhs);
-                    addOperand(i->rhs);
-                    break;
-                }
-                case Operator::LOAD: {
-                    auto* i = static_cast<LoadInst*>(inst);
-                    addOperand(i->ptr);
-                    break;
-                }
-                case Operator::STORE: {
-                    auto* i = static_cast<StoreInst*>(inst);
-                    addOperand(i->ptr);
-                    addOperand(i->val);
-                    break;
-                }
-                case Operator::BR_COND: {
-                    auto* i = static_cast<BrCondInst*>(inst);
-                    addOperand(i->cond);
-                    break;
-                }
-                case Operator::RET: {
-                    auto* i = static_cast<RetInst*>(inst);
-                    addOperand(i->res);
-                    break;
-                }
-                case Operator::CALL: {
-                    auto* i = static_cast<CallInst*>(inst);
-                    for (auto& arg : i->args)
-                    {
-                        addOperand(arg.second);
-                    }
-                    break;
-                }
-                case Operator::GETELEMENTPTR: {
-                    auto* i = static_cast<GEPInst*>(inst);
-                    addOperand(i->basePtr);
-                    for (auto* idx : i->idxs)
-                    {
-                        addOperand(idx);
-                    }
-                    break;
-                }
-                case Operator::ZEXT: {
-                    auto* i = static_cast<ZextInst*>(inst);
-                    addOperand(i->src);
-                    break;
-                }
-                case Operator::SITOFP: {
-                    auto* i = static_cast<SI2FPInst*>(inst);
-                    addOperand(i->src);
-                    break;
-                }
-                case Operator::FPTOSI: {
-                    auto* i = static_cast<FP2SIInst*>(inst);
-                    addOperand(i->src);
-                    break;
-                }
-                case Operator::PHI: {
-                    auto* i = static_cast<PhiInst*>(inst);
-                    for (auto& pair : i->incomingVals)
-                    {
-                        addOperand(pair.second);
-                    }
-                    break;
+                Instruction* defInst = function.getDefInst(op);
+                if (defInst && liveInsts.find(defInst) == liveInsts.end())
+                {
+                    liveInsts.insert(defInst);
+                    worklist.push_back(defInst);
                 }
-                default:
-                    break;
             }
         }
 
@@ -304,7 +152,7 @@ namespace ME
             {
                 if (liveInsts.find(*it) == liveInsts.end())
                 {
-                    it = block->insts.erase(it);
+                    it = block->erase(it);
                     changed = true;
                 }
                 else
@@ -17,7 +17,7 @@ namespace ME
         DCEPass()  = default;
         ~DCEPass() = default;
 
-        void runOnFunction(Function& function) override;
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
         bool performDCE(Function& function);
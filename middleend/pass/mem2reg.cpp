@@ -1,11 +1,24 @@
 #include <middleend/pass/mem2reg.h>
+#include <middleend/pass/pass_manager.h>
 #include <middleend/pass/analysis/analysis_manager.h>
 #include <middleend/module/ir_operand.h>
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <unordered_set>
 
 namespace ME
 {
+    namespace
+    {
+        struct AutoRegister
+        {
+            AutoRegister() { PassRegistry::registerPassFactory("mem2reg", []() -> Pass* { return new Mem2RegPass(); }); }
+        } s_auto_register;
+    }  // namespace
+
     /**
      * @brief 运行 Mem2Reg 优化 Pass (Memory to Register Promotion)
      * 
@@ -18,16 +31,27 @@ namespace ME
      * - SSA 形式（虚拟寄存器）让数据依赖关系显式化，极大地简化了常量传播、死代码消除等优化。
      * 
      * 算法基于 "Efficiently Computing Static Single Assignment Form and the Control Dependence Graph"
-     * (Cytron et al. 1991) 的简化版本。
+     * (Cytron et al. 1991) 的简化版本，PHI 只放在变量活跃的块中 (Pruned SSA)。
      */
-    void Mem2RegPass::runOnFunction(Function& function)
+    PreservedAnalyses Mem2RegPass::runOnFunction(Function& function)
     {
+        // 需要支配树与支配边界，预算已经用完时整个跳过，留给后端按栈变量处理
+        FunctionBudget* budget = FunctionBudget::current();
+        if (budget && budget->exhausted())
+        {
+            budget->note("mem2reg", "skipped");
+            return PreservedAnalyses::all();
+        }
+
         // 1. 获取分析结果
         // Analysis::AM (Analysis Manager) 是全局分析管理器。
         // get<Analysis::CFG>: 获取或计算控制流图信息 (前驱/后继关系)。
         auto* cfg     = Analysis::AM.get<Analysis::CFG>(function);
         // get<Analysis::DomInfo>: 获取或计算支配树信息 (支配树、支配边界)。
         auto* domInfo = Analysis::AM.get<Analysis::DomInfo>(function);
+        // 构建 def-use 链：重命名时 Load 的结果通过 replaceAllUsesWith 直接替换到所有使用者
+        function.buildDefUse();
+        if (budget) budget->consume(PassTimer::countInsts(function));
 
         // 清理之前的状态
         promotiveAllocas.clear();
@@ -37,30 +61,19 @@ namespace ME
         // 并非所有栈变量都能提升，只有那些未发生“地址逃逸”且类型简单的变量才行。
         collectPromotiveAllocas(function);
 
-        if (promotiveAllocas.empty()) return;
+        if (promotiveAllocas.empty()) return PreservedAnalyses::all();
 
         // 3. 插入 PHI 节点 (Phi Placement)
         // 利用支配边界 (Dominance Frontier) 信息，确定在哪些汇合点需要插入 PHI 节点。
-        phiToAllocaIndex.clear();
-        insertPhiNodes(function, domInfo);
+        insertPhiNodes(function, domInfo, cfg);
 
         // 4. 变量重命名 (Variable Renaming)
         // 遍历支配树，将 Load/Store 转换为寄存器操作，并填充 PHI 节点的参数。
-        renamingStacks.clear();
-        renamingStacks.resize(promotiveAllocas.size());
-        replacements.clear();
-        std::map<size_t, bool> visited;
-        
-        // 从入口块开始递归重命名
-        if (!function.blocks.empty())
-        {
-            size_t entryBlockId = function.blocks.begin()->first;
-            renameRecursive(entryBlockId, domInfo, cfg, visited);
-        }
+        renameVariables(function, domInfo, cfg);
 
         // 5. 移除已提升的 Alloca 及其相关的 Load/Store 指令
         // 这些指令已经被寄存器操作替代，不再需要。
-        std::set<Instruction*> instsToDelete;
+        std::unordered_set<Instruction*> instsToDelete;
         for (const auto& info : promotiveAllocas)
         {
             instsToDelete.insert(info.allocaInst);
@@ -75,8 +88,8 @@ namespace ME
             {
                 if (instsToDelete.count(*it))
                 {
-                    // 注意：这里仅从链表中移除，实际内存释放依赖于 Module/Function 的析构或 GC
-                    it = block->insts.erase(it);
+                    // erase 会销毁指令，其内存回到函数内存池的空闲链表供后续复用
+                    it = block->erase(it);
                 }
                 else
                 {
@@ -84,6 +97,11 @@ namespace ME
                 }
             }
         }
+
+        // 只插入 PHI、删除 Alloca/Load/Store，不改变基本块与跳转，CFG 与支配信息仍然有效
+        PreservedAnalyses pa;
+        pa.preserve<Analysis::CFG>().preserve<Analysis::DomInfo>();
+        return pa;
     }
 
     /**
@@ -127,8 +145,11 @@ namespace ME
         }
         
         // 第二阶段：验证用法 (Escape Analysis)
-        std::set<size_t> nonPromotable;
-        
+        // 同时按块记录每个变量的定义块，以及块内第一次访问为 Load（变量在块入口活跃）的块
+        std::set<size_t>    nonPromotable;
+        std::vector<size_t> lastAccessBlock(promotiveAllocas.size(), SIZE_MAX);
+        std::vector<size_t> lastDefBlock(promotiveAllocas.size(), SIZE_MAX);
+
         for (auto& [blockId, block] : function.blocks)
         {
             for (auto* inst : block->insts)
@@ -139,7 +160,10 @@ namespace ME
                     auto it = allocaToIndex.find(loadInst->ptr);
                     if (it != allocaToIndex.end())
                     {
-                        promotiveAllocas[it->second].usingInsts.push_back(loadInst);
+                        AllocaInfo& info = promotiveAllocas[it->second];
+                        info.usingInsts.push_back(loadInst);
+                        if (lastAccessBlock[it->second] != blockId) info.liveUseBlocks.push_back(blockId);
+                        lastAccessBlock[it->second] = blockId;
                     }
                 }
                 else if (inst->opcode == Operator::STORE)
@@ -149,8 +173,11 @@ namespace ME
                     if (it != allocaToIndex.end())
                     {
                         // 记录定义块 (Def Block)，用于后续计算 PHI 插入位置
-                        promotiveAllocas[it->second].defBlocks.insert(blockId);
-                        promotiveAllocas[it->second].usingInsts.push_back(storeInst);
+                        AllocaInfo& info = promotiveAllocas[it->second];
+                        if (lastDefBlock[it->second] != blockId) info.defBlocks.push_back(blockId);
+                        info.usingInsts.push_back(storeInst);
+                        lastAccessBlock[it->second] = blockId;
+                        lastDefBlock[it->second]    = blockId;
                     }
                     
                     // 检查 Store 的值操作数：如果 Alloca 的地址被作为值存储 (store %ptr, %other)，则发生逃逸
@@ -190,242 +217,216 @@ namespace ME
         }
     }
 
+    /**
+     * @brief 计算变量在入口处活跃的基本块 (Live-In Blocks)
+     *
+     * 从块内第一次访问为 Load 的块出发，沿前驱反向传播；遇到定义块（其中的 Store 先于任何 Load）即停止。
+     * 结果以 liveInStamp[blockId] == index + 1 标记，各变量复用同一组数组，不需要逐个清空。
+     */
+    void Mem2RegPass::computeLiveInBlocks(const AllocaInfo& info, Analysis::CFG* cfg, std::vector<size_t>& liveInStamp,
+        std::vector<size_t>& defStamp, std::vector<size_t>& workList)
+    {
+        const size_t stamp = info.index + 1;
+        for (size_t blockId : info.defBlocks) defStamp[blockId] = stamp;
+
+        workList.assign(info.liveUseBlocks.begin(), info.liveUseBlocks.end());
+        while (!workList.empty())
+        {
+            size_t blockId = workList.back();
+            workList.pop_back();
+            if (liveInStamp[blockId] == stamp) continue;
+            liveInStamp[blockId] = stamp;
+
+            for (size_t predId : cfg->invG_id[blockId])
+            {
+                // 定义块的入口处不活跃，除非块内先有 Load（此时已在初始工作表中）
+                if (defStamp[predId] == stamp || liveInStamp[predId] == stamp) continue;
+                workList.push_back(predId);
+            }
+        }
+    }
+
     /**
      * @brief 插入 PHI 节点
      * 
      * 使用迭代支配边界 (Iterated Dominator Frontier) 算法。
      * 原理：如果变量 v 在块 B 中被定义，那么在 B 的支配边界 DF(B) 中的每个块都需要插入一个 PHI 节点。
      * 插入 PHI 节点相当于在这些块中引入了新的定义，因此需要迭代地处理这些新定义块的支配边界。
+     *
+     * 剪枝 (Pruned SSA)：只在变量入口活跃的块中放置 PHI。不活跃的块里 PHI 的结果不会被任何 Load 使用，
+     * 也不会成为新的定义点，因此不再沿它的支配边界继续迭代。
      */
-    void Mem2RegPass::insertPhiNodes(Function& function, Analysis::DomInfo* domInfo)
+    void Mem2RegPass::insertPhiNodes(Function& function, Analysis::DomInfo* domInfo, Analysis::CFG* cfg)
     {
-        // getDomFrontier(): 获取支配边界映射 (BlockID -> Set<BlockID>)
-        const auto& domFrontier = domInfo->getDomFrontier();
+        // getDomFrontier(): 获取支配边界 (BlockID -> 升序的 BlockID 列表)
+        const auto&  domFrontier = domInfo->getDomFrontier();
+        const size_t blockSlots  = cfg->id2block.size();
+
+        blockPhis.assign(blockSlots, {});
+
+        // 以下数组按块 ID 下标，记录的是 Alloca 索引 + 1，各变量之间复用
+        std::vector<size_t> liveInStamp(blockSlots, 0), defStamp(blockSlots, 0), phiStamp(blockSlots, 0);
+        std::vector<size_t> workList, phiBlocks;
 
         for (auto& info : promotiveAllocas)
         {
-            std::set<size_t> workList = info.defBlocks; // 初始为包含 Store 的块
-            std::set<size_t> hasPhi;                    // 防止重复插入
+            // 没有 Load 的变量不需要任何 PHI；没有 Store 的变量所有 Load 都读到未定义值
+            if (info.liveUseBlocks.empty() || info.defBlocks.empty()) continue;
+
+            const size_t stamp = info.index + 1;
+            computeLiveInBlocks(info, cfg, liveInStamp, defStamp, workList);
 
+            phiBlocks.clear();
+            workList.assign(info.defBlocks.begin(), info.defBlocks.end());  // 初始为包含 Store 的块
             while (!workList.empty())
             {
-                size_t blockId = *workList.begin();
-                workList.erase(workList.begin());
+                size_t blockId = workList.back();
+                workList.pop_back();
 
                 if (blockId >= domFrontier.size()) continue;
 
                 // 遍历当前定义块的支配边界
                 for (int frontierBlockId : domFrontier[blockId])
                 {
-                    if (hasPhi.find(frontierBlockId) == hasPhi.end())
-                    {
-                        if (function.blocks.find(frontierBlockId) == function.blocks.end()) continue;
-
-                        Block*   block   = function.blocks[frontierBlockId];
-                        
-                        // 创建新的 PHI 节点
-                        // function.getNewRegId(): 分配一个新的虚拟寄存器 ID
-                        Operand* phiRes  = getRegOperand(function.getNewRegId());
-                        PhiInst* phiInst = new PhiInst(info.allocaInst->dt, phiRes);
-
-                        // block->insertFront(): 必须插在基本块的最前面 (PHI 节点特性)
-                        block->insertFront(phiInst);
-                        
-                        phiToAllocaIndex[phiInst] = info.index;
-
-                        hasPhi.insert(frontierBlockId);
-                        // PHI 节点也是一种定义，因此将其所在块加入工作表
-                        workList.insert(frontierBlockId);
-                    }
+                    size_t id = static_cast<size_t>(frontierBlockId);
+                    if (id >= blockSlots || phiStamp[id] == stamp) continue;  // 防止重复插入
+                    phiStamp[id] = stamp;
+                    if (liveInStamp[id] != stamp || !cfg->id2block[id]) continue;
+
+                    phiBlocks.push_back(id);
+                    // PHI 节点也是一种定义，因此将其所在块加入工作表
+                    if (defStamp[id] != stamp) workList.push_back(id);
                 }
             }
+
+            // 按块 ID 顺序创建，使寄存器编号不依赖于工作表的处理顺序
+            std::sort(phiBlocks.begin(), phiBlocks.end());
+            for (size_t blockId : phiBlocks)
+            {
+                // 创建新的 PHI 节点
+                // function.getNewRegId(): 分配一个新的虚拟寄存器 ID
+                Operand* phiRes  = function.getRegOperand(function.getNewRegId());
+                PhiInst* phiInst = new (function.getArena()) PhiInst(info.allocaInst->dt, phiRes);
+
+                // block->insertFront(): 必须插在基本块的最前面 (PHI 节点特性)
+                cfg->id2block[blockId]->insertFront(phiInst);
+                blockPhis[blockId].emplace_back(phiInst, info.index);
+            }
         }
     }
 
     /**
-     * @brief 替换指令中的操作数
+     * @brief 变量重命名 (SSA Construction - Renaming Phase)
+     * 
+     * 基于支配树 (Dominator Tree) 的先序遍历 (Pre-order Traversal)，用显式栈代替递归，
+     * 长链状的支配树也不会耗尽调用栈。
      * 
-     * 将指令中引用的旧操作数 (Old Use) 替换为当前最新的 SSA 版本 (New Use)。
-     * `replacements` 映射表由 `renameRecursive` 维护。
+     * 版本栈的实现：
+     * - 支配树性质保证了当我们访问节点 N 时，支配 N 的所有节点（即 N 的祖先）都已访问过，
+     *   因此只需为每个变量保存当前路径上的最新定义 (currentDefs)。
+     * - 每次覆盖 currentDefs 时把旧值记入 renameLog；离开一个块时把日志回退到进入该块时的位置，
+     *   恢复到父节点的状态，这样处理兄弟节点时就不会受影响。
+     * - 回退的代价与该块中的定义数成正比，而不是与变量总数成正比。
      */
-    void Mem2RegPass::replaceOperands(Instruction* inst)
+    void Mem2RegPass::renameVariables(Function& function, Analysis::DomInfo* domInfo, Analysis::CFG* cfg)
     {
-        auto replaceOp = [&](Operand*& op) {
-            if (op && replacements.count(op))
-            {
-                op = replacements[op];
-            }
+        if (function.blocks.empty()) return;
+
+        currentDefs.assign(promotiveAllocas.size(), nullptr);
+        renameLog.clear();
+
+        struct Frame
+        {
+            size_t blockId;
+            size_t nextChild;  // 下一个待访问的支配树子节点
+            size_t logMark;    // 进入该块时 renameLog 的长度
         };
 
-        switch (inst->opcode)
+        const auto&        domTree = domInfo->getDomTree();
+        std::vector<char>  visited(cfg->id2block.size(), 0);
+        std::vector<Frame> stack;
+        size_t             entryBlockId = function.blocks.begin()->first;
+
+        auto enter = [&](size_t blockId) {
+            visited[blockId] = 1;
+            stack.push_back({blockId, 0, renameLog.size()});
+            renameBlock(function, blockId, cfg);
+        };
+
+        // 从入口块开始重命名
+        enter(entryBlockId);
+        while (!stack.empty())
         {
-            // 算术运算
-            case Operator::ADD: case Operator::SUB: case Operator::MUL:
-            case Operator::DIV: case Operator::MOD: case Operator::FADD:
-            case Operator::FSUB: case Operator::FMUL: case Operator::FDIV:
-            case Operator::BITAND: case Operator::BITXOR: case Operator::SHL:
-            case Operator::LSHR: case Operator::ASHR: {
-                auto* i = static_cast<ArithmeticInst*>(inst);
-                replaceOp(i->lhs);
-                replaceOp(i->rhs);
-                break;
-            }
-            // 比较运算
-            case Operator::ICMP: {
-                auto* i = static_cast<IcmpInst*>(inst);
-                replaceOp(i->lhs);
-                replaceOp(i->rhs);
-                break;
-            }
-            case Operator::FCMP: {
-                auto* i = static_cast<FcmpInst*>(inst);
-                replaceOp(i->lhs);
-                replaceOp(i->rhs);
-                break;
-            }
-            // 内存操作
-            case Operator::LOAD: {
-                auto* i = static_cast<LoadInst*>(inst);
-                replaceOp(i->ptr);
-                break;
-            }
-            case Operator::STORE: {
-                auto* i = static_cast<StoreInst*>(inst);
-                replaceOp(i->val); // Store 的值可能已经被替换
-                replaceOp(i->ptr);
-                break;
-            }
-            // 控制流
-            case Operator::BR_COND: {
-                auto* i = static_cast<BrCondInst*>(inst);
-                replaceOp(i->cond);
-                break;
-            }
-            case Operator::PHI: {
-                // PHI 节点的 incoming values 也需要替换
-                auto* i = static_cast<PhiInst*>(inst);
-                for (auto& pair : i->incomingVals)
-                {
-                    replaceOp(pair.second);
-                }
-                break;
-            }
-            case Operator::RET: {
-                auto* i = static_cast<RetInst*>(inst);
-                replaceOp(i->res);
-                break;
-            }
-            case Operator::CALL: {
-                auto* i = static_cast<CallInst*>(inst);
-                for (auto& arg : i->args)
-                {
-                    replaceOp(arg.second);
-                }
-                break;
-            }
-            case Operator::GETELEMENTPTR: {
-                auto* i = static_cast<GEPInst*>(inst);
-                replaceOp(i->basePtr);
-                for (auto& idx : i->idxs)
-                {
-                    replaceOp(idx);
-                }
-                break;
-            }
-            case Operator::ZEXT: {
-                auto* i = static_cast<ZextInst*>(inst);
-                replaceOp(i->src);
-                break;
-            }
-            case Operator::SITOFP: {
-                auto* i = static_cast<SI2FPInst*>(inst);
-                replaceOp(i->src);
-                break;
+            Frame& frame = stack.back();
+            if (frame.blockId < domTree.size() && frame.nextChild < domTree[frame.blockId].size())
+            {
+                // 访问支配树中的下一个子节点
+                size_t childId = static_cast<size_t>(domTree[frame.blockId][frame.nextChild++]);
+                if (!visited[childId]) enter(childId);
+                continue;
             }
-            case Operator::FPTOSI: {
-                auto* i = static_cast<FP2SIInst*>(inst);
-                replaceOp(i->src);
-                break;
+
+            // 恢复版本状态 (Backtracking)
+            // 离开当前块时，必须撤销当前块对版本的所有修改，以保证兄弟节点访问时的上下文正确
+            while (renameLog.size() > frame.logMark)
+            {
+                currentDefs[renameLog.back().first] = renameLog.back().second;
+                renameLog.pop_back();
             }
-            default:
-                break;
+            stack.pop_back();
         }
     }
 
     /**
-     * @brief 递归重命名变量 (SSA Construction - Renaming Phase)
-     * 
-     * 基于支配树 (Dominator Tree) 的先序遍历 (Pre-order Traversal)。
-     * 核心思想是维护每个变量的“版本栈” (Version Stack)。
-     * 
-     * 为什么使用版本栈？
-     * - 支配树性质保证了当我们访问节点 N 时，支配 N 的所有节点（即 N 的祖先）都已访问过。
-     * - 栈顶始终保存着当前执行路径上该变量的最新定义（Closest Definition）。
-     * - 当从子节点回溯时，弹出栈顶，恢复到父节点的状态，这样处理兄弟节点时就不会受影响。
+     * @brief 重命名单个基本块
      * 
-     * 流程：
      * 1. **处理当前块指令**：
-     *    - Load: 替换为栈顶的最新版本。
-     *    - Store: 产生新版本，压入栈。
-     *    - PHI (当前块): 产生新版本，压入栈。
+     *    - PHI (当前块插入的): 产生新版本。
+     *    - Load: 通过 def-use 链把 Load 结果的所有使用替换为最新版本。
+     *    - Store: 产生新版本。
      * 
      * 2. **填充后继块 PHI 节点**：
-     *    - 遍历 CFG 后继块，若有 PHI 节点，将当前栈顶值填入对应的 Incoming Value。
-     * 
-     * 3. **递归子节点**：
-     *    - 访问支配树中的子节点。
-     * 
-     * 4. **回溯 (Backtracking)**：
-     *    - 离开当前块时，弹出所有在当前块压入的版本，恢复栈状态。
+     *    - 遍历 CFG 后继块中插入的 PHI 节点，将当前最新版本填入对应的 Incoming Value。
      */
-    void Mem2RegPass::renameRecursive(size_t blockId, Analysis::DomInfo* domInfo, Analysis::CFG* cfg,
-                                  std::map<size_t, bool>& visited)
+    void Mem2RegPass::renameBlock(Function& function, size_t blockId, Analysis::CFG* cfg)
     {
-        visited[blockId] = true;
         Block* block = cfg->id2block[blockId];
 
-        // 记录进入当前块时的栈快照 (实际上只需记录大小)
-        std::vector<int> stackSizes;
-        for (const auto& stack : renamingStacks) stackSizes.push_back(stack.size());
+        auto define = [&](size_t idx, Operand* value) {
+            renameLog.emplace_back(idx, currentDefs[idx]);
+            currentDefs[idx] = value;
+        };
 
         // 1. 处理当前块的所有指令
+        // 插入的 PHI 都在块首，先于块内任何 Load/Store
+        for (auto& [phiInst, idx] : blockPhis[blockId]) define(idx, phiInst->res);
+
         for (auto* inst : block->insts)
         {
-            // 先尝试替换指令中使用的操作数 (Use)
-            replaceOperands(inst);
-
             // 处理指令产生的定义 (Def)
-            if (inst->opcode == Operator::PHI)
-            {
-                // 如果是之前插入的 PHI 节点，它定义了一个新版本
-                if (phiToAllocaIndex.count(inst))
-                {
-                    size_t idx = phiToAllocaIndex[inst];
-                    PhiInst* phiInst = static_cast<PhiInst*>(inst);
-                    renamingStacks[idx].push(phiInst->res);
-                }
-            }
-            else if (inst->opcode == Operator::LOAD)
+            // 指令中使用的旧 Load 结果已在处理对应 Load 时被 replaceAllUsesWith 替换
+            if (inst->opcode == Operator::LOAD)
             {
                 LoadInst* loadInst = static_cast<LoadInst*>(inst);
                 auto it = allocaPtrToIndex.find(loadInst->ptr);
                 if (it != allocaPtrToIndex.end())
                 {
                     size_t idx = it->second;
-                    // 如果栈非空，使用栈顶值替换 Load 的结果
-                    if (!renamingStacks[idx].empty())
+                    // 如果已有定义，使用最新版本替换 Load 的结果
+                    // Load 支配它的所有使用者，因此一次性替换全部使用与按支配树顺序逐条替换等价
+                    if (currentDefs[idx] != nullptr)
                     {
-                        replacements[loadInst->res] = renamingStacks[idx].top();
+                        function.replaceAllUsesWith(loadInst->res, currentDefs[idx]);
                     }
                     else
                     {
-                        // 栈为空意味着使用了未初始化的变量 (Undefined Behavior)
+                        // 没有定义意味着使用了未初始化的变量 (Undefined Behavior)
                         // 编译器通常会赋予默认值 (0)
                         DataType dt = promotiveAllocas[idx].allocaInst->dt;
                         if (dt == DataType::I32 || dt == DataType::I1)
-                            replacements[loadInst->res] = getImmeI32Operand(0);
+                            function.replaceAllUsesWith(loadInst->res, function.getImmeI32Operand(0));
                         else if (dt == DataType::F32)
-                            replacements[loadInst->res] = getImmeF32Operand(0.0f);
+                            function.replaceAllUsesWith(loadInst->res, function.getImmeF32Operand(0.0f));
                     }
                 }
             }
@@ -435,61 +436,27 @@ namespace ME
                 auto it = allocaPtrToIndex.find(storeInst->ptr);
                 if (it != allocaPtrToIndex.end())
                 {
-                    // Store 定义了一个新版本，压入栈
-                    renamingStacks[it->second].push(storeInst->val);
+                    // Store 定义了一个新版本
+                    define(it->second, storeInst->val);
                 }
             }
         }
         
         // 2. 更新后继块中的 PHI 节点
-        // 对于当前块的每个后继块，将当前活跃的定义 (栈顶值) 传递给后继块的 PHI
+        // 对于当前块的每个后继块，将当前活跃的定义 (最新版本) 传递给后继块的 PHI
         // getLabelOperand: 获取表示基本块的 Label 操作数
-        Operand* currentLabel = getLabelOperand(blockId);
-        const auto& successors = cfg->G_id[blockId];
-        
-        for (size_t succId : successors)
-        {
-            if (cfg->id2block.find(succId) == cfg->id2block.end()) continue;
-            Block* succBlock = cfg->id2block[succId];
-
-            for (auto* inst : succBlock->insts)
-            {
-                if (inst->opcode != Operator::PHI) break; // PHI 节点必须在块首
-
-                if (phiToAllocaIndex.count(inst))
-                {
-                    size_t idx = phiToAllocaIndex[inst];
-                    if (!renamingStacks[idx].empty())
-                    {
-                        PhiInst* phiInst = static_cast<PhiInst*>(inst);
-                        // addIncoming: 为 PHI 节点添加一个 (Value, Label) 对
-                        phiInst->addIncoming(renamingStacks[idx].top(), currentLabel);
-                    }
-                }
-            }
-        }
-
-        // 3. 递归访问支配树中的子节点
-        // domInfo->getDomTree(): 获取支配树邻接表
-        const auto& domTree = domInfo->getDomTree();
-        if (blockId < domTree.size())
+        Operand* currentLabel = function.getLabelOperand(blockId);
+        for (size_t succId : cfg->G_id[blockId])
         {
-            for (int childId : domTree[blockId])
+            for (auto& [phiInst, idx] : blockPhis[succId])
             {
-                if (!visited[childId])
-                {
-                    renameRecursive(childId, domInfo, cfg, visited);
-                }
-            }
-        }
+                Operand* value = currentDefs[idx];
+                if (value == nullptr) continue;
 
-        // 4. 恢复栈状态 (Backtracking)
-        // 离开当前块时，必须撤销当前块对版本栈的所有修改，以保证兄弟节点访问时的上下文正确
-        for (size_t i = 0; i < renamingStacks.size(); ++i)
-        {
-            while (renamingStacks[i].size() > (size_t)stackSizes[i])
-            {
-                renamingStacks[i].pop();
+                bool isNew = !phiInst->incomingVals.count(currentLabel);
+                // addIncoming: 为 PHI 节点添加一个 (Value, Label) 对
+                phiInst->addIncoming(value, currentLabel);
+                if (isNew) function.addUse(value, phiInst);
             }
         }
     }
@@ -8,9 +8,8 @@
 #include <middleend/module/ir_instruction.h>
 #include <middleend/pass/analysis/cfg.h>
 #include <middleend/pass/analysis/dominfo.h>
-#include <stack>
-#include <map>
-#include <set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace ME
@@ -21,30 +20,36 @@ namespace ME
         Mem2RegPass()  = default;
         ~Mem2RegPass() = default;
 
-        void runOnFunction(Function& function) override;
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
         // 洢 Alloca ָϢ
         struct AllocaInfo
         {
             AllocaInst*               allocaInst;
-            std::set<size_t>          defBlocks;   // ñĻ ID  (Stores)
-            std::vector<Instruction*> usingInsts;  // ʹøñָ (Load/Store)
-            size_t                    index;       //  promotiveAllocas е
+            std::vector<size_t>       defBlocks;      // ñĻ ID (Stores)ظ
+            std::vector<size_t>       liveUseBlocks;  // ڵһηΪ Load Ļ IDڿڻԾ
+            std::vector<Instruction*> usingInsts;     // ʹøñָ (Load/Store)
+            size_t                    index;          //  promotiveAllocas е
         };
 
-        std::vector<AllocaInfo>           promotiveAllocas;
-        std::vector<std::stack<Operand*>> renamingStacks;
-        std::map<Instruction*, size_t>    phiToAllocaIndex;  // ¼ Phi ָӦ Alloca 
-        std::map<Operand*, Operand*>      replacements;
-        std::map<Operand*, size_t>        allocaPtrToIndex;  // alloca ptr -> index for O(1) lookup      // ٲ
+        std::vector<AllocaInfo>               promotiveAllocas;
+        std::unordered_map<Operand*, size_t> allocaPtrToIndex;  // alloca ptr -> index
+
+        //  ID -> ÿв PHI Ӧ Alloca 
+        std::vector<std::vector<std::pair<PhiInst*, size_t>>> blockPhis;
+
+        // ״̬ÿ Alloca ǰ°汾nullptr ʾδ壩
+        // Լǵľɰ汾־뿪ʱ־ˣÿ Alloca һ汾ջ
+        std::vector<Operand*>                    currentDefs;
+        std::vector<std::pair<size_t, Operand*>> renameLog;
 
         void collectPromotiveAllocas(Function& function);
-        void insertPhiNodes(Function& function, Analysis::DomInfo* domInfo);
+        void computeLiveInBlocks(const AllocaInfo& info, Analysis::CFG* cfg, std::vector<size_t>& liveInStamp,
+            std::vector<size_t>& defStamp, std::vector<size_t>& workList);
+        void insertPhiNodes(Function& function, Analysis::DomInfo* domInfo, Analysis::CFG* cfg);
         void renameVariables(Function& function, Analysis::DomInfo* domInfo, Analysis::CFG* cfg);
-        void renameRecursive(size_t blockId, Analysis::DomInfo* domInfo, Analysis::CFG* cfg,
-                             std::map<size_t, bool>& visited);
-        void replaceOperands(Instruction* inst);
+        void renameBlock(Function& function, size_t blockId, Analysis::CFG* cfg);
     };
 }  // namespace ME
 
@@ -0,0 +1,544 @@
+#include <middleend/pass/pass_manager.h>
+#include <middleend/module/ir_module.h>
+#include <middleend/module/ir_function.h>
+#include <middleend/module/ir_block.h>
+#include <middleend/pass/analysis/analysis_manager.h>
+#include <thread_pool.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <iomanip>
+#include <map>
+#include <ostream>
+
+namespace ME
+{
+    static std::map<std::string, PassRegistry::Factory>& factories()
+    {
+        static std::map<std::string, PassRegistry::Factory> f;
+        return f;
+    }
+
+    void PassRegistry::registerPassFactory(const std::string& name, Factory factory)
+    {
+        factories()[name] = std::move(factory);
+    }
+
+    std::unique_ptr<Pass> PassRegistry::createPass(const std::string& name)
+    {
+        auto it = factories().find(name);
+        if (it == factories().end()) return nullptr;
+        return std::unique_ptr<Pass>(it->second());
+    }
+
+    std::vector<std::string> PassRegistry::listPasses()
+    {
+        std::vector<std::string> names;
+        names.reserve(factories().size());
+        for (auto& [name, _] : factories()) names.push_back(name);
+        return names;
+    }
+
+    void PassTimer::add(const std::string& name, double ms, long long instDelta)
+    {
+        auto it = records.find(name);
+        if (it == records.end())
+        {
+            order.push_back(name);
+            it = records.emplace(name, Record()).first;
+        }
+        it->second.runs += 1;
+        it->second.ms += ms;
+        it->second.instDelta += instDelta;
+    }
+
+    void PassTimer::merge(const PassTimer& other)
+    {
+        for (auto& name : other.order)
+        {
+            const Record& record = other.records.at(name);
+            auto          it     = records.find(name);
+            if (it == records.end())
+            {
+                order.push_back(name);
+                it = records.emplace(name, Record()).first;
+            }
+            it->second.runs += record.runs;
+            it->second.ms += record.ms;
+            it->second.instDelta += record.instDelta;
+        }
+    }
+
+    void PassTimer::report(std::ostream& os) const
+    {
+        double total = 0.0;
+        for (auto& [_, record] : records) total += record.ms;
+
+        os << "===" << std::string(60, '-') << "===\n";
+        os << "                 Pass execution timing report\n";
+        os << "===" << std::string(60, '-') << "===\n";
+        os << "  Total Execution Time: " << std::fixed << std::setprecision(3) << total << " ms\n\n";
+        os << std::right << std::setw(14) << "Wall (ms)" << std::setw(9) << "(%)" << std::setw(8) << "Runs"
+           << std::setw(13) << "Inst Delta" << "  Name\n";
+        for (auto& name : order)
+        {
+            const Record& record = records.at(name);
+            double        pct    = total > 0.0 ? record.ms * 100.0 / total : 0.0;
+            os << std::setw(14) << std::setprecision(3) << record.ms << std::setw(8) << std::setprecision(1) << pct
+               << "%" << std::setw(8) << record.runs << std::setw(13) << std::showpos << record.instDelta
+               << std::noshowpos << "  " << name << "\n";
+        }
+        os << std::setw(14) << std::setprecision(3) << total << std::setw(8) << std::setprecision(1)
+           << (total > 0.0 ? 100.0 : 0.0) << "%" << std::setw(23) << "" << "  Total\n";
+        os.unsetf(std::ios_base::floatfield);
+        os << std::setprecision(6);
+    }
+
+    size_t PassTimer::countInsts(Function& function)
+    {
+        size_t count = 0;
+        for (auto& [_, block] : function.blocks) count += block->insts.size();
+        return count;
+    }
+
+    size_t PassTimer::countInsts(Module& module)
+    {
+        size_t count = 0;
+        for (auto* function : module.functions) count += countInsts(*function);
+        return count;
+    }
+
+    namespace
+    {
+        thread_local FunctionBudget* currentBudget = nullptr;
+    }  // namespace
+
+    FunctionBudget::FunctionBudget(const std::string& name, size_t fuel, double limitMs)
+        : name(name),
+          fuel(fuel),
+          limitMs(limitMs),
+          used(0),
+          spentMs(0.0),
+          activeSince(),
+          active(false),
+          depleted(false),
+          notes()
+    {}
+
+    bool FunctionBudget::consume(size_t steps)
+    {
+        used += steps;
+        return !exhausted();
+    }
+
+    bool FunctionBudget::exhausted()
+    {
+        if (!depleted) depleted = (fuel > 0 && used >= fuel) || (limitMs > 0.0 && elapsedMs() >= limitMs);
+        return depleted;
+    }
+
+    void FunctionBudget::note(const std::string& pass, const std::string& action)
+    {
+        // 不动点组每轮都可能走到同一处降级，同样的记录只保留一条
+        std::string text = pass + ": " + action;
+        for (auto& n : notes)
+            if (n == text) return;
+        notes.push_back(std::move(text));
+    }
+
+    double FunctionBudget::elapsedMs() const
+    {
+        if (!active) return spentMs;
+        return spentMs + std::chrono::duration<double, std::milli>(Clock::now() - activeSince).count();
+    }
+
+    FunctionBudget* FunctionBudget::current() { return currentBudget; }
+
+    FunctionBudget::Scope::Scope(FunctionBudget* b) : budget(nullptr), previous(currentBudget)
+    {
+        if (!b || b->active) return;
+        budget              = b;
+        budget->active      = true;
+        budget->activeSince = Clock::now();
+        currentBudget       = budget;
+    }
+
+    FunctionBudget::Scope::~Scope()
+    {
+        if (!budget) return;
+        budget->spentMs = budget->elapsedMs();
+        budget->active  = false;
+        currentBudget   = previous;
+    }
+
+    CompileBudget::CompileBudget(size_t fuel, double limitMs) : fuel(fuel), limitMs(limitMs), order(), budgets() {}
+
+    void CompileBudget::prepare(Module& module)
+    {
+        order.clear();
+        budgets.clear();
+        for (auto* function : module.functions)
+        {
+            order.push_back(function);
+            budgets.emplace(function, FunctionBudget(function->funcDef->funcName, fuel, limitMs));
+        }
+    }
+
+    FunctionBudget* CompileBudget::get(Function& function)
+    {
+        auto it = budgets.find(&function);
+        return it == budgets.end() ? nullptr : &it->second;
+    }
+
+    void CompileBudget::report(std::ostream& os) const
+    {
+        size_t throttled = 0;
+        for (auto* function : order) throttled += budgets.at(function).throttled();
+
+        os << "===" << std::string(60, '-') << "===\n";
+        os << "                 Compile budget report\n";
+        os << "===" << std::string(60, '-') << "===\n";
+        os << "  Fuel per function: " << (fuel > 0 ? std::to_string(fuel) + " steps" : std::string("unlimited"))
+           << "\n";
+        os << "  Time per function: " << std::fixed << std::setprecision(3);
+        if (limitMs > 0.0)
+            os << limitMs << " ms\n";
+        else
+            os << "unlimited\n";
+        os << "  Throttled functions: " << throttled << " of " << order.size() << "\n";
+        if (throttled > 0)
+        {
+            os << "\n" << std::right << std::setw(12) << "Steps" << std::setw(14) << "Wall (ms)" << "  Function\n";
+            for (auto* function : order)
+            {
+                const FunctionBudget& budget = budgets.at(function);
+                if (!budget.throttled()) continue;
+                os << std::setw(12) << budget.stepsUsed() << std::setw(14) << budget.elapsedMs() << "  "
+                   << budget.getName() << "\n";
+                for (auto& n : budget.getNotes()) os << std::string(28, ' ') << n << "\n";
+            }
+        }
+        os.unsetf(std::ios_base::floatfield);
+        os << std::setprecision(6);
+    }
+
+    FunctionPassManager::FunctionPassManager(size_t maxIterations)
+        : passes(), maxIterations(maxIterations == 0 ? 1 : maxIterations), timer(nullptr), budget(nullptr)
+    {}
+
+    void FunctionPassManager::addPass(const std::string& name, std::unique_ptr<FunctionPass> pass)
+    {
+        bool isManager = dynamic_cast<FunctionPassManager*>(pass.get()) != nullptr;
+        if (isManager)
+        {
+            static_cast<FunctionPassManager*>(pass.get())->setTimer(timer);
+            static_cast<FunctionPassManager*>(pass.get())->setBudget(budget);
+        }
+        passes.push_back({name, std::move(pass), isManager});
+    }
+
+    void FunctionPassManager::setTimer(PassTimer* t)
+    {
+        timer = t;
+        for (auto& entry : passes)
+            if (entry.isManager) static_cast<FunctionPassManager*>(entry.pass.get())->setTimer(t);
+    }
+
+    void FunctionPassManager::setBudget(CompileBudget* b)
+    {
+        budget = b;
+        for (auto& entry : passes)
+            if (entry.isManager) static_cast<FunctionPassManager*>(entry.pass.get())->setBudget(b);
+    }
+
+    void FunctionPassManager::runOnModule(Module& module)
+    {
+        // 每个 Pass 运行后已在 runOnFunction 中完成失效，这里不再按汇总结果重复失效
+        for (auto* function : module.functions) runOnFunction(*function);
+    }
+
+    PreservedAnalyses FunctionPassManager::runOnFunction(Function& function)
+    {
+        if (function.blocks.empty()) return PreservedAnalyses::all();
+
+        // 最外层的管理器开始计时，嵌套的不动点组沿用同一份预算
+        FunctionBudget*       functionBudget = budget ? budget->get(function) : nullptr;
+        FunctionBudget::Scope scope(functionBudget);
+
+        PreservedAnalyses result = PreservedAnalyses::all();
+        for (size_t iter = 0; iter < maxIterations; ++iter)
+        {
+            bool changed = false;
+            for (auto& entry : passes)
+            {
+                PreservedAnalyses pa;
+                if (timer && !entry.isManager)
+                {
+                    size_t before = PassTimer::countInsts(function);
+                    auto   start  = std::chrono::steady_clock::now();
+                    pa            = entry.pass->runOnFunction(function);
+                    auto   end    = std::chrono::steady_clock::now();
+                    timer->add(entry.name,
+                        std::chrono::duration<double, std::milli>(end - start).count(),
+                        static_cast<long long>(PassTimer::countInsts(function)) - static_cast<long long>(before));
+                }
+                else
+                    pa = entry.pass->runOnFunction(function);
+
+                if (!entry.isManager) Analysis::AM.invalidate(function, pa);
+                changed |= !pa.areAllPreserved();
+                result.intersect(pa);
+            }
+            // 本轮没有任何 Pass 修改 IR，已到达不动点
+            if (!changed) break;
+            // 预算用完后不再迭代，保留已完成各轮的结果
+            if (functionBudget && iter + 1 < maxIterations && functionBudget->exhausted())
+            {
+                std::string group = "fixpoint(";
+                for (size_t k = 0; k < passes.size(); ++k) group += (k ? "," : "") + passes[k].name;
+                functionBudget->note(group + ")", "stopped after " + std::to_string(iter + 1) + " round(s)");
+                break;
+            }
+        }
+        return result;
+    }
+
+    ModulePassManager::ModulePassManager() : passes(), timer(nullptr), budget(nullptr) {}
+
+    void ModulePassManager::addPass(const std::string& name, std::unique_ptr<Pass> pass)
+    {
+        bool isManager = dynamic_cast<FunctionPassManager*>(pass.get()) != nullptr;
+        if (isManager)
+        {
+            static_cast<FunctionPassManager*>(pass.get())->setTimer(timer);
+            static_cast<FunctionPassManager*>(pass.get())->setBudget(budget);
+        }
+        passes.push_back({name, std::move(pass), isManager});
+    }
+
+    void ModulePassManager::setTimer(PassTimer* t)
+    {
+        timer = t;
+        for (auto& entry : passes)
+            if (entry.isManager) static_cast<FunctionPassManager*>(entry.pass.get())->setTimer(t);
+    }
+
+    void ModulePassManager::setBudget(CompileBudget* b)
+    {
+        budget = b;
+        for (auto& entry : passes)
+            if (entry.isManager) static_cast<FunctionPassManager*>(entry.pass.get())->setBudget(b);
+    }
+
+    void ModulePassManager::runEntry(Entry& entry, Module& module)
+    {
+        if (!timer || entry.isManager)
+        {
+            entry.pass->runOnModule(module);
+            return;
+        }
+
+        size_t before = PassTimer::countInsts(module);
+        auto   start  = std::chrono::steady_clock::now();
+        entry.pass->runOnModule(module);
+        auto end = std::chrono::steady_clock::now();
+        timer->add(entry.name,
+            std::chrono::duration<double, std::milli>(end - start).count(),
+            static_cast<long long>(PassTimer::countInsts(module)) - static_cast<long long>(before));
+    }
+
+    void ModulePassManager::run(Module& module)
+    {
+        for (auto& entry : passes) runEntry(entry, module);
+    }
+
+    void ModulePassManager::run(Module& module, ThreadPool& pool, const std::vector<ModulePassManager*>& replicas)
+    {
+        for (size_t k = 0; k < passes.size(); ++k)
+        {
+            if (!passes[k].isManager)
+            {
+                runEntry(passes[k], module);
+                continue;
+            }
+
+            auto& functions = module.functions;
+            pool.parallelFor(functions.size(), [&](size_t workerId, size_t index) {
+                auto* fpm = static_cast<FunctionPassManager*>(replicas[workerId]->passes[k].pass.get());
+                fpm->runOnFunction(*functions[index]);
+            });
+        }
+    }
+
+    std::string getDefaultPipeline(int optimizeLevel)
+    {
+        if (optimizeLevel <= 0) return "";
+        if (optimizeLevel == 1) return "unify-return,mem2reg,adce,dce";
+        // -O2 及以上让 ADCE 与 DCE 交替运行到不动点；目前 -O3 没有额外的 Pass，与 -O2 相同
+        return "unify-return,mem2reg,fixpoint(adce,dce)";
+    }
+
+    namespace
+    {
+        // 不动点组的轮数上限，防止 Pass 之间来回改写导致不收敛
+        constexpr size_t fixpointMaxIterations = 8;
+
+        /*
+         * 流水线描述的文法：
+         *   pipeline := item (',' item)*
+         *   item     := name | 'fixpoint' '(' item (',' item)* ')'
+         * fixpoint(...) 内只允许函数级 Pass
+         */
+        class PipelineParser
+        {
+          private:
+            const std::string& text;
+            size_t             pos;
+            std::string&       error;
+
+          public:
+            PipelineParser(const std::string& text, std::string& error) : text(text), pos(0), error(error) {}
+
+            bool parse(ModulePassManager& mpm)
+            {
+                std::unique_ptr<FunctionPassManager> fpm;
+                auto                                 flush = [&]() {
+                    if (fpm && !fpm->empty()) mpm.addPass("function", std::move(fpm));
+                    fpm.reset();
+                };
+
+                while (true)
+                {
+                    std::string           name;
+                    std::unique_ptr<Pass> pass;
+                    if (!parseItem(name, pass)) return false;
+
+                    if (auto* functionPass = dynamic_cast<FunctionPass*>(pass.get()))
+                    {
+                        if (!fpm) fpm = std::make_unique<FunctionPassManager>();
+                        pass.release();
+                        fpm->addPass(name, std::unique_ptr<FunctionPass>(functionPass));
+                    }
+                    else
+                    {
+                        flush();
+                        mpm.addPass(name, std::move(pass));
+                    }
+
+                    if (pos == text.size()) break;
+                    if (text[pos] != ',') return fail("expected ','");
+                    ++pos;
+                }
+                flush();
+                return true;
+            }
+
+          private:
+            bool fail(const std::string& msg)
+            {
+                error = msg + " at position " + std::to_string(pos) + " in '" + text + "'";
+                return false;
+            }
+
+            bool parseItem(std::string& name, std::unique_ptr<Pass>& pass)
+            {
+                size_t start = pos;
+                while (pos < text.size() &&
+                       (std::isalnum(static_cast<unsigned char>(text[pos])) || text[pos] == '-' || text[pos] == '_'))
+                    ++pos;
+                name = text.substr(start, pos - start);
+                if (name.empty()) return fail("expected pass name");
+
+                if (name != "fixpoint")
+                {
+                    pass = PassRegistry::createPass(name);
+                    if (!pass)
+                    {
+                        pos = start;
+                        return fail("unknown pass '" + name + "'");
+                    }
+                    return true;
+                }
+
+                if (pos == text.size() || text[pos] != '(') return fail("expected '(' after fixpoint");
+                ++pos;
+
+                auto group = std::make_unique<FunctionPassManager>(fixpointMaxIterations);
+                while (true)
+                {
+                    std::string           innerName;
+                    std::unique_ptr<Pass> inner;
+                    if (!parseItem(innerName, inner)) return false;
+
+                    auto* functionPass = dynamic_cast<FunctionPass*>(inner.get());
+                    if (!functionPass) return fail("module pass '" + innerName + "' is not allowed inside fixpoint(...)");
+                    inner.release();
+                    group->addPass(innerName, std::unique_ptr<FunctionPass>(functionPass));
+
+                    if (pos < text.size() && text[pos] == ',')
+                    {
+                        ++pos;
+                        continue;
+                    }
+                    if (pos < text.size() && text[pos] == ')')
+                    {
+                        ++pos;
+                        break;
+                    }
+                    return fail("expected ',' or ')'");
+                }
+
+                name = text.substr(start, pos - start);
+                pass = std::move(group);
+                return true;
+            }
+        };
+    }  // namespace
+
+    bool parsePassPipeline(const std::string& text, ModulePassManager& mpm, std::string& error)
+    {
+        if (text.empty()) return true;
+        PipelineParser parser(text, error);
+        return parser.parse(mpm);
+    }
+
+    bool runPassPipeline(Module& module, const std::string& pipeline, size_t jobs, PassTimer* timer,
+        CompileBudget* budget, std::string& error)
+    {
+        if (budget && !budget->enabled()) budget = nullptr;
+        if (budget) budget->prepare(module);
+
+        // 每个线程对应一份流水线副本，线程数超过函数数没有意义
+        jobs = std::min(jobs, module.functions.size());
+        if (jobs <= 1)
+        {
+            ModulePassManager mpm;
+            if (!parsePassPipeline(pipeline, mpm, error)) return false;
+            mpm.setTimer(timer);
+            mpm.setBudget(budget);
+            mpm.run(module);
+            return true;
+        }
+
+        std::vector<std::unique_ptr<ModulePassManager>> replicas;
+        std::vector<ModulePassManager*>                 replicaPtrs;
+        std::vector<PassTimer>                          timers(jobs);
+        for (size_t i = 0; i < jobs; ++i)
+        {
+            replicas.push_back(std::make_unique<ModulePassManager>());
+            if (!parsePassPipeline(pipeline, *replicas.back(), error)) return false;
+            if (timer) replicas.back()->setTimer(&timers[i]);
+            replicas.back()->setBudget(budget);
+            replicaPtrs.push_back(replicas.back().get());
+        }
+
+        {
+            ThreadPool pool(jobs);
+            replicas[0]->run(module, pool, replicaPtrs);
+        }
+
+        if (timer)
+            for (auto& t : timers) timer->merge(t);
+        return true;
+    }
+}  // namespace ME
@@ -0,0 +1,206 @@
+#ifndef __MIDDLEEND_PASS_PASS_MANAGER_H__
+#define __MIDDLEEND_PASS_PASS_MANAGER_H__
+
+#include <interfaces/middleend/pass.h>
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ThreadPool;
+
+/*
+ * 中端 Pass 管理器
+ * - PassRegistry: 按名字注册 Pass 工厂，各 Pass 在自己的源文件中通过静态对象自动注册（与 TargetRegistry 相同）
+ * - FunctionPassManager: 对每个函数依次运行一组 FunctionPass，并按返回的 PreservedAnalyses 使分析失效；
+ *   maxIterations > 1 时作为不动点组，反复运行直到所有 Pass 都不再修改 IR 或达到轮数上限
+ * - ModulePassManager: 按顺序运行 ModulePass 与 FunctionPassManager
+ * - parsePassPipeline: 解析形如 "unify-return,mem2reg,fixpoint(adce,dce)" 的流水线描述，
+ *   相邻的函数级 Pass 会合并进同一个 FunctionPassManager，保证逐函数按顺序执行
+ * - PassTimer: -time-passes 时统计每个 Pass 的墙钟时间与 IR 指令数变化
+ * - CompileBudget / FunctionBudget: -opt-fuel / -func-budget-ms 时给每个函数一份步数（按处理的指令数计）
+ *   与墙钟时间预算。Pass 通过 FunctionBudget::current() 记账并查询，预算用完后昂贵的 Pass 跳过或
+ *   降级为少迭代的模式，不动点组不再继续迭代；结束后 report 列出被限流的函数
+ * - runPassPipeline: -j N 时函数级 Pass 组按函数分发到工作窃取线程池并行执行。
+ *   Pass 对象带有运行时状态，因此每个工作线程使用一份独立解析出的流水线；
+ *   各函数的 IR、操作数表与分析缓存互不共享，输出与串行执行完全一致
+ */
+
+namespace ME
+{
+    class PassRegistry
+    {
+      public:
+        using Factory = std::function<Pass*()>;
+
+        static void                     registerPassFactory(const std::string& name, Factory factory);
+        static std::unique_ptr<Pass>    createPass(const std::string& name);
+        static std::vector<std::string> listPasses();
+    };
+
+    class PassTimer
+    {
+      private:
+        struct Record
+        {
+            size_t    runs      = 0;
+            double    ms        = 0.0;
+            long long instDelta = 0;
+        };
+        std::vector<std::string>                order;  // 按首次运行的顺序输出
+        std::unordered_map<std::string, Record> records;
+
+      public:
+        void add(const std::string& name, double ms, long long instDelta);
+        void merge(const PassTimer& other);
+        void report(std::ostream& os) const;
+
+        static size_t countInsts(Function& function);
+        static size_t countInsts(Module& module);
+    };
+
+    /*
+     * 单个函数的优化预算，只由正在处理该函数的线程访问：
+     * - 步数：Pass 每扫描一遍函数按指令数调用 consume 记账，fuel 为 0 表示不限
+     * - 时间：只累计该函数处于活动状态（Scope 内）的时间，串行时不会把其他函数的耗时算进来
+     * 预算一旦耗尽就保持耗尽；Pass 降级或跳过时用 note 记下原因，供 CompileBudget::report 输出
+     */
+    class FunctionBudget
+    {
+      private:
+        using Clock = std::chrono::steady_clock;
+
+        std::string              name;
+        size_t                   fuel;
+        double                   limitMs;
+        size_t                   used;
+        double                   spentMs;  // 之前各次活动累计的时间
+        Clock::time_point        activeSince;
+        bool                     active;
+        bool                     depleted;
+        std::vector<std::string> notes;
+
+      public:
+        FunctionBudget(const std::string& name, size_t fuel, double limitMs);
+
+        // 记入 steps 步并检查时间，返回预算是否还有剩余
+        bool consume(size_t steps);
+        bool exhausted();
+        void note(const std::string& pass, const std::string& action);
+
+        const std::string&              getName() const { return name; }
+        size_t                          stepsUsed() const { return used; }
+        double                          elapsedMs() const;
+        bool                            throttled() const { return !notes.empty(); }
+        const std::vector<std::string>& getNotes() const { return notes; }
+
+        // 当前线程正在优化的函数的预算，没有设置预算时为 nullptr
+        static FunctionBudget* current();
+
+        // 在作用域内把 budget 设为当前线程的当前预算并计时；嵌套的管理器再次进入同一函数时不重复计时
+        class Scope
+        {
+          private:
+            FunctionBudget* budget;
+            FunctionBudget* previous;
+
+          public:
+            explicit Scope(FunctionBudget* budget);
+            ~Scope();
+            Scope(const Scope&)            = delete;
+            Scope& operator=(const Scope&) = delete;
+        };
+    };
+
+    /*
+     * 整个模块的预算：prepare 为每个函数建立一份 FunctionBudget，之后只读查表，
+     * 同一函数同一时刻只在一个线程上运行，因此 -j N 时各副本流水线共用同一个 CompileBudget
+     */
+    class CompileBudget
+    {
+      private:
+        size_t                                        fuel;
+        double                                        limitMs;
+        std::vector<Function*>                        order;
+        std::unordered_map<Function*, FunctionBudget> budgets;
+
+      public:
+        CompileBudget(size_t fuel, double limitMs);
+
+        bool            enabled() const { return fuel > 0 || limitMs > 0.0; }
+        void            prepare(Module& module);
+        FunctionBudget* get(Function& function);
+        void            report(std::ostream& os) const;
+    };
+
+    class FunctionPassManager : public FunctionPass
+    {
+      private:
+        struct Entry
+        {
+            std::string                   name;
+            std::unique_ptr<FunctionPass> pass;
+            bool                          isManager;  // 嵌套的管理器自己负责失效与计时
+        };
+        std::vector<Entry> passes;
+        size_t             maxIterations;
+        PassTimer*         timer;
+        CompileBudget*     budget;
+
+      public:
+        explicit FunctionPassManager(size_t maxIterations = 1);
+        ~FunctionPassManager() = default;
+
+        void addPass(const std::string& name, std::unique_ptr<FunctionPass> pass);
+        void setTimer(PassTimer* t);
+        void setBudget(CompileBudget* b);
+        bool empty() const { return passes.empty(); }
+
+        void              runOnModule(Module& module) override;
+        PreservedAnalyses runOnFunction(Function& function) override;
+    };
+
+    class ModulePassManager
+    {
+      private:
+        struct Entry
+        {
+            std::string           name;
+            std::unique_ptr<Pass> pass;
+            bool                  isManager;
+        };
+        std::vector<Entry> passes;
+        PassTimer*         timer;
+        CompileBudget*     budget;
+
+      public:
+        ModulePassManager();
+        ~ModulePassManager() = default;
+
+        void addPass(const std::string& name, std::unique_ptr<Pass> pass);
+        void setTimer(PassTimer* t);
+        void setBudget(CompileBudget* b);
+        bool empty() const { return passes.empty(); }
+
+        void run(Module& module);
+        // 模块级 Pass 在调用线程上执行，函数级 Pass 组按函数分发到 pool；
+        // replicas[w] 供第 w 个工作线程使用，必须由同一流水线描述解析得到
+        void run(Module& module, ThreadPool& pool, const std::vector<ModulePassManager*>& replicas);
+
+      private:
+        void runEntry(Entry& entry, Module& module);
+    };
+
+    // -O 等级对应的默认流水线描述，-O0 为空串
+    std::string getDefaultPipeline(int optimizeLevel);
+    // 解析流水线描述并追加到 mpm，出错时返回 false 并在 error 中给出原因
+    bool parsePassPipeline(const std::string& text, ModulePassManager& mpm, std::string& error);
+    // 用 jobs 个线程运行流水线；timer 非空时收集各线程的计时并汇总到其中，budget 非空时按其限制各函数的优化量
+    bool runPassPipeline(Module& module, const std::string& pipeline, size_t jobs, PassTimer* timer,
+        CompileBudget* budget, std::string& error);
+}  // namespace ME
+
+#endif  // __MIDDLEEND_PASS_PASS_MANAGER_H__
@@ -1,31 +1,41 @@
 #include <middleend/pass/unify_return.h>
 #include <middleend/pass/analysis/analysis_manager.h>
 #include <middleend/pass/analysis/cfg.h>
+#include <middleend/pass/analysis/dominfo.h>
+#include <middleend/pass/pass_manager.h>
 #include <middleend/module/ir_operand.h>
-#include <algorithm>
 #include <iostream>
 
 namespace ME
 {
+    namespace
+    {
+        struct AutoRegister
+        {
+            AutoRegister() { PassRegistry::registerPassFactory("unify-return", []() -> Pass* { return new UnifyReturnPass(); }); }
+        } s_auto_register;
+    }  // namespace
+
     void UnifyReturnPass::runOnModule(Module& module)
     {
-        for (auto* function : module.functions) unifyFunctionReturns(*function);
+        for (auto* function : module.functions) Analysis::AM.invalidate(*function, unifyFunctionReturns(*function));
     }
 
-    void UnifyReturnPass::runOnFunction(Function& function) { unifyFunctionReturns(function); }
+    PreservedAnalyses UnifyReturnPass::runOnFunction(Function& function) { return unifyFunctionReturns(function); }
 
-    void UnifyReturnPass::unifyFunctionReturns(Function& function)
+    PreservedAnalyses UnifyReturnPass::unifyFunctionReturns(Function& function)
     {
         auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
 
         auto retInstructions = findReturnInstructions(cfg);
 
-        if (retInstructions.size() <= 1) return;
+        if (retInstructions.size() <= 1) return PreservedAnalyses::all();
 
         Block* exitBlock = function.createBlock();
 
         std::vector<std::pair<Operand*, Operand*>> returnValues;
         DataType                                   returnType = DataType::VOID;
+        std::vector<DomTreeUpdater::Update>        domUpdates;
 
         for (auto* retInst : retInstructions)
         {
@@ -34,21 +44,18 @@ namespace ME
 
             returnType = retInst->rt;
 
-            Operand* labelOp = getLabelOperand(containingBlock->blockId);
+            Operand* labelOp = function.getLabelOperand(containingBlock->blockId);
 
             if (retInst->res)
                 returnValues.push_back({retInst->res, labelOp});
             else
                 returnValues.push_back({nullptr, labelOp});
 
-            auto it = std::find(containingBlock->insts.begin(), containingBlock->insts.end(), retInst);
-            if (it != containingBlock->insts.end())
-            {
-                Operand* exitLabel  = getLabelOperand(exitBlock->blockId);
-                auto*    branchInst = new BrUncondInst(exitLabel);
-                *it                 = branchInst;
-                delete retInst;
-            }
+            Operand* exitLabel  = function.getLabelOperand(exitBlock->blockId);
+            auto*    branchInst = new (function.getArena()) BrUncondInst(exitLabel);
+            containingBlock->replace(containingBlock->iteratorTo(retInst), branchInst);
+            domUpdates.push_back(
+                {DomTreeUpdater::UpdateKind::Insert, (int)containingBlock->blockId, (int)exitBlock->blockId});
         }
 
         if (returnType != DataType::VOID && !returnValues.empty())
@@ -59,38 +66,43 @@ namespace ME
 
             if (!validValues.empty())
             {
-                Operand* resultReg = getRegOperand(function.getNewRegId());
+                Operand* resultReg = function.getRegOperand(function.getNewRegId());
 
-                auto* phiInst = new PhiInst(returnType, resultReg);
+                auto* phiInst = new (function.getArena()) PhiInst(returnType, resultReg);
                 for (auto& [val, label] : validValues) phiInst->addIncoming(val, label);
                 exitBlock->insertBack(phiInst);
 
-                auto* finalRet = new RetInst(returnType, resultReg);
+                auto* finalRet = new (function.getArena()) RetInst(returnType, resultReg);
                 exitBlock->insertBack(finalRet);
             }
             else
             {
-                auto* finalRet = new RetInst(DataType::VOID, nullptr);
+                auto* finalRet = new (function.getArena()) RetInst(DataType::VOID, nullptr);
                 exitBlock->insertBack(finalRet);
             }
         }
         else
         {
-            auto* finalRet = new RetInst(DataType::VOID, nullptr);
+            auto* finalRet = new (function.getArena()) RetInst(DataType::VOID, nullptr);
             exitBlock->insertBack(finalRet);
         }
 
         // 由于在 `if (retInstructions.size() <= 1) return;` 处没有退出
         // 我们可以确定该 pass 的执行一定向当前函数插入了新的基本块并修改了跳转关系
-        // 因此需要 invalidate 当前函数的 CFG 缓存
-        Analysis::AM.invalidate(function);
+        // 改动只是新增出口块及指向它的边：CFG 就地重建，已缓存的支配信息按新增的边增量更新，二者都可保留
+        cfg->build(function);
+        if (auto* domInfo = Analysis::AM.getCached<Analysis::DomInfo>(function)) domInfo->applyUpdates(domUpdates);
+
+        PreservedAnalyses pa;
+        pa.preserve<Analysis::CFG>().preserve<Analysis::DomInfo>();
+        return pa;
     }
 
     std::vector<RetInst*> UnifyReturnPass::findReturnInstructions(Analysis::CFG* cfg)
     {
         std::vector<RetInst*> retInstructions;
 
-        for (auto& [blockId, block] : cfg->id2block)
+        for (auto* block : cfg->rpo)
         {
             for (auto* inst : block->insts)
             {
@@ -104,13 +116,8 @@ namespace ME
 
     Block* UnifyReturnPass::getBlockContaining(Function& function, Instruction* inst)
     {
-        auto* cfg = Analysis::AM.get<Analysis::CFG>(function);
-        for (auto& [blockId, block] : cfg->id2block)
-        {
-            auto it = std::find(block->insts.begin(), block->insts.end(), inst);
-            if (it != block->insts.end()) return block;
-        }
-        return nullptr;
+        //指令记录了所在的基本块，无需逐块查找
+        return inst->getParent();
     }
 
 }  // namespace ME
@@ -18,10 +18,10 @@ namespace ME
         ~UnifyReturnPass() = default;
 
         void runOnModule(Module& module) override;
-        void runOnFunction(Function& function) override;
+        PreservedAnalyses runOnFunction(Function& function) override;
 
       private:
-        void unifyFunctionReturns(Function& function);
+        PreservedAnalyses unifyFunctionReturns(Function& function);
 
         std::vector<RetInst*> findReturnInstructions(Analysis::CFG* cfg);
         Block*                getBlockContaining(Function& function, Instruction* inst);
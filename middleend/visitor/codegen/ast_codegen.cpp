@@ -147,121 +147,121 @@ namespace ME
 
     LoadInst* ASTCodeGen::createLoadInst(DataType t, Operand* ptr, size_t resReg)
     {
-        return new LoadInst(t, ptr, getRegOperand(resReg));
+        return new (curFunc->getArena()) LoadInst(t, ptr, getRegOperand(resReg));
     }
 
     StoreInst* ASTCodeGen::createStoreInst(DataType t, size_t valReg, Operand* ptr)
     {
-        return new StoreInst(t, getRegOperand(valReg), ptr);
+        return new (curFunc->getArena()) StoreInst(t, getRegOperand(valReg), ptr);
     }
     StoreInst* ASTCodeGen::createStoreInst(DataType t, Operand* val, Operand* ptr)
     {
-        return new StoreInst(t, val, ptr);
+        return new (curFunc->getArena()) StoreInst(t, val, ptr);
     }
 
     ArithmeticInst* ASTCodeGen::createArithmeticI32Inst(Operator op, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return new (curFunc->getArena()) ArithmeticInst(
             op, DataType::I32, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticI32Inst_ImmeLeft(Operator op, int lhsVal, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return new (curFunc->getArena()) ArithmeticInst(
             op, DataType::I32, getImmeI32Operand(lhsVal), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticI32Inst_ImmeAll(Operator op, int lhsVal, int rhsVal, size_t resReg)
     {
-        return new ArithmeticInst(
+        return new (curFunc->getArena()) ArithmeticInst(
             op, DataType::I32, getImmeI32Operand(lhsVal), getImmeI32Operand(rhsVal), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticF32Inst(Operator op, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return new (curFunc->getArena()) ArithmeticInst(
             op, DataType::F32, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticF32Inst_ImmeLeft(
         Operator op, float lhsVal, size_t rhsReg, size_t resReg)
     {
-        return new ArithmeticInst(
+        return new (curFunc->getArena()) ArithmeticInst(
             op, DataType::F32, getImmeF32Operand(lhsVal), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     ArithmeticInst* ASTCodeGen::createArithmeticF32Inst_ImmeAll(Operator op, float lhsVal, float rhsVal, size_t resReg)
     {
-        return new ArithmeticInst(
+        return new (curFunc->getArena()) ArithmeticInst(
             op, DataType::F32, getImmeF32Operand(lhsVal), getImmeF32Operand(rhsVal), getRegOperand(resReg));
     }
 
     IcmpInst* ASTCodeGen::createIcmpInst(ICmpOp cond, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new IcmpInst(DataType::I32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
+        return new (curFunc->getArena()) IcmpInst(DataType::I32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     IcmpInst* ASTCodeGen::createIcmpInst_ImmeRight(ICmpOp cond, size_t lhsReg, int rhsVal, size_t resReg)
     {
-        return new IcmpInst(
+        return new (curFunc->getArena()) IcmpInst(
             DataType::I32, cond, getRegOperand(lhsReg), getImmeI32Operand(rhsVal), getRegOperand(resReg));
     }
     FcmpInst* ASTCodeGen::createFcmpInst(FCmpOp cond, size_t lhsReg, size_t rhsReg, size_t resReg)
     {
-        return new FcmpInst(DataType::F32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
+        return new (curFunc->getArena()) FcmpInst(DataType::F32, cond, getRegOperand(lhsReg), getRegOperand(rhsReg), getRegOperand(resReg));
     }
     FcmpInst* ASTCodeGen::createFcmpInst_ImmeRight(FCmpOp cond, size_t lhsReg, float rhsVal, size_t resReg)
     {
-        return new FcmpInst(
+        return new (curFunc->getArena()) FcmpInst(
             DataType::F32, cond, getRegOperand(lhsReg), getImmeF32Operand(rhsVal), getRegOperand(resReg));
     }
 
     FP2SIInst* ASTCodeGen::createFP2SIInst(size_t srcReg, size_t destReg)
     {
-        return new FP2SIInst(getRegOperand(srcReg), getRegOperand(destReg));
+        return new (curFunc->getArena()) FP2SIInst(getRegOperand(srcReg), getRegOperand(destReg));
     }
     SI2FPInst* ASTCodeGen::createSI2FPInst(size_t srcReg, size_t destReg)
     {
-        return new SI2FPInst(getRegOperand(srcReg), getRegOperand(destReg));
+        return new (curFunc->getArena()) SI2FPInst(getRegOperand(srcReg), getRegOperand(destReg));
     }
     ZextInst* ASTCodeGen::createZextInst(size_t srcReg, size_t destReg, size_t srcBits, size_t destBits)
     {
         ASSERT(srcBits == 1 && destBits == 32 && "Currently only support i1 to i32 zext");
-        return new ZextInst(DataType::I1, DataType::I32, getRegOperand(srcReg), getRegOperand(destReg));
+        return new (curFunc->getArena()) ZextInst(DataType::I1, DataType::I32, getRegOperand(srcReg), getRegOperand(destReg));
     }
 
     GEPInst* ASTCodeGen::createGEP_I32Inst(
         DataType t, Operand* ptr, std::vector<int> dims, std::vector<Operand*> is, size_t resReg)
     {
-        return new GEPInst(t, DataType::I32, ptr, getRegOperand(resReg), dims, is);
+        return new (curFunc->getArena()) GEPInst(t, DataType::I32, ptr, getRegOperand(resReg), dims, is);
     }
 
     CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName, CallInst::argList args, size_t resReg)
     {
-        return new CallInst(t, funcName, args, getRegOperand(resReg));
+        return new (curFunc->getArena()) CallInst(t, funcName, args, getRegOperand(resReg));
     }
     CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName, CallInst::argList args)
     {
-        return new CallInst(t, funcName, args);
+        return new (curFunc->getArena()) CallInst(t, funcName, args);
     }
     CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName, size_t resReg)
     {
-        return new CallInst(t, funcName, getRegOperand(resReg));
+        return new (curFunc->getArena()) CallInst(t, funcName, getRegOperand(resReg));
     }
-    CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName) { return new CallInst(t, funcName); }
+    CallInst* ASTCodeGen::createCallInst(DataType t, std::string funcName) { return new (curFunc->getArena()) CallInst(t, funcName); }
 
-    RetInst* ASTCodeGen::createRetInst() { return new RetInst(DataType::VOID); }
-    RetInst* ASTCodeGen::createRetInst(DataType t, size_t retReg) { return new RetInst(t, getRegOperand(retReg)); }
-    RetInst* ASTCodeGen::createRetInst(int val) { return new RetInst(DataType::I32, getImmeI32Operand(val)); }
-    RetInst* ASTCodeGen::createRetInst(float val) { return new RetInst(DataType::F32, getImmeF32Operand(val)); }
+    RetInst* ASTCodeGen::createRetInst() { return new (curFunc->getArena()) RetInst(DataType::VOID); }
+    RetInst* ASTCodeGen::createRetInst(DataType t, size_t retReg) { return new (curFunc->getArena()) RetInst(t, getRegOperand(retReg)); }
+    RetInst* ASTCodeGen::createRetInst(int val) { return new (curFunc->getArena()) RetInst(DataType::I32, getImmeI32Operand(val)); }
+    RetInst* ASTCodeGen::createRetInst(float val) { return new (curFunc->getArena()) RetInst(DataType::F32, getImmeF32Operand(val)); }
 
     BrCondInst* ASTCodeGen::createBranchInst(size_t condReg, size_t trueTar, size_t falseTar)
     {
-        return new BrCondInst(getRegOperand(condReg), getLabelOperand(trueTar), getLabelOperand(falseTar));
+        return new (curFunc->getArena()) BrCondInst(getRegOperand(condReg), getLabelOperand(trueTar), getLabelOperand(falseTar));
     }
-    BrUncondInst* ASTCodeGen::createBranchInst(size_t tar) { return new BrUncondInst(getLabelOperand(tar)); }
+    BrUncondInst* ASTCodeGen::createBranchInst(size_t tar) { return new (curFunc->getArena()) BrUncondInst(getLabelOperand(tar)); }
 
     AllocaInst* ASTCodeGen::createAllocaInst(DataType t, size_t ptrReg)
     {
-        return new AllocaInst(t, getRegOperand(ptrReg));
+        return new (curFunc->getArena()) AllocaInst(t, getRegOperand(ptrReg));
     }
     AllocaInst* ASTCodeGen::createAllocaInst(DataType t, size_t ptrReg, std::vector<int> dims)
     {
-        return new AllocaInst(t, getRegOperand(ptrReg), dims);
+        return new (curFunc->getArena()) AllocaInst(t, getRegOperand(ptrReg), dims);
     }
 
     std::list<Instruction*> ASTCodeGen::createTypeConvertInst(DataType from, DataType to, size_t srcReg)
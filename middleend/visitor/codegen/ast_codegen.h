@@ -168,6 +168,18 @@ namespace ME
         size_t getNewRegId() { return curFunc->getNewRegId(); }
         void   insert(Instruction* inst) { curBlock->insertBack(inst); }
 
+        //操作数：寄存器与标签属于当前函数；函数之外（全局变量初始值）的立即数取自模块级常量表
+        RegOperand*     getRegOperand(size_t id) { return curFunc->getRegOperand(id); }
+        LabelOperand*   getLabelOperand(size_t num) { return curFunc->getLabelOperand(num); }
+        ImmeI32Operand* getImmeI32Operand(int value)
+        {
+            return curFunc ? curFunc->getImmeI32Operand(value) : ::getImmeI32Operand(value);
+        }
+        ImmeF32Operand* getImmeF32Operand(float value)
+        {
+            return curFunc ? curFunc->getImmeF32Operand(value) : ::getImmeF32Operand(value);
+        }
+
       private:
         DataType convert(FE::AST::Type* at);
         void     handleUnaryCalc(FE::AST::ExprNode& node, FE::AST::Operator uop, Block* block, Module* m);
@@ -55,7 +55,7 @@ namespace ME
                 {
                     if (declarator->init->attr.val.isConstexpr)
                     {
-                        ME::Operand* ptr = ME::OperandFactory::getInstance().getRegOperand(reg);
+                        ME::Operand* ptr = getRegOperand(reg);
                         if (type == DataType::I64)
                         {
                             long long vll = declarator->init->attr.val.getLL();
@@ -69,13 +69,13 @@ namespace ME
                         else if (type == DataType::I32 || type == DataType::I1)
                         {
                             int v = declarator->init->attr.val.getInt();
-                            ME::Operand* valOp = ME::OperandFactory::getInstance().getImmeI32Operand(v);
+                            ME::Operand* valOp = getImmeI32Operand(v);
                             insert(createStoreInst(type, valOp, ptr));
                         }
                         else if (type == DataType::F32)
                         {
                             float v = declarator->init->attr.val.getFloat();
-                            ME::Operand* valOp = ME::OperandFactory::getInstance().getImmeF32Operand(v);
+                            ME::Operand* valOp = getImmeF32Operand(v);
                             insert(createStoreInst(type, valOp, ptr));
                         }
                     }
@@ -93,7 +93,7 @@ namespace ME
                                 for (auto* inst : convInsts) insert(inst);
                                 valReg = curFunc->getMaxReg();
                             }
-                            ME::Operand* ptr = ME::OperandFactory::getInstance().getRegOperand(reg);
+                            ME::Operand* ptr = getRegOperand(reg);
                             insert(createStoreInst(type, valReg, ptr));
                         }
                     }
@@ -109,13 +109,13 @@ namespace ME
                         for (auto* inst : convInsts) insert(inst);
                         valReg = curFunc->getMaxReg();
                     }
-                    ME::Operand* ptr = ME::OperandFactory::getInstance().getRegOperand(reg);
+                    ME::Operand* ptr = getRegOperand(reg);
                     insert(createStoreInst(type, valReg, ptr));
                 }
             }
             else
             {
-                ME::Operand* ptr = ME::OperandFactory::getInstance().getRegOperand(reg);
+                ME::Operand* ptr = getRegOperand(reg);
                 if (type == DataType::I64)
                 {
                     size_t r32 = curFunc->getNewRegId();
@@ -126,12 +126,12 @@ namespace ME
                 }
                 else if (type == DataType::I32 || type == DataType::I1)
                 {
-                    ME::Operand* valOp = ME::OperandFactory::getInstance().getImmeI32Operand(0);
+                    ME::Operand* valOp = getImmeI32Operand(0);
                     insert(createStoreInst(type, valOp, ptr));
                 }
                 else if (type == DataType::F32)
                 {
-                    ME::Operand* valOp = ME::OperandFactory::getInstance().getImmeF32Operand(0.0f);
+                    ME::Operand* valOp = getImmeF32Operand(0.0f);
                     insert(createStoreInst(type, valOp, ptr));
                 }
             }
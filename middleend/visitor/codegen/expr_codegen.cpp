@@ -13,7 +13,7 @@ void ASTCodeGen::visit(FE::AST::LeftValExpr& node, Module* m)
         // 1. ?????????? (????)
         size_t reg = name2reg.getReg(node.entry);
         if (reg != static_cast<size_t>(-1))
-            ptrOp = OperandFactory::getInstance().getRegOperand(reg);
+            ptrOp = getRegOperand(reg);
         // 2. ?????????? (??????)
         else
         {
@@ -87,7 +87,7 @@ void ASTCodeGen::handleAssign(FE::AST::LeftValExpr& lhs, FE::AST::ExprNode& rhs,
         size_t reg = name2reg.getReg(lhs.entry);
         if (reg != static_cast<size_t>(-1)) {
             // ???????????
-            ptr = OperandFactory::getInstance().getRegOperand(reg);
+            ptr = getRegOperand(reg);
         }
         // ???? B: ??????????????????????
         else
@@ -186,13 +186,13 @@ void ASTCodeGen::handleLogicalAnd(
     enterBlock(endBlock);
     
     size_t  resReg = getNewRegId();
-    auto* phi    = new PhiInst(DataType::I1, OperandFactory::getInstance().getRegOperand(resReg));
+    auto* phi    = new (curFunc->getArena()) PhiInst(DataType::I1, getRegOperand(resReg));
     
     // ???? 1: LHS ???????? (??? i1FalseReg?????? falseBlock)
-    phi->addIncoming(OperandFactory::getInstance().getRegOperand(i1FalseReg), OperandFactory::getInstance().getLabelOperand(falseBlock->blockId)); 
+    phi->addIncoming(getRegOperand(i1FalseReg), getLabelOperand(falseBlock->blockId)); 
     
     // ???? 2: LHS ??????? RHS (? rhsReg?????? rhsExitId)
-    phi->addIncoming(OperandFactory::getInstance().getRegOperand(rhsReg), OperandFactory::getInstance().getLabelOperand(rhsExitId)); 
+    phi->addIncoming(getRegOperand(rhsReg), getLabelOperand(rhsExitId)); 
     
     insert(phi);
 
@@ -271,13 +271,13 @@ void ASTCodeGen::handleLogicalOr(
     enterBlock(endBlock);
     
     size_t  resReg = getNewRegId();
-    auto* phi    = new PhiInst(DataType::I1, OperandFactory::getInstance().getRegOperand(resReg));
+    auto* phi    = new (curFunc->getArena()) PhiInst(DataType::I1, getRegOperand(resReg));
     
     // ???? 1: LHS ???????? (? i1TrueReg?????? trueBlock)
-    phi->addIncoming(OperandFactory::getInstance().getRegOperand(i1TrueReg), OperandFactory::getInstance().getLabelOperand(trueBlock->blockId)); 
+    phi->addIncoming(getRegOperand(i1TrueReg), getLabelOperand(trueBlock->blockId)); 
     
     // ???? 2: LHS ??????? RHS (? rhsReg?????? rhsExitId)
-    phi->addIncoming(OperandFactory::getInstance().getRegOperand(rhsReg), OperandFactory::getInstance().getLabelOperand(rhsExitId)); 
+    phi->addIncoming(getRegOperand(rhsReg), getLabelOperand(rhsExitId)); 
     
     insert(phi);
 }
@@ -357,7 +357,7 @@ void ASTCodeGen::handleLogicalOr(
                         aReg = getMaxReg();
                         aType = eType;
                     }
-                    args.emplace_back(eType, OperandFactory::getInstance().getRegOperand(aReg));
+                    args.emplace_back(eType, getRegOperand(aReg));
                 }
             }
         }
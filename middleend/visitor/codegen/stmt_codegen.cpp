@@ -42,7 +42,7 @@ void ASTCodeGen::visit(FE::AST::FuncDeclStmt& node, Module* m)
             // A. 传入参数值 (Value) 的寄存器分配
             // 这个寄存器用于接收 CallInst 传入的值
             size_t valRegId = getNewRegId();
-            ME::Operand* valOp = ME::OperandFactory::getInstance().getRegOperand(valRegId); 
+            ME::Operand* valOp = getRegOperand(valRegId); 
             funcdef->argRegs.emplace_back(paramType, valOp); 
 
             // B. 参数地址 (Address) 的栈空间分配 (Alloca)
@@ -58,7 +58,7 @@ void ASTCodeGen::visit(FE::AST::FuncDeclStmt& node, Module* m)
 
             // D. Store：将传入的 VALUE (valRegId) 存入 ADDRESS (ptrRegId)
             // StoreInst 必须在 AllocaInst 之后
-            ME::Operand* ptrOp = ME::OperandFactory::getInstance().getRegOperand(ptrRegId);
+            ME::Operand* ptrOp = getRegOperand(ptrRegId);
             StoreInst* storeInst = createStoreInst(paramType, valRegId, ptrOp);
             insert(storeInst); 
         }
@@ -169,7 +169,7 @@ void ASTCodeGen::visit(FE::AST::FuncDeclStmt& node, Module* m)
         if (auto* lvalExpr = dynamic_cast<FE::AST::LeftValExpr*>(decl->lval)) {
             if (lvalExpr->entry) {
                 name2reg.addSymbol(lvalExpr->entry, varReg);
-                lval2ptr[lvalExpr] = ME::OperandFactory::getInstance().getRegOperand(varReg);
+                lval2ptr[lvalExpr] = getRegOperand(varReg);
             }
         }
         
@@ -183,7 +183,7 @@ void ASTCodeGen::visit(FE::AST::FuncDeclStmt& node, Module* m)
             
             apply(*this, *decl->init, m);
             size_t initReg = curFunc->getMaxReg();
-            Operand* ptr = ME::OperandFactory::getInstance().getRegOperand(varReg);
+            Operand* ptr = getRegOperand(varReg);
             
             // 确保 StoreInst 被插入到 currentBlock（例如 Block0, 在 br 之前）
             StoreInst* storeInst = createStoreInst(varType, initReg, ptr);
@@ -2,94 +2,76 @@
 
 namespace ME
 {
-    void IRPrinter::visit(LoadInst& inst, std::ostream& os)
+    void IRPrinter::visit(LoadInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(StoreInst& inst, std::ostream& os)
+    void IRPrinter::visit(StoreInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(ArithmeticInst& inst, std::ostream& os)
+    void IRPrinter::visit(ArithmeticInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(IcmpInst& inst, std::ostream& os)
+    void IRPrinter::visit(IcmpInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(FcmpInst& inst, std::ostream& os)
+    void IRPrinter::visit(FcmpInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(AllocaInst& inst, std::ostream& os)
+    void IRPrinter::visit(AllocaInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(BrCondInst& inst, std::ostream& os)
+    void IRPrinter::visit(BrCondInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(BrUncondInst& inst, std::ostream& os)
+    void IRPrinter::visit(BrUncondInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(GlbVarDeclInst& inst, std::ostream& os)
+    void IRPrinter::visit(GlbVarDeclInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(CallInst& inst, std::ostream& os)
+    void IRPrinter::visit(CallInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(FuncDeclInst& inst, std::ostream& os)
+    void IRPrinter::visit(FuncDeclInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(FuncDefInst& inst, std::ostream& os)
+    void IRPrinter::visit(FuncDefInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(RetInst& inst, std::ostream& os)
+    void IRPrinter::visit(RetInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(GEPInst& inst, std::ostream& os)
+    void IRPrinter::visit(GEPInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(FP2SIInst& inst, std::ostream& os)
+    void IRPrinter::visit(FP2SIInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(SI2FPInst& inst, std::ostream& os)
+    void IRPrinter::visit(SI2FPInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(ZextInst& inst, std::ostream& os)
+    void IRPrinter::visit(ZextInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
-    void IRPrinter::visit(PhiInst& inst, std::ostream& os)
+    void IRPrinter::visit(PhiInst& inst, OutBuffer& out)
     {
-        (void)inst;
-        os << inst.toString();
+        inst.print(out);
     }
 }  // namespace ME
@@ -3,36 +3,41 @@
 
 #include <middleend/ir_visitor.h>
 #include <middleend/module/ir_module.h>
+#include <out_buffer.h>
 
 namespace ME
 {
-    using Printer_t = Visitor_t<void, std::ostream&>;
+    using Printer_t = Visitor_t<void, OutBuffer&>;
 
+    /*
+     * IR 打印：各指令通过 Instruction::print 直接写入 OutBuffer，
+     * 整个模块共用一块输出缓冲区，全局变量的大型初始化列表也是边生成边写出
+     */
     class IRPrinter : public Printer_t
     {
       public:
-        void visit(Module& module, std::ostream& os) override;
-        void visit(Function& func, std::ostream& os) override;
-        void visit(Block& block, std::ostream& os) override;
+        void visit(Module& module, OutBuffer& out) override;
+        void visit(Function& func, OutBuffer& out) override;
+        void visit(Block& block, OutBuffer& out) override;
 
-        void visit(LoadInst& inst, std::ostream& os) override;
-        void visit(StoreInst& inst, std::ostream& os) override;
-        void visit(ArithmeticInst& inst, std::ostream& os) override;
-        void visit(IcmpInst& inst, std::ostream& os) override;
-        void visit(FcmpInst& inst, std::ostream& os) override;
-        void visit(AllocaInst& inst, std::ostream& os) override;
-        void visit(BrCondInst& inst, std::ostream& os) override;
-        void visit(BrUncondInst& inst, std::ostream& os) override;
-        void visit(GlbVarDeclInst& inst, std::ostream& os) override;
-        void visit(CallInst& inst, std::ostream& os) override;
-        void visit(FuncDeclInst& inst, std::ostream& os) override;
-        void visit(FuncDefInst& inst, std::ostream& os) override;
-        void visit(RetInst& inst, std::ostream& os) override;
-        void visit(GEPInst& inst, std::ostream& os) override;
-        void visit(FP2SIInst& inst, std::ostream& os) override;
-        void visit(SI2FPInst& inst, std::ostream& os) override;
-        void visit(ZextInst& inst, std::ostream& os) override;
-        void visit(PhiInst& inst, std::ostream& os) override;
+        void visit(LoadInst& inst, OutBuffer& out) override;
+        void visit(StoreInst& inst, OutBuffer& out) override;
+        void visit(ArithmeticInst& inst, OutBuffer& out) override;
+        void visit(IcmpInst& inst, OutBuffer& out) override;
+        void visit(FcmpInst& inst, OutBuffer& out) override;
+        void visit(AllocaInst& inst, OutBuffer& out) override;
+        void visit(BrCondInst& inst, OutBuffer& out) override;
+        void visit(BrUncondInst& inst, OutBuffer& out) override;
+        void visit(GlbVarDeclInst& inst, OutBuffer& out) override;
+        void visit(CallInst& inst, OutBuffer& out) override;
+        void visit(FuncDeclInst& inst, OutBuffer& out) override;
+        void visit(FuncDefInst& inst, OutBuffer& out) override;
+        void visit(RetInst& inst, OutBuffer& out) override;
+        void visit(GEPInst& inst, OutBuffer& out) override;
+        void visit(FP2SIInst& inst, OutBuffer& out) override;
+        void visit(SI2FPInst& inst, OutBuffer& out) override;
+        void visit(ZextInst& inst, OutBuffer& out) override;
+        void visit(PhiInst& inst, OutBuffer& out) override;
     };
 }  // namespace ME
 
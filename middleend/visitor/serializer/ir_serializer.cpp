@@ -0,0 +1,797 @@
+#include <middleend/visitor/serializer/ir_serializer.h>
+#include <transfer.h>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <sstream>
+
+namespace ME
+{
+    namespace
+    {
+        constexpr char     binaryMagic[4] = {'S', 'Y', 'I', 'R'};
+        constexpr uint64_t binaryVersion  = 2;
+
+        constexpr unsigned operandTagBits = 3;
+        constexpr uint64_t operandTagMask = (1u << operandTagBits) - 1;
+
+        uint32_t floatBits(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        float bitsToFloat(uint32_t bits)
+        {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        void writeDims(ByteWriter& w, const std::vector<int>& dims)
+        {
+            w.writeVarint(dims.size());
+            for (int d : dims) w.writeSVarint(d);
+        }
+
+        bool isArithmeticOp(Operator op)
+        {
+            switch (op)
+            {
+                case Operator::ADD:
+                case Operator::SUB:
+                case Operator::MUL:
+                case Operator::DIV:
+                case Operator::MOD:
+                case Operator::FADD:
+                case Operator::FSUB:
+                case Operator::FMUL:
+                case Operator::FDIV:
+                case Operator::BITXOR:
+                case Operator::BITAND:
+                case Operator::SHL:
+                case Operator::ASHR:
+                case Operator::LSHR: return true;
+                default: return false;
+            }
+        }
+
+        bool isFloatArithmeticOp(Operator op)
+        {
+            return op == Operator::FADD || op == Operator::FSUB || op == Operator::FMUL || op == Operator::FDIV;
+        }
+
+        bool isFloatType(DataType dt) { return dt == DataType::F32 || dt == DataType::DOUBLE; }
+    }  // namespace
+
+    /* ---------------------------------- 写入 ---------------------------------- */
+
+    void IRBinaryWriter::write(Module& module, std::ostream& os)
+    {
+        stringIds.clear();
+        strings.clear();
+
+        // 先写模块主体以收集字符串，再把字符串表放到主体之前
+        ByteWriter body;
+        apply(*this, module, body);
+
+        ByteWriter head;
+        head.writeBytes(binaryMagic, sizeof(binaryMagic));
+        head.writeVarint(binaryVersion);
+        head.writeVarint(strings.size());
+        for (auto s : strings) head.writeString(s);
+
+        os.write(reinterpret_cast<const char*>(head.data().data()), static_cast<std::streamsize>(head.size()));
+        os.write(reinterpret_cast<const char*>(body.data().data()), static_cast<std::streamsize>(body.size()));
+    }
+
+    uint32_t IRBinaryWriter::intern(const std::string& s)
+    {
+        auto [it, inserted] = stringIds.emplace(s, static_cast<uint32_t>(strings.size()));
+        if (inserted) strings.push_back(it->first);
+        return it->second;
+    }
+
+    void IRBinaryWriter::writeOperand(ByteWriter& w, const Operand* op)
+    {
+        if (!op)
+        {
+            w.writeVarint(0);
+            return;
+        }
+
+        uint64_t payload = 0;
+        switch (op->getType())
+        {
+            case OperandType::REG: payload = static_cast<const RegOperand*>(op)->regNum; break;
+            case OperandType::LABEL: payload = static_cast<const LabelOperand*>(op)->lnum; break;
+            case OperandType::IMMEI32: payload = ByteWriter::zigzag(static_cast<const ImmeI32Operand*>(op)->value); break;
+            case OperandType::IMMEF32: payload = floatBits(static_cast<const ImmeF32Operand*>(op)->value); break;
+            case OperandType::GLOBAL: payload = intern(static_cast<const GlobalOperand*>(op)->name); break;
+            default: ERROR("Unsupported operand type in binary IR");
+        }
+        w.writeVarint((payload << operandTagBits) | static_cast<uint64_t>(op->getType()));
+    }
+
+    void IRBinaryWriter::writeVarAttr(ByteWriter& w, const FE::AST::VarAttr& attr)
+    {
+        // 类型写为 (分组, 基本类型) 序列，指针类型递归写出其指向的类型
+        for (FE::AST::Type* t = attr.type;;)
+        {
+            if (!t)
+            {
+                w.writeVarint(2);
+                break;
+            }
+            if (t->getTypeGroup() == FE::AST::TypeGroup::POINTER)
+            {
+                w.writeVarint(1);
+                t = static_cast<FE::AST::PtrType*>(t)->base;
+                continue;
+            }
+            w.writeVarint(0);
+            w.writeVarint(static_cast<uint64_t>(t->getBaseType()));
+            break;
+        }
+        w.writeByte(attr.isConstDecl ? 1 : 0);
+        w.writeSVarint(attr.scopeLevel);
+        writeDims(w, attr.arrayDims);
+
+        // 稀疏初始值：个数 { 与上一个下标之差 值 }
+        w.writeVarint(attr.initList.size());
+        size_t prev = 0;
+        for (auto& [idx, v] : attr.initList)
+        {
+            w.writeVarint(idx - prev);
+            prev      = idx;
+            auto base = v.type ? v.type->getBaseType() : FE::AST::Type_t::VOID;
+            w.writeVarint(static_cast<uint64_t>(base));
+            switch (base)
+            {
+                case FE::AST::Type_t::BOOL: w.writeByte(v.boolValue ? 1 : 0); break;
+                case FE::AST::Type_t::LL: w.writeSVarint(v.llValue); break;
+                case FE::AST::Type_t::FLOAT: w.writeFixed32(floatBits(v.floatValue)); break;
+                default: w.writeSVarint(v.intValue); break;
+            }
+        }
+    }
+
+    void IRBinaryWriter::visit(Module& module, ByteWriter& w)
+    {
+        w.writeVarint(module.funcDecls.size());
+        for (auto* fdecl : module.funcDecls) apply(*this, *fdecl, w);
+
+        w.writeVarint(module.globalVars.size());
+        for (auto* gdef : module.globalVars) apply(*this, *gdef, w);
+
+        w.writeVarint(module.functions.size());
+        for (auto* func : module.functions) apply(*this, *func, w);
+    }
+
+    void IRBinaryWriter::visit(Function& func, ByteWriter& w)
+    {
+        // 编号上界写在最前面，读取时据此检查各寄存器与标签编号
+        w.writeVarint(func.getMaxReg());
+        w.writeVarint(func.getMaxLabel());
+        w.writeVarint(func.loopStartLabel);
+        w.writeVarint(func.loopEndLabel);
+        apply(*this, *func.funcDef, w);
+
+        w.writeVarint(func.blocks.size());
+        for (auto& [id, block] : func.blocks) apply(*this, *block, w);
+    }
+
+    void IRBinaryWriter::visit(Block& block, ByteWriter& w)
+    {
+        w.writeVarint(block.blockId);
+        w.writeVarint(block.insts.size());
+        for (auto* inst : block.insts)
+        {
+            w.writeVarint(static_cast<uint64_t>(inst->opcode));
+            apply(*this, *inst, w);
+        }
+    }
+
+    void IRBinaryWriter::visit(LoadInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        writeOperand(w, inst.ptr);
+        writeOperand(w, inst.res);
+    }
+
+    void IRBinaryWriter::visit(StoreInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        writeOperand(w, inst.val);
+        writeOperand(w, inst.ptr);
+    }
+
+    void IRBinaryWriter::visit(ArithmeticInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        writeOperand(w, inst.lhs);
+        writeOperand(w, inst.rhs);
+        writeOperand(w, inst.res);
+    }
+
+    void IRBinaryWriter::visit(IcmpInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        w.writeVarint(static_cast<uint64_t>(inst.cond));
+        writeOperand(w, inst.lhs);
+        writeOperand(w, inst.rhs);
+        writeOperand(w, inst.res);
+    }
+
+    void IRBinaryWriter::visit(FcmpInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        w.writeVarint(static_cast<uint64_t>(inst.cond));
+        writeOperand(w, inst.lhs);
+        writeOperand(w, inst.rhs);
+        writeOperand(w, inst.res);
+    }
+
+    void IRBinaryWriter::visit(AllocaInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        writeOperand(w, inst.res);
+        writeDims(w, inst.dims);
+    }
+
+    void IRBinaryWriter::visit(BrCondInst& inst, ByteWriter& w)
+    {
+        writeOperand(w, inst.cond);
+        writeOperand(w, inst.trueTar);
+        writeOperand(w, inst.falseTar);
+    }
+
+    void IRBinaryWriter::visit(BrUncondInst& inst, ByteWriter& w) { writeOperand(w, inst.target); }
+
+    void IRBinaryWriter::visit(GlbVarDeclInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        w.writeVarint(intern(inst.name));
+        writeOperand(w, inst.init);
+        writeVarAttr(w, inst.initList);
+    }
+
+    void IRBinaryWriter::visit(CallInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.retType));
+        w.writeVarint(intern(inst.funcName));
+        w.writeVarint(inst.args.size());
+        for (auto& [dt, op] : inst.args)
+        {
+            w.writeVarint(static_cast<uint64_t>(dt));
+            writeOperand(w, op);
+        }
+        writeOperand(w, inst.res);
+    }
+
+    void IRBinaryWriter::visit(FuncDeclInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.retType));
+        w.writeVarint(intern(inst.funcName));
+        w.writeVarint(inst.argTypes.size());
+        for (auto dt : inst.argTypes) w.writeVarint(static_cast<uint64_t>(dt));
+        w.writeByte(inst.isVarArg ? 1 : 0);
+    }
+
+    void IRBinaryWriter::visit(FuncDefInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.retType));
+        w.writeVarint(intern(inst.funcName));
+        w.writeVarint(inst.argRegs.size());
+        for (auto& [dt, op] : inst.argRegs)
+        {
+            w.writeVarint(static_cast<uint64_t>(dt));
+            writeOperand(w, op);
+        }
+    }
+
+    void IRBinaryWriter::visit(RetInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.rt));
+        writeOperand(w, inst.res);
+    }
+
+    void IRBinaryWriter::visit(GEPInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        w.writeVarint(static_cast<uint64_t>(inst.idxType));
+        writeOperand(w, inst.basePtr);
+        writeOperand(w, inst.res);
+        writeDims(w, inst.dims);
+        w.writeVarint(inst.idxs.size());
+        for (auto* idx : inst.idxs) writeOperand(w, idx);
+    }
+
+    void IRBinaryWriter::visit(FP2SIInst& inst, ByteWriter& w)
+    {
+        writeOperand(w, inst.src);
+        writeOperand(w, inst.dest);
+    }
+
+    void IRBinaryWriter::visit(SI2FPInst& inst, ByteWriter& w)
+    {
+        writeOperand(w, inst.src);
+        writeOperand(w, inst.dest);
+    }
+
+    void IRBinaryWriter::visit(ZextInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.from));
+        w.writeVarint(static_cast<uint64_t>(inst.to));
+        writeOperand(w, inst.src);
+        writeOperand(w, inst.dest);
+    }
+
+    void IRBinaryWriter::visit(PhiInst& inst, ByteWriter& w)
+    {
+        w.writeVarint(static_cast<uint64_t>(inst.dt));
+        writeOperand(w, inst.res);
+        w.writeVarint(inst.incomingVals.size());
+        for (auto& [label, val] : inst.incomingVals)
+        {
+            writeOperand(w, label);
+            writeOperand(w, val);
+        }
+    }
+
+    /* ---------------------------------- 读取 ---------------------------------- */
+
+    bool IRBinaryReader::fail(const std::string& msg)
+    {
+        if (error.empty()) error = msg;
+        if (r) r->fail();
+        return false;
+    }
+
+    bool IRBinaryReader::read(std::istream& is, Module& module, std::string& err)
+    {
+        std::ostringstream ss;
+        ss << is.rdbuf();
+        const std::string data = ss.str();
+
+        ByteReader reader(data.data(), data.size());
+        r       = &reader;
+        curFunc = nullptr;
+        strings.clear();
+        error.clear();
+
+        char magic[sizeof(binaryMagic)];
+        if (!reader.readBytes(magic, sizeof(magic)) || std::memcmp(magic, binaryMagic, sizeof(magic)) != 0)
+            fail("not a binary IR file");
+        else if (uint64_t version = reader.readVarint(); reader.ok() && version != binaryVersion)
+            fail("unsupported binary IR version " + std::to_string(version));
+        else
+        {
+            size_t count = reader.readCount();
+            strings.reserve(count);
+            for (size_t i = 0; i < count && reader.ok(); ++i) strings.emplace_back(reader.readString());
+            if (readModule(module) && !reader.atEnd()) fail("trailing bytes after module");
+        }
+
+        if (!reader.ok() && error.empty()) error = "truncated or malformed binary IR";
+        r   = nullptr;
+        err = error;
+        return error.empty();
+    }
+
+    bool IRBinaryReader::readModule(Module& module)
+    {
+        size_t declCount = r->readCount();
+        for (size_t i = 0; i < declCount && r->ok(); ++i)
+        {
+            DataType              retType = readDataType();
+            const std::string*    name    = readStringRef();
+            size_t                argc    = r->readCount();
+            std::vector<DataType> argTypes;
+            for (size_t j = 0; j < argc && r->ok(); ++j) argTypes.push_back(readDataType());
+            bool isVarArg = r->readByte() != 0;
+            if (!r->ok()) return false;
+            module.funcDecls.push_back(new FuncDeclInst(retType, *name, argTypes, isVarArg));
+        }
+
+        size_t globalCount = r->readCount();
+        for (size_t i = 0; i < globalCount && r->ok(); ++i)
+        {
+            DataType           dt   = readDataType();
+            const std::string* name = readStringRef();
+            Operand*           init = readOperand();
+            FE::AST::VarAttr   attr;
+            if (!readVarAttr(attr) || !r->ok()) return false;
+            auto* gdef = new GlbVarDeclInst(dt, *name, attr);
+            gdef->init = init;
+            module.globalVars.push_back(gdef);
+        }
+
+        size_t funcCount = r->readCount();
+        for (size_t i = 0; i < funcCount && r->ok(); ++i)
+            if (!readFunction(module)) return false;
+        return r->ok();
+    }
+
+    bool IRBinaryReader::readFunction(Module& module)
+    {
+        // 先把函数挂到模块上，中途出错时由 Module 的析构函数统一释放
+        Function* func = new Function(nullptr);
+        module.functions.push_back(func);
+        curFunc = func;
+
+        func->setMaxReg(r->readVarint());
+        func->setMaxLabel(r->readVarint());
+        func->loopStartLabel = r->readVarint();
+        func->loopEndLabel   = r->readVarint();
+
+        DataType           retType = readDataType();
+        const std::string* name    = readStringRef();
+        size_t             argc    = r->readCount();
+        FuncDefInst::argList argRegs;
+        for (size_t i = 0; i < argc && r->ok(); ++i)
+        {
+            DataType dt = readDataType();
+            argRegs.emplace_back(dt, readReg());
+        }
+        if (!r->ok()) return false;
+        func->funcDef = new FuncDefInst(retType, *name, argRegs);
+
+        size_t blockCount = r->readCount();
+        for (size_t i = 0; i < blockCount && r->ok(); ++i)
+        {
+            uint64_t label = r->readVarint();
+            if (!r->ok()) break;
+            if (label >= func->getMaxLabel()) return fail("block label out of range in function " + *name);
+            if (func->getBlock(label)) return fail("duplicate block label in function " + *name);
+
+            Block* block     = func->createBlock(label);
+            size_t instCount = r->readCount();
+            for (size_t j = 0; j < instCount && r->ok(); ++j)
+                if (!readInstruction(block)) return false;
+        }
+
+        curFunc = nullptr;
+        return r->ok();
+    }
+
+    bool IRBinaryReader::readInstruction(Block* block)
+    {
+        Arena&       arena = curFunc->getArena();
+        Instruction* inst  = nullptr;
+        auto         op    = static_cast<Operator>(r->readVarint());
+        if (!r->ok()) return false;
+
+        // 各字段全部读取成功后才创建指令，失败时不会留下半成品
+        switch (op)
+        {
+            case Operator::LOAD:
+            {
+                DataType dt  = readDataType();
+                Operand* ptr = readPointer();
+                Operand* res = readReg();
+                if (r->ok()) inst = new (arena) LoadInst(dt, ptr, res);
+                break;
+            }
+            case Operator::STORE:
+            {
+                DataType dt  = readDataType();
+                Operand* val = readValue(dt);
+                Operand* ptr = readPointer();
+                if (r->ok()) inst = new (arena) StoreInst(dt, val, ptr);
+                break;
+            }
+            case Operator::ICMP:
+            {
+                DataType dt   = readDataType();
+                ICmpOp   cond = readICmpOp();
+                Operand* lhs  = readValue(dt);
+                Operand* rhs  = readValue(dt);
+                Operand* res  = readReg();
+                if (r->ok()) inst = new (arena) IcmpInst(dt, cond, lhs, rhs, res);
+                break;
+            }
+            case Operator::FCMP:
+            {
+                DataType dt   = readDataType();
+                FCmpOp   cond = readFCmpOp();
+                Operand* lhs  = readValue(dt);
+                Operand* rhs  = readValue(dt);
+                Operand* res  = readReg();
+                if (r->ok()) inst = new (arena) FcmpInst(dt, cond, lhs, rhs, res);
+                break;
+            }
+            case Operator::ALLOCA:
+            {
+                DataType         dt   = readDataType();
+                Operand*         res  = readReg();
+                std::vector<int> dims = readDims();
+                if (r->ok()) inst = new (arena) AllocaInst(dt, res, dims);
+                break;
+            }
+            case Operator::BR_COND:
+            {
+                Operand* cond = readValue(DataType::I1);
+                Operand* t    = readLabel();
+                Operand* f    = readLabel();
+                if (r->ok()) inst = new (arena) BrCondInst(cond, t, f);
+                break;
+            }
+            case Operator::BR_UNCOND:
+            {
+                Operand* target = readLabel();
+                if (r->ok()) inst = new (arena) BrUncondInst(target);
+                break;
+            }
+            case Operator::CALL:
+            {
+                DataType           retType = readDataType();
+                const std::string* name    = readStringRef();
+                size_t             argc    = r->readCount();
+                CallInst::argList  args;
+                for (size_t i = 0; i < argc && r->ok(); ++i)
+                {
+                    DataType dt = readDataType();
+                    args.emplace_back(dt, readValue(dt));
+                }
+                // 与文本格式一致：void 调用没有结果，其余调用的结果必须是寄存器
+                Operand* res = retType == DataType::VOID ? readOperand() : readReg();
+                if (r->ok() && retType == DataType::VOID && res) fail("void call to @" + *name + " has a result");
+                if (r->ok()) inst = new (arena) CallInst(retType, *name, args, res);
+                break;
+            }
+            case Operator::RET:
+            {
+                DataType rt  = readDataType();
+                Operand* res = rt == DataType::VOID ? readOperand() : readValue(rt);
+                if (r->ok() && rt == DataType::VOID && res) fail("ret void has a value");
+                if (r->ok()) inst = new (arena) RetInst(rt, res);
+                break;
+            }
+            case Operator::GETELEMENTPTR:
+            {
+                DataType              dt      = readDataType();
+                DataType              idxType = readDataType();
+                Operand*              basePtr = readPointer();
+                Operand*              res     = readReg();
+                std::vector<int>      dims    = readDims();
+                size_t                n       = r->readCount();
+                std::vector<Operand*> idxs;
+                for (size_t i = 0; i < n && r->ok(); ++i) idxs.push_back(readValue(idxType));
+                if (r->ok()) inst = new (arena) GEPInst(dt, idxType, basePtr, res, dims, idxs);
+                break;
+            }
+            case Operator::FPTOSI:
+            {
+                Operand* src  = readValue(DataType::F32);
+                Operand* dest = readReg();
+                if (r->ok()) inst = new (arena) FP2SIInst(src, dest);
+                break;
+            }
+            case Operator::SITOFP:
+            {
+                Operand* src  = readValue(DataType::I32);
+                Operand* dest = readReg();
+                if (r->ok()) inst = new (arena) SI2FPInst(src, dest);
+                break;
+            }
+            case Operator::ZEXT:
+            {
+                DataType from = readDataType();
+                DataType to   = readDataType();
+                Operand* src  = readValue(from);
+                Operand* dest = readReg();
+                if (r->ok()) inst = new (arena) ZextInst(from, to, src, dest);
+                break;
+            }
+            case Operator::PHI:
+            {
+                DataType dt  = readDataType();
+                Operand* res = readReg();
+                size_t   n   = r->readCount();
+                if (!r->ok()) break;
+                auto* phi = new (arena) PhiInst(dt, res);
+                for (size_t i = 0; i < n && r->ok(); ++i)
+                {
+                    Operand* label = readLabel();
+                    Operand* val   = readValue(dt);
+                    if (r->ok()) phi->incomingVals[label] = val;
+                }
+                inst = phi;
+                break;
+            }
+            default:
+            {
+                if (!isArithmeticOp(op))
+                    return fail("unknown opcode " + std::to_string(static_cast<int>(op)) + " in binary IR");
+                DataType dt  = readDataType();
+                if (r->ok() && isFloatArithmeticOp(op) != isFloatType(dt))
+                    return fail("arithmetic opcode does not match its type in binary IR");
+                Operand* lhs = readValue(dt);
+                Operand* rhs = readValue(dt);
+                Operand* res = readReg();
+                if (r->ok()) inst = new (arena) ArithmeticInst(op, dt, lhs, rhs, res);
+                break;
+            }
+        }
+
+        if (inst) block->insertBack(inst);
+        return r->ok();
+    }
+
+    const std::string* IRBinaryReader::readStringRef()
+    {
+        static const std::string empty;
+        uint64_t                 id = r->readVarint();
+        if (!r->ok()) return &empty;
+        if (id >= strings.size())
+        {
+            fail("string index out of range");
+            return &empty;
+        }
+        return &strings[id];
+    }
+
+    DataType IRBinaryReader::readDataType()
+    {
+        uint64_t v = r->readVarint();
+        if (r->ok() && v > static_cast<uint64_t>(DataType::DOUBLE)) fail("invalid data type in binary IR");
+        return static_cast<DataType>(v);
+    }
+
+    ICmpOp IRBinaryReader::readICmpOp()
+    {
+        uint64_t v = r->readVarint();
+        if (r->ok() && (v < static_cast<uint64_t>(ICmpOp::EQ) || v > static_cast<uint64_t>(ICmpOp::SLE)))
+            fail("invalid icmp condition in binary IR");
+        return static_cast<ICmpOp>(v);
+    }
+
+    FCmpOp IRBinaryReader::readFCmpOp()
+    {
+        uint64_t v = r->readVarint();
+        if (r->ok() && (v < static_cast<uint64_t>(FCmpOp::OEQ) || v > static_cast<uint64_t>(FCmpOp::UNO)))
+            fail("invalid fcmp condition in binary IR");
+        return static_cast<FCmpOp>(v);
+    }
+
+    Operand* IRBinaryReader::readOperand()
+    {
+        uint64_t v = r->readVarint();
+        if (!r->ok() || v == 0) return nullptr;
+
+        uint64_t payload = v >> operandTagBits;
+        switch (static_cast<OperandType>(v & operandTagMask))
+        {
+            // 寄存器与标签按编号建立稠密表，越界的编号说明数据已损坏，不能据此分配内存
+            case OperandType::REG:
+                if (curFunc && payload <= curFunc->getMaxReg()) return curFunc->getRegOperand(payload);
+                break;
+            case OperandType::LABEL:
+                if (curFunc && payload < curFunc->getMaxLabel()) return curFunc->getLabelOperand(payload);
+                break;
+            case OperandType::IMMEI32:
+            {
+                int value = static_cast<int>(ByteReader::unzigzag(payload));
+                return curFunc ? curFunc->getImmeI32Operand(value) : ::getImmeI32Operand(value);
+            }
+            case OperandType::IMMEF32:
+            {
+                float value = bitsToFloat(static_cast<uint32_t>(payload));
+                return curFunc ? curFunc->getImmeF32Operand(value) : ::getImmeF32Operand(value);
+            }
+            case OperandType::GLOBAL:
+                if (payload < strings.size()) return ::getGlobalOperand(strings[payload]);
+                break;
+            default: break;
+        }
+        fail("invalid operand in binary IR");
+        return nullptr;
+    }
+
+    Operand* IRBinaryReader::readLabel()
+    {
+        Operand* op = readOperand();
+        if (r->ok() && (!op || op->getType() != OperandType::LABEL)) fail("expected a label operand");
+        return op;
+    }
+
+    Operand* IRBinaryReader::readReg()
+    {
+        Operand* op = readOperand();
+        if (r->ok() && (!op || op->getType() != OperandType::REG)) fail("expected a register operand");
+        return op;
+    }
+
+    Operand* IRBinaryReader::readValue(DataType dt)
+    {
+        Operand* op = readOperand();
+        if (!r->ok()) return op;
+        if (!op || op->getType() == OperandType::LABEL)
+            fail("expected a value operand");
+        else if (op->getType() == OperandType::IMMEF32 && !isFloatType(dt))
+            fail("float constant used as " + std::string(toStringView(dt)));
+        else if (op->getType() == OperandType::IMMEI32 && isFloatType(dt))
+            fail("integer constant used as " + std::string(toStringView(dt)));
+        else if (op->getType() == OperandType::GLOBAL && dt != DataType::PTR)
+            fail("global address used as " + std::string(toStringView(dt)));
+        return op;
+    }
+
+    Operand* IRBinaryReader::readPointer()
+    {
+        Operand* op = readOperand();
+        if (r->ok() && (!op || (op->getType() != OperandType::REG && op->getType() != OperandType::GLOBAL)))
+            fail("expected a pointer operand");
+        return op;
+    }
+
+    std::vector<int> IRBinaryReader::readDims()
+    {
+        size_t           n = r->readCount();
+        std::vector<int> dims;
+        dims.reserve(n);
+        for (size_t i = 0; i < n && r->ok(); ++i) dims.push_back(static_cast<int>(r->readSVarint()));
+        return dims;
+    }
+
+    FE::AST::Type* IRBinaryReader::readType()
+    {
+        // 先数出指针层数，再从最内层的基本类型逐层套上指针
+        size_t   ptrDepth = 0;
+        uint64_t group    = r->readVarint();
+        for (; r->ok() && group == 1; group = r->readVarint()) ++ptrDepth;
+        if (!r->ok()) return nullptr;
+
+        FE::AST::Type* t = nullptr;
+        if (group == 0)
+        {
+            uint64_t base = r->readVarint();
+            if (base > FE::AST::maxTypeIdx)
+            {
+                fail("invalid type in global variable attributes");
+                return nullptr;
+            }
+            t = FE::AST::TypeFactory::getBasicType(static_cast<FE::AST::Type_t>(base));
+        }
+        else if (group != 2)
+        {
+            fail("invalid type in global variable attributes");
+            return nullptr;
+        }
+        for (size_t i = 0; i < ptrDepth; ++i) t = FE::AST::TypeFactory::getPtrType(t);
+        return t;
+    }
+
+    bool IRBinaryReader::readVarAttr(FE::AST::VarAttr& attr)
+    {
+        attr.type        = readType();
+        attr.isConstDecl = r->readByte() != 0;
+        attr.scopeLevel  = static_cast<int>(r->readSVarint());
+        attr.arrayDims   = readDims();
+
+        size_t n = r->readCount();
+        attr.initList.reserve(n);
+        size_t idx = 0;
+        for (size_t i = 0; i < n && r->ok(); ++i)
+        {
+            uint64_t delta = r->readVarint();
+            if (i != 0 && delta == 0) return fail("initializer indices are not increasing");
+            idx += delta;
+
+            FE::AST::VarValue v;
+            auto              base = static_cast<FE::AST::Type_t>(r->readVarint());
+            switch (base)
+            {
+                case FE::AST::Type_t::BOOL: v = FE::AST::VarValue(r->readByte() != 0); break;
+                case FE::AST::Type_t::INT: v = FE::AST::VarValue(static_cast<int>(r->readSVarint())); break;
+                case FE::AST::Type_t::LL: v = FE::AST::VarValue(static_cast<long long>(r->readSVarint())); break;
+                case FE::AST::Type_t::FLOAT: v = FE::AST::VarValue(bitsToFloat(r->readFixed32())); break;
+                default: v.intValue = static_cast<int>(r->readSVarint()); break;
+            }
+            attr.initList.set(idx, v);
+        }
+        return r->ok();
+    }
+}  // namespace ME
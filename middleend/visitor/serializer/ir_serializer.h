@@ -0,0 +1,110 @@
+#ifndef __MIDDLEEND_VISITOR_SERIALIZER_IR_SERIALIZER_H__
+#define __MIDDLEEND_VISITOR_SERIALIZER_IR_SERIALIZER_H__
+
+#include <middleend/ir_visitor.h>
+#include <middleend/module/ir_module.h>
+#include <byte_stream.h>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * ME::Module 的紧凑二进制格式，用于在 -O 之后保存 IR 快照，之后跳过前端直接交给后端：
+ *
+ *   文件   := "SYIR" 版本号 字符串表 模块
+ *   字符串表 := 个数 { 长度 字节... }      全局变量名、函数名与被调函数名只在这里出现一次，其余位置写下标
+ *   模块   := 函数声明表 全局变量表 函数表
+ *   函数   := maxReg maxLabel loopStartLabel loopEndLabel 函数定义 块个数 { 标签 指令个数 { 指令 } }
+ *   指令   := 操作码 各字段
+ *
+ * - 操作码、类型、个数等一律写为 varint；有符号数先做 zigzag
+ * - 操作数写为一个 varint：(负载 << 3) | OperandType，空操作数为 0。
+ *   负载为寄存器号/标签号、zigzag 后的 i32 立即数、f32 的比特模式或全局名的字符串下标
+ * - 全局数组初始值按稀疏列表写出：个数 { 与上一个下标之差 类型 值 }，未写出的元素为 0
+ * - 指令与块的注释只用于调试输出，不写入
+ * 读取时按原编号重建寄存器、标签与基本块，-llvm 打印结果与保存前一致；
+ * 寄存器号不超过 maxReg、标签号小于 maxLabel，否则视为数据损坏
+ */
+
+namespace ME
+{
+    using BinaryWriter_t = Visitor_t<void, ByteWriter&>;
+
+    class IRBinaryWriter : public BinaryWriter_t
+    {
+      private:
+        std::unordered_map<std::string, uint32_t> stringIds;
+        std::vector<std::string_view>             strings;  // 按下标排列，指向 stringIds 中的键
+
+      public:
+        void write(Module& module, std::ostream& os);
+
+        void visit(Module& module, ByteWriter& w) override;
+        void visit(Function& func, ByteWriter& w) override;
+        void visit(Block& block, ByteWriter& w) override;
+
+        void visit(LoadInst& inst, ByteWriter& w) override;
+        void visit(StoreInst& inst, ByteWriter& w) override;
+        void visit(ArithmeticInst& inst, ByteWriter& w) override;
+        void visit(IcmpInst& inst, ByteWriter& w) override;
+        void visit(FcmpInst& inst, ByteWriter& w) override;
+        void visit(AllocaInst& inst, ByteWriter& w) override;
+        void visit(BrCondInst& inst, ByteWriter& w) override;
+        void visit(BrUncondInst& inst, ByteWriter& w) override;
+        void visit(GlbVarDeclInst& inst, ByteWriter& w) override;
+        void visit(CallInst& inst, ByteWriter& w) override;
+        void visit(FuncDeclInst& inst, ByteWriter& w) override;
+        void visit(FuncDefInst& inst, ByteWriter& w) override;
+        void visit(RetInst& inst, ByteWriter& w) override;
+        void visit(GEPInst& inst, ByteWriter& w) override;
+        void visit(FP2SIInst& inst, ByteWriter& w) override;
+        void visit(SI2FPInst& inst, ByteWriter& w) override;
+        void visit(ZextInst& inst, ByteWriter& w) override;
+        void visit(PhiInst& inst, ByteWriter& w) override;
+
+      private:
+        uint32_t intern(const std::string& s);
+        void     writeOperand(ByteWriter& w, const Operand* op);
+        void     writeVarAttr(ByteWriter& w, const FE::AST::VarAttr& attr);
+    };
+
+    class IRBinaryReader
+    {
+      private:
+        ByteReader*              r;
+        std::vector<std::string> strings;
+        Function*                curFunc;  // 为空时读取的是模块级操作数（全局变量初始值）
+        std::string              error;
+
+      public:
+        IRBinaryReader() : r(nullptr), strings(), curFunc(nullptr), error() {}
+
+        // 读取整个二进制 IR 并追加到 module 中，数据损坏时返回 false 并在 err 中给出原因
+        bool read(std::istream& is, Module& module, std::string& err);
+
+      private:
+        bool fail(const std::string& msg);
+        bool readModule(Module& module);
+        bool readFunction(Module& module);
+        bool readInstruction(Block* block);
+
+        const std::string* readStringRef();
+        DataType           readDataType();
+        ICmpOp             readICmpOp();
+        FCmpOp             readFCmpOp();
+        Operand*           readOperand();
+        Operand*           readLabel();
+        // 结果槽位必须是寄存器；必需的值操作数不能为空或标签，立即数须与 dt 同为整数或浮点，全局变量只能作 ptr；
+        // 地址只能是寄存器或全局变量
+        Operand*           readReg();
+        Operand*           readValue(DataType dt);
+        Operand*           readPointer();
+        std::vector<int>   readDims();
+        FE::AST::Type*     readType();
+        bool               readVarAttr(FE::AST::VarAttr& attr);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_VISITOR_SERIALIZER_IR_SERIALIZER_H__
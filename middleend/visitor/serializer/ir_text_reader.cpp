@@ -0,0 +1,752 @@
+#include <middleend/visitor/serializer/ir_text_reader.h>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <istream>
+#include <sstream>
+#include <unordered_map>
+
+namespace ME
+{
+    namespace
+    {
+        // 寄存器与标签按编号建立稠密表，过大的编号说明输入有误，不能据此分配内存
+        constexpr size_t maxOperandNumber = size_t(1) << 24;
+
+        bool isWordChar(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '.';
+        }
+
+        float doubleBitsToFloat(uint64_t bits)
+        {
+            double d;
+            std::memcpy(&d, &bits, sizeof(d));
+            return static_cast<float>(d);
+        }
+
+        // IRPrinter 输出的各类名字到枚举值的反查表；br 有条件/无条件两种形式，单独处理
+        const std::unordered_map<std::string_view, DataType>& dataTypeNames()
+        {
+            static const std::unordered_map<std::string_view, DataType> names = {
+#define X(name, str, val) {#str, DataType::name},
+                IR_DATATYPE
+#undef X
+            };
+            return names;
+        }
+
+        const std::unordered_map<std::string_view, Operator>& opcodeNames()
+        {
+            static const std::unordered_map<std::string_view, Operator> names = [] {
+                std::unordered_map<std::string_view, Operator> m = {
+#define X(name, str, val) {#str, Operator::name},
+                    IR_OPCODE
+#undef X
+                };
+                m.erase("br");
+                return m;
+            }();
+            return names;
+        }
+
+        const std::unordered_map<std::string_view, ICmpOp>& icmpNames()
+        {
+            static const std::unordered_map<std::string_view, ICmpOp> names = {
+#define X(name, str, val) {#str, ICmpOp::name},
+                IR_ICMP
+#undef X
+            };
+            return names;
+        }
+
+        const std::unordered_map<std::string_view, FCmpOp>& fcmpNames()
+        {
+            static const std::unordered_map<std::string_view, FCmpOp> names = {
+#define X(name, str, val) {#str, FCmpOp::name},
+                IR_FCMP
+#undef X
+            };
+            return names;
+        }
+
+        bool isArithmeticOp(Operator op)
+        {
+            switch (op)
+            {
+                case Operator::ADD:
+                case Operator::SUB:
+                case Operator::MUL:
+                case Operator::DIV:
+                case Operator::MOD:
+                case Operator::FADD:
+                case Operator::FSUB:
+                case Operator::FMUL:
+                case Operator::FDIV:
+                case Operator::BITXOR:
+                case Operator::BITAND:
+                case Operator::SHL:
+                case Operator::ASHR:
+                case Operator::LSHR: return true;
+                default: return false;
+            }
+        }
+    }  // namespace
+
+    bool IRTextReader::fail(const std::string& msg)
+    {
+        if (error.empty()) error = "line " + std::to_string(lineNo) + ": " + msg;
+        line = {};
+        return false;
+    }
+
+    bool IRTextReader::read(std::istream& is, Module& module, std::string& err)
+    {
+        std::ostringstream ss;
+        ss << is.rdbuf();
+        const std::string text = ss.str();
+
+        lineNo   = 0;
+        curFunc  = nullptr;
+        curBlock = nullptr;
+        error.clear();
+
+        for (size_t pos = 0; pos < text.size() && ok();)
+        {
+            size_t eol = text.find('\n', pos);
+            if (eol == std::string::npos) eol = text.size();
+            line = std::string_view(text).substr(pos, eol - pos);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+            pos = eol + 1;
+            ++lineNo;
+
+            skipSpaces();
+            if (line.empty() || line[0] == ';') continue;
+
+            if (curFunc)
+            {
+                if (tryConsume("}"))
+                    finishFunction();
+                else if (tryConsume("{"))
+                {
+                    if (curBlock) fail("unexpected '{' inside a function body");
+                }
+                else if (line.substr(0, 5) == "Block")
+                    parseBlockLabel();
+                else if (!curBlock)
+                    fail("instruction outside of a basic block");
+                else
+                    parseInstruction(curBlock);
+            }
+            else if (line[0] == '@')
+                parseGlobal(module);
+            else
+            {
+                std::string_view kw = word();
+                if (kw == "declare")
+                    parseFuncDecl(module);
+                else if (kw == "define")
+                    parseFuncDef(module);
+                else
+                    fail("expected 'declare', 'define' or a global variable");
+            }
+
+            // 一行解析完后只允许剩下注释
+            skipSpaces();
+            if (ok() && !line.empty() && line[0] != ';') fail("unexpected text '" + std::string(line) + "'");
+        }
+
+        if (ok() && curFunc) fail("missing '}' at end of function " + curFunc->funcDef->funcName);
+        if (!ok())
+        {
+            // 未闭合的函数已挂在模块上，由 Module 析构统一释放
+            curFunc  = nullptr;
+            curBlock = nullptr;
+        }
+        err = error;
+        return ok();
+    }
+
+    /* ---------------------------------- 词法 ---------------------------------- */
+
+    void IRTextReader::skipSpaces()
+    {
+        size_t i = 0;
+        while (i < line.size() && (line[i] == ' ' || line[i] == '\t')) ++i;
+        line.remove_prefix(i);
+    }
+
+    bool IRTextReader::tryConsume(std::string_view tok)
+    {
+        skipSpaces();
+        if (line.substr(0, tok.size()) != tok) return false;
+        line.remove_prefix(tok.size());
+        return true;
+    }
+
+    void IRTextReader::expect(std::string_view tok)
+    {
+        if (!ok()) return;
+        if (!tryConsume(tok)) fail("expected '" + std::string(tok) + "'");
+    }
+
+    std::string_view IRTextReader::word()
+    {
+        skipSpaces();
+        size_t i = 0;
+        while (i < line.size() && isWordChar(line[i])) ++i;
+        std::string_view w = line.substr(0, i);
+        line.remove_prefix(i);
+        return w;
+    }
+
+    long long IRTextReader::integer()
+    {
+        if (!ok()) return 0;
+        skipSpaces();
+        long long v   = 0;
+        auto      res = std::from_chars(line.data(), line.data() + line.size(), v);
+        if (res.ec != std::errc())
+        {
+            fail("expected an integer");
+            return 0;
+        }
+        line.remove_prefix(static_cast<size_t>(res.ptr - line.data()));
+        return v;
+    }
+
+    DataType IRTextReader::dataType()
+    {
+        if (!ok()) return DataType::UNK;
+        std::string_view w  = word();
+        auto&            m  = dataTypeNames();
+        auto             it = m.find(w);
+        if (it == m.end())
+        {
+            fail("unknown type '" + std::string(w) + "'");
+            return DataType::UNK;
+        }
+        return it->second;
+    }
+
+    void IRTextReader::arrayType(std::vector<int>& dims, DataType& dt)
+    {
+        dims.clear();
+        while (ok() && tryConsume("["))
+        {
+            dims.push_back(static_cast<int>(integer()));
+            expect("x");
+        }
+        dt = dataType();
+        for (size_t i = 0; i < dims.size(); ++i) expect("]");
+    }
+
+    size_t IRTextReader::number(std::string_view prefix)
+    {
+        line.remove_prefix(prefix.size());
+        size_t v   = 0;
+        auto   res = std::from_chars(line.data(), line.data() + line.size(), v);
+        if (res.ec != std::errc() || v >= maxOperandNumber)
+        {
+            fail("invalid number after '" + std::string(prefix) + "'");
+            return 0;
+        }
+        line.remove_prefix(static_cast<size_t>(res.ptr - line.data()));
+        return v;
+    }
+
+    Operand* IRTextReader::operand()
+    {
+        if (!ok()) return nullptr;
+        skipSpaces();
+
+        if (line.substr(0, 5) == "%reg_" || line.substr(0, 6) == "%Block")
+        {
+            if (!curFunc)
+            {
+                fail("register or label used outside of a function");
+                return nullptr;
+            }
+            if (line[1] == 'r')
+            {
+                size_t id = number("%reg_");
+                maxReg    = std::max(maxReg, id);
+                return ok() ? curFunc->getRegOperand(id) : nullptr;
+            }
+            size_t id = number("%Block");
+            labelEnd  = std::max(labelEnd, id + 1);
+            return ok() ? curFunc->getLabelOperand(id) : nullptr;
+        }
+        if (line.substr(0, 1) == "@")
+        {
+            line.remove_prefix(1);
+            std::string_view name = word();
+            if (name.empty())
+            {
+                fail("expected a global name after '@'");
+                return nullptr;
+            }
+            return ::getGlobalOperand(std::string(name));
+        }
+        if (line.substr(0, 2) == "0x")
+        {
+            // 浮点立即数：double 的比特模式
+            uint64_t bits = 0;
+            auto     res  = std::from_chars(line.data() + 2, line.data() + line.size(), bits, 16);
+            if (res.ec != std::errc())
+            {
+                fail("invalid floating point constant");
+                return nullptr;
+            }
+            line.remove_prefix(static_cast<size_t>(res.ptr - line.data()));
+            float value = doubleBitsToFloat(bits);
+            return curFunc ? curFunc->getImmeF32Operand(value) : ::getImmeF32Operand(value);
+        }
+
+        int value = static_cast<int>(integer());
+        if (!ok()) return nullptr;
+        return curFunc ? curFunc->getImmeI32Operand(value) : ::getImmeI32Operand(value);
+    }
+
+    Operand* IRTextReader::label()
+    {
+        Operand* op = operand();
+        if (ok() && (!op || op->getType() != OperandType::LABEL)) fail("expected a label");
+        return op;
+    }
+
+    Operand* IRTextReader::reg()
+    {
+        Operand* op = operand();
+        if (ok() && (!op || op->getType() != OperandType::REG)) fail("expected a register");
+        return op;
+    }
+
+    /* ---------------------------------- 模块级 ---------------------------------- */
+
+    void IRTextReader::parseFuncDecl(Module& module)
+    {
+        // declare i32 @foo(i32, ptr, ...)
+        DataType retType = dataType();
+        expect("@");
+        std::string_view      name = word();
+        std::vector<DataType> argTypes;
+        bool                  isVarArg = false;
+        expect("(");
+        if (ok() && !tryConsume(")"))
+        {
+            while (ok())
+            {
+                if (tryConsume("..."))
+                    isVarArg = true;
+                else
+                    argTypes.push_back(dataType());
+                if (tryConsume(",")) continue;
+                expect(")");
+                break;
+            }
+        }
+        if (ok()) module.funcDecls.push_back(new FuncDeclInst(retType, std::string(name), argTypes, isVarArg));
+    }
+
+    void IRTextReader::parseGlobal(Module& module)
+    {
+        // @a = global i32 5 / @a = global float zeroinitializer / @arr = global [2 x i32] [i32 1, i32 2]
+        // 一维数组中的长段 0：@arr = global <{ [1 x i32], [99 x i32] }>
+        //                       <{ [1 x i32] [i32 1], [99 x i32] zeroinitializer }>
+        expect("@");
+        std::string name(word());
+        expect("=");
+        expect("global");
+        if (!ok()) return;
+
+        skipSpaces();
+        if (line.substr(0, 1) != "[" && line.substr(0, 2) != "<{")
+        {
+            DataType dt   = dataType();
+            Operand* init = nullptr;
+            if (!tryConsume("zeroinitializer")) init = operand();
+            if (ok()) module.globalVars.push_back(new GlbVarDeclInst(dt, name, init));
+            return;
+        }
+
+        std::vector<int> dims;
+        DataType         dt  = DataType::UNK;
+        size_t           pos = 0;
+        FE::AST::VarAttr attr;
+        if (tryConsume("<{"))
+        {
+            // 类型部分只是各段长度，跳过；数组长度由值部分各段累加得到
+            while (ok() && !tryConsume("}>"))
+            {
+                arrayType(dims, dt);
+                tryConsume(",");
+            }
+            expect("<{");
+            while (ok() && !tryConsume("}>"))
+            {
+                parseInitElement(attr, pos);
+                tryConsume(",");
+            }
+            dims = {static_cast<int>(pos)};
+        }
+        else
+        {
+            arrayType(dims, dt);
+            if (!tryConsume("zeroinitializer")) parseInitList(attr, pos);
+        }
+        attr.type      = dt == DataType::F32 ? FE::AST::floatType : FE::AST::intType;
+        attr.arrayDims = dims;
+        if (ok()) module.globalVars.push_back(new GlbVarDeclInst(dt, name, attr));
+    }
+
+    void IRTextReader::parseInitList(FE::AST::VarAttr& attr, size_t& pos)
+    {
+        expect("[");
+        if (!ok() || tryConsume("]")) return;
+        while (ok())
+        {
+            parseInitElement(attr, pos);
+            if (tryConsume(",")) continue;
+            expect("]");
+            break;
+        }
+    }
+
+    void IRTextReader::parseInitElement(FE::AST::VarAttr& attr, size_t& pos)
+    {
+        skipSpaces();
+        if (line.substr(0, 1) == "[")
+        {
+            std::vector<int> dims;
+            DataType         dt = DataType::UNK;
+            arrayType(dims, dt);
+            if (!tryConsume("zeroinitializer"))
+            {
+                parseInitList(attr, pos);
+                return;
+            }
+            size_t n = 1;
+            for (int d : dims) n *= static_cast<size_t>(d);
+            pos += n;
+            return;
+        }
+
+        DataType dt = dataType();
+        if (!ok()) return;
+        FE::AST::VarValue v;
+        if (dt == DataType::F32)
+        {
+            skipSpaces();
+            uint64_t bits = 0;
+            auto     res  = line.substr(0, 2) == "0x"
+                                ? std::from_chars(line.data() + 2, line.data() + line.size(), bits, 16)
+                                : std::from_chars_result{line.data(), std::errc::invalid_argument};
+            if (res.ec != std::errc())
+            {
+                fail("invalid floating point constant");
+                return;
+            }
+            line.remove_prefix(static_cast<size_t>(res.ptr - line.data()));
+            v = FE::AST::VarValue(doubleBitsToFloat(bits));
+        }
+        else
+            v = FE::AST::VarValue(static_cast<int>(integer()));
+        if (!FE::AST::SparseInitList::isZero(v)) attr.initList.set(pos, v);
+        ++pos;
+    }
+
+    /* ---------------------------------- 函数 ---------------------------------- */
+
+    void IRTextReader::parseFuncDef(Module& module)
+    {
+        // define i32 @foo(i32 %reg_0, ptr %reg_1)，函数体从 '{' 开始
+        DataType retType = dataType();
+        expect("@");
+        std::string name(word());
+        expect("(");
+        if (!ok()) return;
+
+        curFunc = new Function(nullptr);
+        module.functions.push_back(curFunc);
+        curBlock = nullptr;
+        maxReg   = 0;
+        labelEnd = 0;
+
+        FuncDefInst::argList argRegs;
+        if (!tryConsume(")"))
+        {
+            while (ok())
+            {
+                DataType dt = dataType();
+                argRegs.emplace_back(dt, reg());
+                if (tryConsume(",")) continue;
+                expect(")");
+                break;
+            }
+        }
+        curFunc->funcDef = new FuncDefInst(retType, name, argRegs);
+        // 手写的 IR 常把 '{' 与 define 写在同一行
+        tryConsume("{");
+    }
+
+    void IRTextReader::parseBlockLabel()
+    {
+        // Block3: 或 Block3: ; 注释
+        line.remove_prefix(5);
+        size_t id   = 0;
+        auto   res  = std::from_chars(line.data(), line.data() + line.size(), id);
+        if (res.ec != std::errc() || id >= maxOperandNumber)
+        {
+            fail("invalid block label");
+            return;
+        }
+        line.remove_prefix(static_cast<size_t>(res.ptr - line.data()));
+        expect(":");
+        if (!ok()) return;
+        if (curFunc->getBlock(id))
+        {
+            fail("duplicate block label Block" + std::to_string(id));
+            return;
+        }
+
+        curBlock = curFunc->createBlock(id);
+        labelEnd = std::max(labelEnd, id + 1);
+        if (tryConsume(";"))
+        {
+            skipSpaces();
+            curBlock->setComment(std::string(line));
+            line = {};
+        }
+    }
+
+    void IRTextReader::finishFunction()
+    {
+        curFunc->setMaxReg(maxReg);
+        curFunc->setMaxLabel(labelEnd);
+        curFunc  = nullptr;
+        curBlock = nullptr;
+    }
+
+    void IRTextReader::parseInstruction(Block* block)
+    {
+        Operand* res = nullptr;
+        skipSpaces();
+        if (line.substr(0, 1) == "%")
+        {
+            res = reg();
+            expect("=");
+        }
+        std::string_view name = word();
+        if (!ok()) return;
+
+        Arena&       arena = curFunc->getArena();
+        Instruction* inst  = nullptr;
+
+        if (name == "br")
+        {
+            if (res)
+            {
+                fail("instruction 'br' does not define a value");
+                return;
+            }
+            if (tryConsume("label"))
+            {
+                Operand* target = label();
+                if (ok()) inst = new (arena) BrUncondInst(target);
+            }
+            else
+            {
+                dataType();
+                Operand* cond = operand();
+                expect(",");
+                expect("label");
+                Operand* t = label();
+                expect(",");
+                expect("label");
+                Operand* f = label();
+                if (ok()) inst = new (arena) BrCondInst(cond, t, f);
+            }
+            if (inst) block->insertBack(inst);
+            return;
+        }
+
+        auto it = opcodeNames().find(name);
+        if (it == opcodeNames().end())
+        {
+            fail("unknown instruction '" + std::string(name) + "'");
+            return;
+        }
+
+        // 除 store/ret/call 外的指令都定义一个值，必须带结果寄存器；call 只有返回 void 时不带
+        Operator op         = it->second;
+        bool     definesVal = op != Operator::STORE && op != Operator::RET && op != Operator::CALL;
+        if (definesVal != (res != nullptr) && op != Operator::CALL)
+        {
+            fail(definesVal ? "missing result register for '" + std::string(name) + "'"
+                            : "instruction '" + std::string(name) + "' does not define a value");
+            return;
+        }
+
+        // 各字段全部解析成功后才创建指令
+        switch (op)
+        {
+            case Operator::LOAD:
+            {
+                DataType dt = dataType();
+                expect(",");
+                expect("ptr");
+                Operand* ptr = operand();
+                if (ok()) inst = new (arena) LoadInst(dt, ptr, res);
+                break;
+            }
+            case Operator::STORE:
+            {
+                DataType dt  = dataType();
+                Operand* val = operand();
+                expect(",");
+                expect("ptr");
+                Operand* ptr = operand();
+                if (ok()) inst = new (arena) StoreInst(dt, val, ptr);
+                break;
+            }
+            case Operator::ICMP:
+            case Operator::FCMP:
+            {
+                std::string_view condName = word();
+                DataType         dt       = dataType();
+                Operand*         lhs      = operand();
+                expect(",");
+                Operand* rhs = operand();
+                if (!ok()) break;
+                if (op == Operator::ICMP)
+                {
+                    auto c = icmpNames().find(condName);
+                    if (c == icmpNames().end())
+                        fail("unknown icmp condition '" + std::string(condName) + "'");
+                    else
+                        inst = new (arena) IcmpInst(dt, c->second, lhs, rhs, res);
+                }
+                else
+                {
+                    auto c = fcmpNames().find(condName);
+                    if (c == fcmpNames().end())
+                        fail("unknown fcmp condition '" + std::string(condName) + "'");
+                    else
+                        inst = new (arena) FcmpInst(dt, c->second, lhs, rhs, res);
+                }
+                break;
+            }
+            case Operator::ALLOCA:
+            {
+                std::vector<int> dims;
+                DataType         dt = DataType::UNK;
+                arrayType(dims, dt);
+                if (ok()) inst = new (arena) AllocaInst(dt, res, dims);
+                break;
+            }
+            case Operator::CALL:
+            {
+                DataType retType = dataType();
+                expect("@");
+                std::string_view fn = word();
+                expect("(");
+                CallInst::argList args;
+                if (ok() && !tryConsume(")"))
+                {
+                    while (ok())
+                    {
+                        DataType dt = dataType();
+                        args.emplace_back(dt, operand());
+                        if (tryConsume(",")) continue;
+                        expect(")");
+                        break;
+                    }
+                }
+                if (ok() && (retType == DataType::VOID) != (res == nullptr))
+                    fail("result register does not match the return type of call to @" + std::string(fn));
+                if (ok()) inst = new (arena) CallInst(retType, std::string(fn), args, res);
+                break;
+            }
+            case Operator::RET:
+            {
+                DataType rt  = dataType();
+                Operand* val = nullptr;
+                skipSpaces();
+                if (ok() && !line.empty() && line[0] != ';') val = operand();
+                if (ok()) inst = new (arena) RetInst(rt, val);
+                break;
+            }
+            case Operator::GETELEMENTPTR:
+            {
+                std::vector<int> dims;
+                DataType         dt = DataType::UNK;
+                arrayType(dims, dt);
+                expect(",");
+                expect("ptr");
+                Operand*              basePtr = operand();
+                DataType              idxType = DataType::I32;
+                std::vector<Operand*> idxs;
+                while (ok() && tryConsume(","))
+                {
+                    idxType = dataType();
+                    idxs.push_back(operand());
+                }
+                if (ok()) inst = new (arena) GEPInst(dt, idxType, basePtr, res, dims, idxs);
+                break;
+            }
+            case Operator::SITOFP:
+            case Operator::FPTOSI:
+            case Operator::ZEXT:
+            {
+                DataType from = dataType();
+                Operand* src  = operand();
+                expect("to");
+                DataType to = dataType();
+                if (!ok()) break;
+                if (op == Operator::SITOFP)
+                    inst = new (arena) SI2FPInst(src, res);
+                else if (op == Operator::FPTOSI)
+                    inst = new (arena) FP2SIInst(src, res);
+                else
+                    inst = new (arena) ZextInst(from, to, src, res);
+                break;
+            }
+            case Operator::PHI:
+            {
+                DataType                             dt = dataType();
+                std::vector<std::pair<Operand*, Operand*>> incoming;
+                while (ok() && tryConsume("["))
+                {
+                    Operand* val = operand();
+                    expect(",");
+                    Operand* lb = label();
+                    expect("]");
+                    incoming.emplace_back(lb, val);
+                    if (!tryConsume(",")) break;
+                }
+                if (!ok()) break;
+                auto* phi = new (arena) PhiInst(dt, res);
+                for (auto& [lb, val] : incoming) phi->incomingVals[lb] = val;
+                inst = phi;
+                break;
+            }
+            default:
+            {
+                if (!isArithmeticOp(op))
+                {
+                    fail("unsupported instruction '" + std::string(name) + "'");
+                    break;
+                }
+                DataType dt  = dataType();
+                Operand* lhs = operand();
+                expect(",");
+                Operand* rhs = operand();
+                if (ok()) inst = new (arena) ArithmeticInst(op, dt, lhs, rhs, res);
+                break;
+            }
+        }
+
+        if (inst) block->insertBack(inst);
+    }
+}  // namespace ME
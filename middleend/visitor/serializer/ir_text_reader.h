@@ -0,0 +1,74 @@
+#ifndef __MIDDLEEND_VISITOR_SERIALIZER_IR_TEXT_READER_H__
+#define __MIDDLEEND_VISITOR_SERIALIZER_IR_TEXT_READER_H__
+
+#include <middleend/module/ir_module.h>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * 文本 IR 读取器：解析 IRPrinter（-llvm）输出的 IR，重建 ME::Module，
+ * 使 Pass 与后端可以直接以保存下来的 .ll 文件为输入，不必每次从 SysY 源码重新生成
+ *
+ * - 只接受 IRPrinter 的方言：寄存器写作 %reg_N，基本块写作 BlockN: 并以 %BlockN 引用，
+ *   浮点立即数写作 double 比特模式的十六进制（0x...）
+ * - 寄存器、标签按原编号重建；maxReg / maxLabel 取文件中出现过的最大编号，
+ *   之后新建的寄存器与基本块不会和已有编号冲突
+ * - 全局数组的初始化列表按行优先展开回 VarAttr 的稀疏列表，只记录非零元素；
+ *   zeroinitializer 的子数组与一维数组的 packed struct 分段形式直接跳过对应的元素个数
+ * - 按行解析，遇到第一个错误即停止，错误信息带有行号
+ */
+
+namespace ME
+{
+    class IRTextReader
+    {
+      private:
+        std::string_view line;  // 当前行剩余未解析的部分
+        size_t           lineNo;
+        Function*        curFunc;  // 为空时处于函数体之外
+        Block*           curBlock;
+        size_t           maxReg;    // 当前函数中出现过的最大寄存器编号
+        size_t           labelEnd;  // 当前函数中出现过的最大标签编号 + 1
+        std::string      error;
+
+      public:
+        IRTextReader()
+            : line(), lineNo(0), curFunc(nullptr), curBlock(nullptr), maxReg(0), labelEnd(0), error()
+        {}
+
+        // 读取整个文本 IR 并追加到 module 中，出错时返回 false 并在 err 中给出原因
+        bool read(std::istream& is, Module& module, std::string& err);
+
+      private:
+        bool fail(const std::string& msg);
+        bool ok() const { return error.empty(); }
+
+        void parseFuncDecl(Module& module);
+        void parseGlobal(Module& module);
+        void parseFuncDef(Module& module);
+        void parseBlockLabel();
+        void parseInstruction(Block* block);
+        void finishFunction();
+
+        // 词法：每个函数先跳过空白，失败时返回默认值
+        void             skipSpaces();
+        bool             tryConsume(std::string_view tok);
+        void             expect(std::string_view tok);
+        std::string_view word();  // 连续的字母、数字、'_'、'.'
+        long long        integer();
+        DataType         dataType();
+        void             arrayType(std::vector<int>& dims, DataType& dt);  // [N x [M x T]] 或单独的 T
+        size_t           number(std::string_view prefix);  // prefix 后紧跟的寄存器/标签编号
+        Operand*         operand();
+        Operand*         label();
+        Operand*         reg();
+        // 全局数组初始化列表：[ 元素, 元素 ]，元素为 "T v"、嵌套的 "[N x T] [ ... ]" 或 "[N x T] zeroinitializer"，
+        // 按行优先展开，pos 为下一个元素的下标
+        void parseInitList(FE::AST::VarAttr& attr, size_t& pos);
+        void parseInitElement(FE::AST::VarAttr& attr, size_t& pos);
+    };
+}  // namespace ME
+
+#endif  // __MIDDLEEND_VISITOR_SERIALIZER_IR_TEXT_READER_H__
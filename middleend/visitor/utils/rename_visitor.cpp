@@ -3,14 +3,14 @@
 
 namespace ME
 {
-    void renameReg(Operand*& operand, RegMap& renameMap)
+    void RegRename::renameReg(Operand*& operand, RegMap& renameMap)
     {
         if (!operand || operand->getType() != OperandType::REG) return;
 
         RegOperand* regOp = static_cast<RegOperand*>(operand);
         auto        it    = renameMap.find(regOp->regNum);
         if (it == renameMap.end()) return;
-        operand = getRegOperand(it->second);
+        operand = ops.getRegOperand(it->second);
     }
 
     void RegRename::visit(LoadInst& inst, RegMap& rm)
@@ -105,7 +105,7 @@ namespace ME
     void RegRename::visit(PhiInst& inst, RegMap& rm)
     {
         renameReg(inst.res, rm);
-        std::map<Operand*, Operand*> newIncomingVals;
+        PhiInst::IncomingMap newIncomingVals;
         for (auto& [label, val] : inst.incomingVals)
         {
             Operand* newVal = val;
@@ -11,8 +11,13 @@ namespace ME
 
     class RegRename : public RegRename_t
     {
+      private:
+        OperandTable& ops;  //被改写指令所在函数的操作数表
+
+        void renameReg(Operand*& operand, RegMap& renameMap);
+
       public:
-        RegRename() = default;
+        explicit RegRename(OperandTable& ops) : ops(ops) {}
 
         void visit(LoadInst&, RegMap&) override;
         void visit(StoreInst&, RegMap&) override;
@@ -0,0 +1,76 @@
+#include <arena.h>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+Arena::Arena(size_t chunkSize)
+    : chunks(), cur(nullptr), end(nullptr), chunkSize(roundUp(chunkSize)), bytesUsed(0), freeLists()
+{}
+
+Arena::~Arena() { release(); }
+
+char* Arena::newChunk(size_t size)
+{
+    char* chunk = static_cast<char*>(std::aligned_alloc(alignment, size));
+    if (!chunk) throw std::bad_alloc();
+    chunks.push_back(chunk);
+    return chunk;
+}
+
+void* Arena::allocate(size_t size)
+{
+    size = roundUp(size == 0 ? 1 : size);
+
+    // 优先复用空闲链表中大小相同的内存
+    size_t bucket = size / alignment;
+    if (bucket < freeLists.size() && freeLists[bucket])
+    {
+        FreeNode* node    = freeLists[bucket];
+        freeLists[bucket] = node->next;
+        return node;
+    }
+
+    bytesUsed += size;
+
+    // 大对象单独占一个块，不打断当前块的线性分配
+    if (size > chunkSize / 4) return newChunk(size);
+
+    if (static_cast<size_t>(end - cur) < size)
+    {
+        cur = newChunk(chunkSize);
+        end = cur + chunkSize;
+    }
+
+    void* p = cur;
+    cur += size;
+    return p;
+}
+
+void Arena::deallocate(void* p, size_t size)
+{
+    if (!p) return;
+    size          = roundUp(size == 0 ? 1 : size);
+    size_t bucket = size / alignment;
+    if (bucket >= freeLists.size()) freeLists.resize(bucket + 1, nullptr);
+
+    FreeNode* node    = static_cast<FreeNode*>(p);
+    node->next        = freeLists[bucket];
+    freeLists[bucket] = node;
+}
+
+void Arena::release()
+{
+    for (char* chunk : chunks) std::free(chunk);
+    chunks.clear();
+    freeLists.clear();
+    cur       = nullptr;
+    end       = nullptr;
+    bytesUsed = 0;
+}
+
+const char* Arena::copyString(const std::string& s)
+{
+    char* p = static_cast<char*>(allocate(s.size() + 1));
+    std::memcpy(p, s.c_str(), s.size() + 1);
+    return p;
+}
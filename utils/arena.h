@@ -0,0 +1,102 @@
+#ifndef __UTILS_ARENA_H__
+#define __UTILS_ARENA_H__
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/*
+ * bump-pointer 内存池：
+ * - 按块(chunk)向系统申请内存，分配时只移动指针，不为单个对象调用 malloc/free
+ * - deallocate() 把内存挂到按大小分桶的空闲链表上，之后相同大小的分配优先复用
+ * - release()/析构时一次性归还全部块；对象的析构函数由使用者负责调用
+ */
+class Arena
+{
+  public:
+    static constexpr size_t alignment        = alignof(std::max_align_t);
+    static constexpr size_t defaultChunkSize = 16 * 1024;
+
+  private:
+    struct FreeNode
+    {
+        FreeNode* next;
+    };
+
+    std::vector<char*>     chunks;
+    char*                  cur;
+    char*                  end;
+    size_t                 chunkSize;
+    size_t                 bytesUsed;
+    std::vector<FreeNode*> freeLists;  // 下标为 roundUp(size) / alignment
+
+  public:
+    explicit Arena(size_t chunkSize = defaultChunkSize);
+    ~Arena();
+
+    Arena(const Arena&)            = delete;
+    Arena& operator=(const Arena&) = delete;
+
+  public:
+    void* allocate(size_t size);
+    // 归还一块由 allocate(size) 得到的内存，size 必须与分配时一致
+    void deallocate(void* p, size_t size);
+    // 一次性释放所有块，之前分配的指针全部失效
+    void release();
+
+    // 把字符串复制进内存池，返回以 '\0' 结尾的副本
+    const char* copyString(const std::string& s);
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        return new (allocate(sizeof(T))) T(std::forward<Args>(args)...);
+    }
+
+    size_t getBytesUsed() const { return bytesUsed; }
+    size_t getChunkCount() const { return chunks.size(); }
+    size_t getChunkSize() const { return chunkSize; }
+
+  private:
+    static size_t roundUp(size_t size) { return (size + alignment - 1) & ~(alignment - 1); }
+    char*         newChunk(size_t size);
+};
+
+/*
+ * 从 Arena 分配元素存储的 STL 分配器，用于与对象同寿命的容器（如 AST 的子节点列表）：
+ * 容器随 Arena 整体释放，不需要也不应单独析构
+ * - 扩容时旧存储交还 Arena 复用；超过块大小 1/4 的大块单独成块，不进入空闲链表，随 release() 释放
+ */
+template <typename T>
+class ArenaAllocator
+{
+  public:
+    using value_type = T;
+
+    Arena* arena;
+
+    explicit ArenaAllocator(Arena& a) noexcept : arena(&a) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena)
+    {}
+
+    T* allocate(size_t n) { return static_cast<T*>(arena->allocate(n * sizeof(T))); }
+    void deallocate(T* p, size_t n)
+    {
+        if (n * sizeof(T) <= arena->getChunkSize() / 4) arena->deallocate(p, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept
+    {
+        return arena == other.arena;
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept
+    {
+        return arena != other.arena;
+    }
+};
+
+#endif  // __UTILS_ARENA_H__
@@ -0,0 +1,83 @@
+#include <byte_stream.h>
+#include <cstring>
+
+void ByteWriter::writeBytes(const void* data, size_t n)
+{
+    if (n == 0) return;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    buf.insert(buf.end(), p, p + n);
+}
+
+uint8_t ByteReader::readByte()
+{
+    if (!good || cur == end)
+    {
+        good = false;
+        return 0;
+    }
+    return *cur++;
+}
+
+uint64_t ByteReader::readVarint()
+{
+    uint64_t v = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if (!good || cur == end) break;
+        uint8_t b = *cur++;
+        v |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80)) return v;
+    }
+    // 数据提前结束，或超过 10 字节仍未结束
+    good = false;
+    return 0;
+}
+
+uint32_t ByteReader::readFixed32()
+{
+    if (!good || remaining() < 4)
+    {
+        good = false;
+        return 0;
+    }
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) v |= static_cast<uint32_t>(cur[i]) << (8 * i);
+    cur += 4;
+    return v;
+}
+
+bool ByteReader::readBytes(void* out, size_t n)
+{
+    if (!good || remaining() < n)
+    {
+        good = false;
+        return false;
+    }
+    if (n) std::memcpy(out, cur, n);
+    cur += n;
+    return true;
+}
+
+std::string_view ByteReader::readString()
+{
+    uint64_t n = readVarint();
+    if (!good || remaining() < n)
+    {
+        good = false;
+        return {};
+    }
+    std::string_view s(reinterpret_cast<const char*>(cur), static_cast<size_t>(n));
+    cur += n;
+    return s;
+}
+
+size_t ByteReader::readCount()
+{
+    uint64_t n = readVarint();
+    if (!good || n > remaining())
+    {
+        good = false;
+        return 0;
+    }
+    return static_cast<size_t>(n);
+}
@@ -0,0 +1,91 @@
+#ifndef __UTILS_BYTE_STREAM_H__
+#define __UTILS_BYTE_STREAM_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/*
+ * 紧凑二进制编码的读写工具：
+ * - 无符号整数用 LEB128 变长编码（varint），小于 128 的值只占 1 字节
+ * - 有符号整数先做 zigzag 映射，让绝对值小的负数也只占很少的字节
+ * - 字符串写为 varint 长度 + 原始字节
+ * ByteReader 读到数据末尾或遇到非法编码时不会越界，而是置 ok() 为 false 并返回 0，
+ * 调用方可以连续读取若干字段后再统一检查
+ */
+class ByteWriter
+{
+  private:
+    std::vector<uint8_t> buf;
+
+  public:
+    ByteWriter() : buf() {}
+
+    void writeByte(uint8_t b) { buf.push_back(b); }
+    void writeVarint(uint64_t v)
+    {
+        while (v >= 0x80)
+        {
+            buf.push_back(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        buf.push_back(static_cast<uint8_t>(v));
+    }
+    void writeSVarint(int64_t v) { writeVarint(zigzag(v)); }
+    void writeFixed32(uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i) buf.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+    void writeBytes(const void* data, size_t n);
+    void writeString(std::string_view s)
+    {
+        writeVarint(s.size());
+        writeBytes(s.data(), s.size());
+    }
+    void append(const ByteWriter& other) { writeBytes(other.buf.data(), other.buf.size()); }
+
+    const std::vector<uint8_t>& data() const { return buf; }
+    size_t                      size() const { return buf.size(); }
+    void                        clear() { buf.clear(); }
+
+    static uint64_t zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+};
+
+class ByteReader
+{
+  private:
+    const uint8_t* cur;
+    const uint8_t* end;
+    bool           good;
+
+  public:
+    ByteReader(const void* data, size_t n)
+        : cur(static_cast<const uint8_t*>(data)), end(static_cast<const uint8_t*>(data) + n), good(true)
+    {}
+
+    bool   ok() const { return good; }
+    bool   atEnd() const { return cur == end; }
+    size_t remaining() const { return static_cast<size_t>(end - cur); }
+    // 将读取器标记为失败，之后的读取全部返回 0
+    void fail() { good = false; }
+
+    uint8_t  readByte();
+    uint64_t readVarint();
+    int64_t  readSVarint() { return unzigzag(readVarint()); }
+    uint32_t readFixed32();
+    bool     readBytes(void* out, size_t n);
+    // 返回指向底层数据的视图，只在数据有效期间可用
+    std::string_view readString();
+
+    /*
+     * 读取一个元素个数：每个元素至少占 1 字节，个数超过剩余字节数的数据必然已损坏，
+     * 在这里拦下可以避免按伪造的长度预先分配巨大的容器
+     */
+    size_t readCount();
+
+    static int64_t unzigzag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+};
+
+#endif  // __UTILS_BYTE_STREAM_H__
@@ -1,300 +1,732 @@
 #include <dom_analyzer.h>
 #include <debug.h>
-#include <cassert>
-#include <functional>
 #include <algorithm>
 
 /**
  * @file dom_analyser.cpp
  * @brief 支配树 (Dominator Tree) 与支配边界 (Dominance Frontier) 分析器实现
- * 
- * 核心算法基于 Lengauer-Tarjan (LT) 算法，这是一种高效求解支配树的算法，时间复杂度接近线性 O(M alpha(N))。
- * 
+ *
+ * idom 的求解采用 Semi-NCA 算法：与 Lengauer-Tarjan 一样先按逆 DFS 序求半支配点 (sdom)，
+ * 再按 DFS 序沿 DFS 树向上找 sdom 与父节点的最近公共祖先得到 idom，省去了 LT 中的桶与第二次 eval。
+ * 实践中它比 LT 更快，最坏复杂度为 O(N^2)，但只在极少见的图上出现。
+ *
  * 基本概念：
  * - 支配 (Dominates): 如果从入口到节点 u 的所有路径都必须经过节点 d，则称 d 支配 u (d dom u)。
  * - 直接支配 (Immediate Dominator, idom): 在所有严格支配 u 的节点中，距离 u 最近的那个。
  * - 支配边界 (Dominance Frontier, DF): 节点 d 的支配边界是所有不被 d 严格支配，但 d 支配其某个前驱的节点集合。
  *   DF 是构建 SSA 形式时插入 PHI 节点的关键依据。
+ *
+ * 为了能处理数万个基本块的函数，实现中：
+ * - DFS 与 eval 的路径压缩都用显式栈，不递归
+ * - 输入图不复制，只建一份转置的 CSR；虚拟源点的边由 entries / is_root 隐式表示
+ * - 支配边界以 CSR 形式输出，不为每个节点分配 std::set
+ *
+ * 文件后半部分是支配树的增量维护 DomTreeUpdater，它在子图上复用同一套 Semi-NCA 实现。
  */
 
 using namespace std;
 
-DomAnalyzer::DomAnalyzer() {}
+namespace
+{
+    // 一批更新的条数超过节点数的 1/8 时直接整体重算，此时逐条增量处理已不划算
+    constexpr size_t fullRebuildRatio = 8;
+}  // namespace
+
+bool DomFrontier::Row::contains(int block) const { return binary_search(first, last, block); }
+
+DomAnalyzer::DomAnalyzer()
+    : graph(nullptr), entries(nullptr), reversed(false), virtual_source(0)
+{}
 
 /**
-     * @brief 求解支配树和支配边界的主入口
-     * 
-     * 该函数负责构建辅助图（如添加虚拟源点），并调用核心构建算法。
-     * 
-     * 为什么要添加虚拟源点？
-     * - 保证流图有唯一的入口节点 (Single Entry)，简化算法实现。
-     * - 对于有多个入口（如死代码导致的孤立块）或计算后支配树（多个出口）的情况，虚拟源点充当统一的根。
-     * 
-     * @param graph 输入图的邻接表表示
-     * @param entry_points 图的入口节点列表 (通常只有一个，但在计算 Post-Dom 时可能有多个出口)
-     * @param reverse 是否反向计算。
-     *                - false: 计算支配树 (Dominator Tree)。
-     *                - true: 计算后支配树 (Post-Dominator Tree)，此时会将图的边反向。
-     */
-    void DomAnalyzer::solve(const vector<vector<int>>& graph, const vector<int>& entry_points, bool reverse)
+ * @brief 求解支配树和支配边界的主入口
+ *
+ * 为什么要添加虚拟源点？
+ * - 保证流图有唯一的入口节点 (Single Entry)，简化算法实现。
+ * - 对于有多个入口（如死代码导致的孤立块）或计算后支配树（多个出口）的情况，虚拟源点充当统一的根。
+ * 虚拟源点的编号为 node_count，它不出现在输出中：以它为 idom 的节点（即各个根）的 imm_dom 为自身。
+ *
+ * @param graph 输入图的邻接表表示
+ * @param entry_points 图的入口节点列表 (通常只有一个，但在计算 Post-Dom 时可能有多个出口)
+ * @param reverse 是否反向计算。
+ *                - false: 计算支配树 (Dominator Tree)。
+ *                - true: 计算后支配树 (Post-Dominator Tree)，此时会将图的边反向。
+ */
+void DomAnalyzer::solve(const vector<vector<int>>& graph, const vector<int>& entry_points, bool reverse)
 {
-    int node_count = graph.size();
+    int node_count = static_cast<int>(graph.size());
+
+    this->graph    = &graph;
+    entries        = &entry_points;
+    reversed       = reverse;
+    virtual_source = node_count;
+
+    auto preds = [this](int u, auto&& f) { forEachPred(u, f); };
+
+    buildTranspose(node_count);
+    dfn.assign(node_count + 1, -1);
+    numberNodes(
+        virtual_source, [this](int u) { return succCount(u); }, [this](int u, int k) { return succAt(u, k); });
+    computeIdom(preds);
+    buildTree(node_count);
+    buildFrontier(node_count, preds);
 
-    // 创建一个虚拟源点，连接所有实际的入口点
-    // 这样做可以统一处理多入口函数或多出口（反向时）的情况，保证图的单源特性
-    int                 virtual_source = node_count;
-    vector<vector<int>> working_graph;
+    this->graph = nullptr;
+    entries     = nullptr;
+}
 
-    if (!reverse)
+/**
+ * @brief 工作图的后继
+ *
+ * 正向时即输入图，反向时为转置；虚拟源点的后继为入口列表。
+ */
+int DomAnalyzer::succCount(int u) const
+{
+    if (u == virtual_source) return static_cast<int>(entries->size());
+    if (!reversed) return static_cast<int>((*graph)[u].size());
+    return trans_offset[u + 1] - trans_offset[u];
+}
+
+int DomAnalyzer::succAt(int u, int k) const
+{
+    if (u == virtual_source) return (*entries)[k];
+    if (!reversed) return (*graph)[u][k];
+    return trans_edges[trans_offset[u] + k];
+}
+
+/**
+ * @brief 工作图的前驱，入口（反向时为出口）另有一条来自虚拟源点的边
+ */
+template <typename F>
+void DomAnalyzer::forEachPred(int u, F&& f) const
+{
+    if (is_root[u]) f(virtual_source);
+    if (!reversed)
     {
-        // 正向支配树：虚拟源点 -> 所有入口点
-        working_graph = graph;
-        working_graph.push_back(vector<int>());
-        for (int entry : entry_points) working_graph[virtual_source].push_back(entry);
+        for (int k = trans_offset[u]; k < trans_offset[u + 1]; ++k) f(trans_edges[k]);
     }
     else
     {
-        // 后支配树：构建反图 (Reverse Graph)
-        // 原图边 u->v 变为 v->u
-        // 虚拟源点 -> 所有出口点 (原图的入口点变为反图的出口，这里参数命名 entry_points 实际上在 reverse=true 时指代 exit_points)
-        working_graph.resize(node_count + 1);
-        for (int u = 0; u < node_count; ++u)
-            for (int v : graph[u]) working_graph[v].push_back(u);
-
-        working_graph.push_back(vector<int>());
-        for (int exit : entry_points) working_graph[virtual_source].push_back(exit);
+        for (int v : (*graph)[u]) f(v);
     }
-
-    // 调用核心构建函数
-    build(working_graph, node_count + 1, virtual_source, entry_points);
 }
 
 /**
- * @brief Lengauer-Tarjan 算法的核心实现
- * 
- * 算法步骤：
- * 1. DFS 遍历：计算 DFS 序 (dfn) 和父节点 (parent)，建立半支配点 (semi-dominator) 的初始值。
- * 2. 逆 DFS 序遍历：
- *    - 计算半支配点 (sdom)。
- *    - 维护一个并查集 (DSU) 用于路径压缩和快速查询最小 sdom。
- *    - 隐式计算直接支配点 (idom)。
- * 3. 修正 idom：处理 sdom != idom 的情况。
- * 4. 构建支配树：根据 idom 数组构建树结构。
- * 5. 计算支配边界 (Dominance Frontier)。
+ * @brief 计数排序建立输入图的转置 CSR，并标记与虚拟源点相连的节点
  */
-void DomAnalyzer::build(
-    const vector<vector<int>>& working_graph, int node_count, int virtual_source, const std::vector<int>& entry_points)
+void DomAnalyzer::buildTranspose(int node_count)
 {
-    (void)entry_points; // 未使用参数，避免警告
-    
-    // 1. 构建反向图 (Preds)，方便查找前驱节点
-    // 算法需要知道每个节点的前驱 (predecessors)
-    vector<vector<int>> backward_edges(node_count);
+    const auto& g = *graph;
+
+    trans_offset.assign(node_count + 2, 0);
     for (int u = 0; u < node_count; ++u)
+        for (int v : g[u]) ++trans_offset[v + 2];
+    for (int i = 2; i < node_count + 2; ++i) trans_offset[i] += trans_offset[i - 1];
+
+    // 填充时以 trans_offset[v + 1] 作为写指针，填完后它恰好前移到行首
+    trans_edges.resize(trans_offset[node_count + 1]);
+    for (int u = 0; u < node_count; ++u)
+        for (int v : g[u]) trans_edges[trans_offset[v + 1]++] = u;
+    trans_offset.pop_back();
+
+    is_root.assign(node_count, 0);
+    for (int e : *entries) is_root[e] = 1;
+}
+
+/**
+ * @brief 从 root 出发做迭代式 DFS，按前序编号
+ *
+ * dfn: 节点 -> 前序编号（未访问为 -1）；order: 前序编号 -> 节点。
+ * 显式栈中保存 (节点, 下一个要访问的后继下标)，访问顺序与递归写法一致。
+ */
+template <typename SuccCount, typename SuccAt>
+void DomAnalyzer::numberNodes(int root, SuccCount&& succ_count, SuccAt&& succ_at)
+{
+    order.clear();
+    parent.clear();
+    dfs_stack.clear();
+
+    dfn[root] = 0;
+    order.push_back(root);
+    parent.push_back(0);
+    dfs_stack.emplace_back(root, 0);
+
+    while (!dfs_stack.empty())
     {
-        for (int v : working_graph[u])
+        auto& [u, k] = dfs_stack.back();
+        if (k == succ_count(u))
         {
-            backward_edges[v].push_back(u);
+            dfs_stack.pop_back();
+            continue;
         }
+
+        int v = succ_at(u, k++);
+        if (v < 0 || dfn[v] >= 0) continue;
+
+        dfn[v] = static_cast<int>(order.size());
+        order.push_back(v);
+        parent.push_back(dfn[u]);
+        dfs_stack.emplace_back(v, 0);
     }
+}
 
-    // 初始化结果容器
-    dom_tree.clear();
-    dom_tree.resize(node_count);
-    dom_frontier.clear();
-    dom_frontier.resize(node_count);
-    imm_dom.clear();
-    imm_dom.resize(node_count);
+/**
+ * @brief 带路径压缩的 eval
+ *
+ * 前序编号 >= last_linked 的节点已处理并挂入森林（ancestor 指向其 DFS 父节点或经压缩后的祖先）。
+ * 返回 v 到其森林根路径上 sdom 最小的节点；路径压缩时顺带更新沿途的 label。
+ */
+int DomAnalyzer::eval(int v, int last_linked)
+{
+    if (ancestor[v] < last_linked) return label[v];
 
-    // 2. DFS 遍历初始化
-    // block_to_dfs: 节点 ID -> DFS 序
-    // dfs_to_block: DFS 序 -> 节点 ID
-    int                 dfs_count = -1;
-    vector<int>         block_to_dfs(node_count, 0), dfs_to_block(node_count), parent(node_count, 0);
-    vector<int>         semi_dom(node_count);
-    vector<int>         dsu_parent(node_count), min_ancestor(node_count);
-    vector<vector<int>> semi_children(node_count);
+    // 收集到森林根之前的路径，根的下一个节点 label 已是最新
+    path.clear();
+    do {
+        path.push_back(v);
+        v = ancestor[v];
+    } while (ancestor[v] >= last_linked);
 
-    for (int i = 0; i < node_count; ++i)
+    int p = v;
+    while (!path.empty())
     {
-        dsu_parent[i]   = i; // 并查集父节点
-        min_ancestor[i] = i; // 路径上具有最小半支配 dfn 的节点
-        semi_dom[i]     = i; // 初始半支配节点为自身
+        int x = path.back();
+        path.pop_back();
+        ancestor[x] = ancestor[p];
+        if (semi[label[p]] < semi[label[x]]) label[x] = label[p];
+        p = x;
     }
+    return label[p];
+}
 
-    // DFS Lambda 函数
-    function<void(int)> dfs = [&](int block) {
-        block_to_dfs[block]     = ++dfs_count;
-        dfs_to_block[dfs_count] = block;
-        semi_dom[block]         = block_to_dfs[block]; // 初始 sdom 为其 dfn
-        for (int next : working_graph[block])
-            if (!block_to_dfs[next])
-            {
-                dfs(next);
-                parent[next] = block;
-            }
-    };
-    dfs(virtual_source);
-
-    // 并查集查找 (Find) 与路径压缩 (Path Compression)
-    // 作用：在森林中查找 u 的祖先中，半支配节点 dfn 最小的那个节点
-    // 返回：当前并查集的根
-    // 为什么需要路径压缩？
-    // - 为了快速查询 `dsu_query`，避免退化成 O(N)。
-    // - 压缩过程中同时维护 `min_ancestor` 属性，保证查询结果正确。
-    auto dsu_find = [&](int u, const auto& self) -> int {
-        if (dsu_parent[u] == u) return u;
-        int root = self(dsu_parent[u], self);
-        
-        // 路径压缩的同时维护 min_ancestor
-        // 如果父节点的 min_ancestor 的半支配节点 dfn 更小，则更新当前节点的 min_ancestor
-        if (semi_dom[min_ancestor[dsu_parent[u]]] < semi_dom[min_ancestor[u]])
-        {
-            min_ancestor[u] = min_ancestor[dsu_parent[u]];
-        }
-        dsu_parent[u] = root;
-        return root;
-    };
-
-    // 查询辅助函数：返回 u 到其并查集根路径上 sdom 最小的节点
-    auto dsu_query = [&](int u) -> int {
-        dsu_find(u, dsu_find);
-        return min_ancestor[u];
-    };
-    
-    // 消除未使用警告 (实际上 dsu_query 被使用了)
-    (void)dsu_find;
-    (void)dsu_query;
-
-    // 3. 逆 DFS 序遍历，计算半支配点 (Semi-Dominator) 并隐式计算直接支配点 (idom)
-    for (int dfs_id = dfs_count; dfs_id >= 1; --dfs_id)
+/**
+ * @brief Semi-NCA 求 idom（均以前序编号表示）
+ *
+ * 1. 逆 DFS 序求 sdom：sdom(w) = min({v | (v, w) 且 v < w} U {sdom(eval(v)) | (v, w) 且 v > w})
+ * 2. DFS 序求 idom：idom(w) 为 DFS 树上 parent(w) 的祖先中第一个编号不超过 sdom(w) 的节点
+ *    由于祖先的 idom 已先求出，沿 idom 链向上即可
+ */
+template <typename ForEachPred>
+void DomAnalyzer::computeIdom(ForEachPred&& for_each_pred)
+{
+    int num = static_cast<int>(order.size());
+
+    semi.resize(num);
+    label.resize(num);
+    ancestor.assign(parent.begin(), parent.end());
+    idom.assign(parent.begin(), parent.end());
+    for (int i = 0; i < num; ++i)
     {
-        int curr = dfs_to_block[dfs_id];
-        
-        // 步骤 3.1: 计算半支配点 sdom(curr)
-        // 公式：sdom(w) = min({dfn(v) | (v, w) 是树边} U {sdom(eval(v)) | (v, w) 是非树边})
-        for (int pred : backward_edges[curr])
-        {
-            // 跳过不可达节点
-            if (pred != virtual_source && block_to_dfs[pred] == 0) continue;
+        semi[i]  = i;
+        label[i] = i;
+    }
 
-            int eval_node;
-            if (block_to_dfs[pred] < block_to_dfs[curr])
-            {
-                // 如果 pred 是 DFS 树上的祖先，直接考虑 pred
-                eval_node = pred;
-            }
-            else
+    for (int i = num - 1; i >= 1; --i)
+    {
+        int s = parent[i];
+        for_each_pred(order[i], [&](int pred) {
+            int v = dfn[pred];
+            if (v < 0) return;  // 跳过不可达（或不在本次求解范围内）的前驱
+            int u = eval(v, i + 1);
+            if (semi[u] < s) s = semi[u];
+        });
+        semi[i] = s;
+    }
+
+    for (int i = 1; i < num; ++i)
+    {
+        int w = idom[i];
+        while (w > semi[i]) w = idom[w];
+        idom[i] = w;
+    }
+}
+
+/**
+ * @brief 由 idom 生成 imm_dom 与支配树（子节点按编号升序）
+ */
+void DomAnalyzer::buildTree(int node_count)
+{
+    imm_dom.assign(node_count, -1);
+    for (int i = 1; i < static_cast<int>(order.size()); ++i)
+    {
+        int node      = order[i];
+        int dom       = order[idom[i]];
+        imm_dom[node] = (dom == virtual_source) ? node : dom;
+    }
+
+    dom_tree.assign(node_count, vector<int>());
+    for (int node = 0; node < node_count; ++node)
+        if (imm_dom[node] >= 0 && imm_dom[node] != node) dom_tree[imm_dom[node]].push_back(node);
+}
+
+/**
+ * @brief 计算支配边界 (Dominance Frontier)，结果为 CSR
+ *
+ * 对每个可达节点 b 的每个前驱 p，从 p 沿支配树向上走到 idom(b) 为止（不含 idom(b)；b 为根时走到根为止），
+ * 沿途每个节点的支配边界都包含 b。只有一个前驱的节点其 idom 就是该前驱，不会产生任何条目。
+ * 先收集 (runner, b) 对，再按 runner 计数排序，最后逐行排序去重。
+ */
+template <typename ForEachPred>
+void DomAnalyzer::buildFrontier(int node_count, ForEachPred&& for_each_pred)
+{
+    frontier_pairs.clear();
+    for (int b = 0; b < node_count; ++b)
+    {
+        if (imm_dom[b] < 0) continue;
+
+        int target = imm_dom[b] == b ? -1 : imm_dom[b];
+        for_each_pred(b, [&](int pred) {
+            if (pred >= node_count || imm_dom[pred] < 0) return;  // 虚拟源点或不可达的前驱
+            int runner = pred;
+            while (runner != target)
             {
-                // 如果 pred 是后代或横向节点，需要在并查集中查找
-                // dsu_query 返回 pred 在 DFS 树上的祖先中（但在 curr 之下）具有最小 sdom 的节点
-                eval_node = dsu_query(pred);
+                frontier_pairs.emplace_back(runner, b);
+                if (imm_dom[runner] == runner) break;
+                runner = imm_dom[runner];
             }
+        });
+    }
+
+    auto& offset = dom_frontier.offset;
+    auto& blocks = dom_frontier.blocks;
 
-            // 更新 sdom(curr) 为 dfn 最小的那个
-            if (semi_dom[eval_node] < semi_dom[curr])
+    offset.assign(node_count + 2, 0);
+    for (auto& [runner, b] : frontier_pairs) ++offset[runner + 2];
+    for (int i = 2; i < node_count + 2; ++i) offset[i] += offset[i - 1];
+    blocks.resize(frontier_pairs.size());
+    for (auto& [runner, b] : frontier_pairs) blocks[offset[runner + 1]++] = b;
+    offset.pop_back();
+
+    // 逐行排序去重并原地压紧
+    int write = 0;
+    for (int i = 0; i < node_count; ++i)
+    {
+        auto first = blocks.begin() + offset[i];
+        auto last  = blocks.begin() + offset[i + 1];
+        sort(first, last);
+        last      = unique(first, last);
+        offset[i] = write;
+        for (auto it = first; it != last; ++it) blocks[write++] = *it;
+    }
+    offset[node_count] = write;
+    blocks.resize(write);
+}
+
+void DomAnalyzer::rebuildFrontier(const vector<vector<int>>& preds)
+{
+    buildFrontier(static_cast<int>(preds.size()), [&](int u, auto&& f) {
+        for (int p : preds[u]) f(p);
+    });
+}
+
+void DomAnalyzer::clear()
+{
+    dom_tree.clear();
+    dom_frontier.clear();
+    imm_dom.clear();
+}
+
+// ============================================================================
+// DomTreeUpdater
+// ============================================================================
+
+DomTreeUpdater::DomTreeUpdater(DomAnalyzer& dom)
+    : dom(dom),
+      entry(0),
+      succs(),
+      preds(),
+      level(),
+      frontier_stale(false),
+      region(),
+      region_mark(),
+      region_stamp(0),
+      bucket(),
+      pending(),
+      affected()
+{}
+
+void DomTreeUpdater::reset(vector<vector<int>> graph, int entry)
+{
+    int node_count = static_cast<int>(graph.size());
+
+    this->entry = entry;
+    succs       = std::move(graph);
+    preds.assign(node_count, vector<int>());
+    for (int u = 0; u < node_count; ++u)
+        for (int v : succs[u]) preds[v].push_back(u);
+
+    ASSERT(static_cast<int>(dom.imm_dom.size()) == node_count);
+    dom.dfn.assign(node_count, -1);
+    region_mark.assign(node_count, 0);
+    region_stamp   = 0;
+    frontier_stale = false;
+
+    level.assign(node_count, -1);
+    if (entry < node_count && dom.imm_dom[entry] == entry)
+    {
+        level[entry] = 0;
+        updateLevels(entry);
+    }
+}
+
+int DomTreeUpdater::addNode()
+{
+    int node = nodeCount();
+    succs.emplace_back();
+    preds.emplace_back();
+    level.push_back(-1);
+    region_mark.push_back(0);
+    dom.imm_dom.push_back(-1);
+    dom.dom_tree.emplace_back();
+    dom.dfn.push_back(-1);
+    frontier_stale = true;
+    return node;
+}
+
+void DomTreeUpdater::ensureNode(int node)
+{
+    while (nodeCount() <= node) addNode();
+}
+
+/**
+ * @brief 批量更新
+ *
+ * 图的邻接表按 updates 逐条修改。更新较多时整体重算；否则先处理插入再处理删除，
+ * 每条更新都在它之前的更新生效后的图上进行，因此批内顺序不影响最终结果。
+ */
+void DomTreeUpdater::applyUpdates(const vector<Update>& updates)
+{
+    if (updates.empty()) return;
+    for (auto& u : updates)
+    {
+        ensureNode(u.from);
+        ensureNode(u.to);
+    }
+
+    if (updates.size() * fullRebuildRatio > static_cast<size_t>(nodeCount()))
+    {
+        for (auto& u : updates)
+        {
+            if (u.kind == UpdateKind::Insert)
             {
-                semi_dom[curr] = semi_dom[eval_node];
+                succs[u.from].push_back(u.to);
+                preds[u.to].push_back(u.from);
+                continue;
             }
+            auto s = find(succs[u.from].begin(), succs[u.from].end(), u.to);
+            if (s == succs[u.from].end()) continue;
+            succs[u.from].erase(s);
+            preds[u.to].erase(find(preds[u.to].begin(), preds[u.to].end(), u.from));
         }
+        recalculate();
+        return;
+    }
 
-        // 步骤 3.2: 将 curr 加入其 sdom 的桶中 (semi_children)
-        // 延迟计算 idom，直到处理到 sdom(curr) 时
-        int sdom_block = dfs_to_block[semi_dom[curr]];
-        semi_children[sdom_block].push_back(curr);
-        
-        // 链接：将 curr 加入并查集，链接到其 DFS 树父节点
-        dsu_parent[curr] = parent[curr];
-
-        // 步骤 3.3: 计算父节点的半支配孩子们的 idom
-        // 此时 parent[curr] 的子树中的相关 sdom 信息已计算完毕
-        int p = parent[curr];
-        for (int child : semi_children[p])
+    for (auto& u : updates)
+        if (u.kind == UpdateKind::Insert) insertEdge(u.from, u.to);
+    for (auto& u : updates)
+        if (u.kind == UpdateKind::Delete) deleteEdge(u.from, u.to);
+}
+
+void DomTreeUpdater::recalculate()
+{
+    vector<int> entries = {entry};
+    dom.solve(succs, entries);
+    dom.dfn.assign(nodeCount(), -1);
+    frontier_stale = false;
+
+    level.assign(nodeCount(), -1);
+    if (entry >= nodeCount() || dom.imm_dom[entry] != entry) return;
+    level[entry] = 0;
+    updateLevels(entry);
+}
+
+void DomTreeUpdater::insertEdge(int from, int to)
+{
+    ensureNode(from);
+    ensureNode(to);
+    succs[from].push_back(to);
+    preds[to].push_back(from);
+    frontier_stale = true;
+
+    if (level[from] < 0) return;  // 边的起点不可达，支配关系不变
+    if (level[to] < 0)
+        insertUnreachable(from, to);
+    else
+        insertReachable(from, to);
+}
+
+/**
+ * @brief 插入两端均可达的边 (from, to)
+ *
+ * 新路径经过 NCA(from, to) 到达 to，受影响的节点的 idom 都变为 NCA。NCA 就是 to 本身（回边）或 to 的 idom 时，
+ * 没有任何节点受影响。否则按深度优先的桶队列从 to 出发搜索（depth-based search）：
+ * v 受影响当且仅当 depth(v) > depth(NCA) + 1，且存在从 to 到 v、途经节点深度都不小于 depth(v) 的路径。
+ * 只访问受影响节点及其附近，代价与支配树的变化量相当。
+ */
+void DomTreeUpdater::insertReachable(int from, int to)
+{
+    int nca = nearestCommonDominator(from, to);
+    if (nca == to || nca == dom.imm_dom[to]) return;
+
+    int nca_level = level[nca];
+
+    ++region_stamp;
+    region.clear();
+    bucket.clear();
+    bucket.emplace_back(level[to], to);
+    region_mark[to] = region_stamp;
+
+    while (!bucket.empty())
+    {
+        pop_heap(bucket.begin(), bucket.end());
+        int u = bucket.back().second;
+        bucket.pop_back();
+        region.push_back(u);
+
+        // 深度不低于当前受影响节点的后继本身不受影响，但可能经由它到达受影响的节点，就地继续搜索
+        int current_level = level[u];
+        pending.clear();
+        while (true)
         {
-            // 找到 child 到 p 路径上 sdom 最小的节点 u
-            int u = dsu_query(child);
-            
-            // LT 定理：
-            // 如果 sdom(u) == sdom(child)，则 idom(child) = sdom(child) = p
-            // 否则，idom(child) = idom(u)
-            if (semi_dom[u] < semi_dom[child])
-            {
-                imm_dom[child] = u; // 暂存 u，稍后在步骤 4 修正
-            }
-            else
+            for (int v : succs[u])
             {
-                imm_dom[child] = p; // 确认为 p
+                if (level[v] <= nca_level + 1 || region_mark[v] == region_stamp) continue;
+                region_mark[v] = region_stamp;
+                if (level[v] > current_level)
+                    pending.push_back(v);
+                else
+                {
+                    bucket.emplace_back(level[v], v);
+                    push_heap(bucket.begin(), bucket.end());
+                }
             }
+            if (pending.empty()) break;
+            u = pending.back();
+            pending.pop_back();
         }
-        semi_children[p].clear();
     }
 
-    // 4. 修正直接支配点 idom
-    // 按照 DFS 序正向遍历，处理之前暂存的情况
-    for (int dfs_id = 1; dfs_id <= dfs_count; ++dfs_id)
+    // 受影响的节点都改挂到 NCA 下，再更新它们子树的深度
+    auto& children = dom.dom_tree[nca];
+    for (int v : region)
     {
-        int curr = dfs_to_block[dfs_id];
-        if (imm_dom[curr] != dfs_to_block[semi_dom[curr]]) 
-        {
-            // 对应上述定理中的 case 2: idom(curr) = idom(u)
-            imm_dom[curr] = imm_dom[imm_dom[curr]];
-        }
+        auto& siblings = dom.dom_tree[dom.imm_dom[v]];
+        siblings.erase(lower_bound(siblings.begin(), siblings.end(), v));
+        children.insert(lower_bound(children.begin(), children.end(), v), v);
+        dom.imm_dom[v] = nca;
+    }
+    affected.assign(region.begin(), region.end());
+    for (int v : affected)
+    {
+        level[v] = nca_level + 1;
+        updateLevels(v);
     }
+}
 
-    // 5. 构建支配树 (Dominator Tree)
-    // imm_dom[i] 是 i 的父节点
-    for (int i = 0; i < node_count; ++i)
-        if (block_to_dfs[i]) dom_tree[imm_dom[i]].push_back(i);
+/**
+ * @brief 插入边 (from, to)，其中 to 原本不可达
+ *
+ * 从 to 出发、原本不可达的节点构成新可达区域，它只能经由 to 进入，因此先在区域内以 to 为根求支配树，
+ * 把 to 挂到 from 下；区域中连向原可达节点的边再逐条按可达边插入处理。
+ */
+void DomTreeUpdater::insertUnreachable(int from, int to)
+{
+    dom.numberNodes(
+        to, [&](int u) { return static_cast<int>(succs[u].size()); },
+        [&](int u, int k) {
+            int v = succs[u][k];
+            return level[v] < 0 ? v : -1;
+        });
+    dom.computeIdom([&](int u, auto&& f) {
+        for (int p : preds[u]) f(p);
+    });
+
+    vector<pair<int, int>> discovered;
+    for (int u : dom.order)
+        for (int v : succs[u])
+            if (level[v] >= 0) discovered.emplace_back(u, v);
+
+    region.assign(dom.order.begin() + 1, dom.order.end());
+    for (size_t i = 1; i < dom.order.size(); ++i) dom.imm_dom[dom.order[i]] = dom.order[dom.idom[i]];
+    for (int u : dom.order) dom.dfn[u] = -1;
+
+    auto& siblings = dom.dom_tree[from];
+    siblings.insert(lower_bound(siblings.begin(), siblings.end(), to), to);
+    dom.imm_dom[to] = from;
+    for (int v : region) dom.dom_tree[dom.imm_dom[v]].push_back(v);
+    for (int v : dom.order) sort(dom.dom_tree[v].begin(), dom.dom_tree[v].end());
+
+    level[to] = level[from] + 1;
+    updateLevels(to);
+
+    for (auto& [u, v] : discovered) insertReachable(u, v);
+}
+
+void DomTreeUpdater::deleteEdge(int from, int to)
+{
+    if (from >= nodeCount() || to >= nodeCount()) return;
 
-    // 移除虚拟源点带来的影响，调整大小
-    dom_tree.resize(virtual_source);
-    dom_frontier.resize(virtual_source);
-    imm_dom.resize(virtual_source);
+    auto s = find(succs[from].begin(), succs[from].end(), to);
+    if (s == succs[from].end()) return;
+    succs[from].erase(s);
+    preds[to].erase(find(preds[to].begin(), preds[to].end(), from));
+    frontier_stale = true;
 
-    // 修正 imm_dom：将指向虚拟源点的 idom 更新为自身（表示根节点或无支配者）
-    for (int i = 0; i < virtual_source; ++i)
+    if (level[from] < 0 || level[to] < 0) return;
+    if (find(succs[from].begin(), succs[from].end(), to) != succs[from].end()) return;  // 仍有平行边
+
+    // to 支配 from：被删的是回边，任何简单路径都不会用到它
+    int nca = nearestCommonDominator(from, to);
+    if (nca == to) return;
+
+    // from 不是 to 的 idom，或 to 还有不被它支配的前驱，则 to 仍可达，只有 NCA 的支配子树可能变化
+    if (dom.imm_dom[to] != from || hasProperSupport(to))
     {
-        if (imm_dom[i] == virtual_source)
+        rebuildAt(nca);
+        return;
+    }
+
+    // 否则 to 及其支配子树全部不可达。子树中连出的边可能是别的节点的支配来源，
+    // 找出这些边终点与 to 的 NCA 中最浅的一个，重建它的支配子树
+    ++region_stamp;
+    region.clear();
+    region.push_back(to);
+    region_mark[to] = region_stamp;
+    for (size_t i = 0; i < region.size(); ++i)
+        for (int c : dom.dom_tree[region[i]])
         {
-            imm_dom[i] = i;
+            region_mark[c] = region_stamp;
+            region.push_back(c);
         }
-    }
 
-    // 6. 计算支配边界 (Dominance Frontier)
-    // DF(n) 是所有满足 n 支配其前驱但不严格支配其本身的节点集合
-    // 算法：对于每个汇合点 (有多个前驱的节点)，其前驱沿着支配树向上回溯，直到遇到 idom
-    for (int block = 0; block < node_count; ++block)
+    int top = to;
+    for (int u : region)
+        for (int v : succs[u])
+        {
+            if (region_mark[v] == region_stamp || level[v] < 0) continue;
+            int ncd = nearestCommonDominator(v, to);
+            if (ncd != v && level[ncd] < level[top]) top = ncd;
+        }
+
+    auto& siblings = dom.dom_tree[from];
+    siblings.erase(lower_bound(siblings.begin(), siblings.end(), to));
+    for (int u : region) makeUnreachable(u);
+
+    if (top != to) rebuildAt(top);
+}
+
+// 要重建的是整棵树时，子树内的收集和排序都是额外开销，直接从头求解更快
+void DomTreeUpdater::rebuildAt(int root)
+{
+    if (root == entry)
+        recalculate();
+    else
+        rebuildSubtree(root);
+}
+
+bool DomTreeUpdater::hasProperSupport(int node) const
+{
+    for (int p : preds[node])
+        if (level[p] >= 0 && nearestCommonDominator(p, node) != node) return true;
+    return false;
+}
+
+void DomTreeUpdater::makeUnreachable(int node)
+{
+    dom.imm_dom[node] = -1;
+    dom.dom_tree[node].clear();
+    level[node] = -1;
+}
+
+/**
+ * @brief 重建以 root 为根的支配子树
+ *
+ * 进入 root 支配子树的路径都经过 root，且从 root 出发离开子树后不会再回到子树内，
+ * 因此只在子树节点上从 root 做 DFS 求 Semi-NCA 即可；未被访问到的子树节点已不可达。
+ */
+void DomTreeUpdater::rebuildSubtree(int root)
+{
+    ++region_stamp;
+    region.clear();
+    for (int c : dom.dom_tree[root])
     {
-        // 确保是 CFG 中的有效节点
-        if (block_to_dfs[block] == 0) continue;
+        region_mark[c] = region_stamp;
+        region.push_back(c);
+    }
+    for (size_t i = 0; i < region.size(); ++i)
+        for (int c : dom.dom_tree[region[i]])
+        {
+            region_mark[c] = region_stamp;
+            region.push_back(c);
+        }
+
+    dom.numberNodes(
+        root, [&](int u) { return static_cast<int>(succs[u].size()); },
+        [&](int u, int k) {
+            int v = succs[u][k];
+            return region_mark[v] == region_stamp ? v : -1;
+        });
+    dom.computeIdom([&](int u, auto&& f) {
+        for (int p : preds[u]) f(p);
+    });
 
-        // 遍历 block 的所有后继节点 succ
-        for (int succ : working_graph[block])
+    dom.dom_tree[root].clear();
+    for (int v : region) dom.dom_tree[v].clear();
+    for (int v : region)
+    {
+        if (dom.dfn[v] < 0)
         {
-            if (block_to_dfs[succ] == 0) continue;
+            makeUnreachable(v);
+            continue;
+        }
+        dom.imm_dom[v] = dom.order[dom.idom[dom.dfn[v]]];
+    }
+    for (int u : dom.order) dom.dfn[u] = -1;
 
-            // 沿着支配树向上回溯，直到遇到 succ 的直接支配者
-            // 路径上的每个节点 runner，succ 都在其支配边界中
-            int runner = block;
-            while (runner != imm_dom[succ] && runner != virtual_source && static_cast<size_t>(runner) < dom_frontier.size())
-            {
-                // succ 在 runner 的支配边界中
-                if (succ < virtual_source) // 排除虚拟节点
-                {
-                    dom_frontier[runner].insert(succ);
-                }
-                
-                runner = imm_dom[runner];
-                // 防止死循环（如果图不连通或 idom 构建错误，可能会循环）
-                if (runner == block || runner == imm_dom[runner]) break;
-            }
+    // 子节点列表保持升序，与从头求解的结果一致
+    for (int v : region)
+        if (dom.imm_dom[v] >= 0) dom.dom_tree[dom.imm_dom[v]].push_back(v);
+    sort(dom.dom_tree[root].begin(), dom.dom_tree[root].end());
+    for (int v : region) sort(dom.dom_tree[v].begin(), dom.dom_tree[v].end());
+
+    updateLevels(root);
+}
+
+void DomTreeUpdater::updateLevels(int root)
+{
+    region.clear();
+    region.push_back(root);
+    for (size_t i = 0; i < region.size(); ++i)
+        for (int c : dom.dom_tree[region[i]])
+        {
+            level[c] = level[region[i]] + 1;
+            region.push_back(c);
         }
+}
+
+int DomTreeUpdater::nearestCommonDominator(int a, int b) const
+{
+    while (a != b)
+    {
+        if (level[a] < level[b]) std::swap(a, b);
+        a = dom.imm_dom[a];
     }
+    return a;
 }
 
-void DomAnalyzer::clear()
+// 不可达节点被任何节点支配；不可达节点不支配任何可达节点
+bool DomTreeUpdater::dominates(int a, int b) const
 {
-    dom_tree.clear();
-    dom_frontier.clear();
-    imm_dom.clear();
+    if (!isReachable(b)) return true;
+    if (!isReachable(a)) return false;
+    while (level[b] > level[a]) b = dom.imm_dom[b];
+    return a == b;
+}
+
+void DomTreeUpdater::flush()
+{
+    if (!frontier_stale) return;
+    dom.rebuildFrontier(preds);
+    frontier_stale = false;
 }
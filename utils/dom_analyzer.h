@@ -1,34 +1,185 @@
 #ifndef __UTILS_DOM_ANALYZER_H__
 #define __UTILS_DOM_ANALYZER_H__
 
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 #include <vector>
-#include <set>
+
+// 支配边界，按 CSR（压缩行）存放：节点 i 的支配边界为 blocks[offset[i], offset[i + 1])，升序且无重复
+class DomFrontier
+{
+  public:
+    class Row
+    {
+      private:
+        const int* first;
+        const int* last;
+
+      public:
+        Row(const int* f, const int* l) : first(f), last(l) {}
+
+        const int* begin() const { return first; }
+        const int* end() const { return last; }
+        size_t     size() const { return static_cast<size_t>(last - first); }
+        bool       empty() const { return first == last; }
+        bool       contains(int block) const;
+    };
+
+    std::vector<int> offset;
+    std::vector<int> blocks;
+
+  public:
+    size_t size() const { return offset.empty() ? 0 : offset.size() - 1; }
+    Row    operator[](size_t i) const { return Row(blocks.data() + offset[i], blocks.data() + offset[i + 1]); }
+    void   clear()
+    {
+        offset.clear();
+        blocks.clear();
+    }
+};
 
 class DomAnalyzer
 {
+    friend class DomTreeUpdater;
+
   public:
     std::vector<std::vector<int>> dom_tree;
-    std::vector<std::set<int>>    dom_frontier;
-    std::vector<int>              imm_dom;
+    DomFrontier                   dom_frontier;
+    std::vector<int>              imm_dom;  // 根节点为自身，不可达节点为 -1
 
   public:
     DomAnalyzer();
 
   public:
-    // 计算支配/后支配信息（基于 Lengauer-Tarjan 的总体流程）：
-    // - 你需要补足若干中间步骤（并查集维护、半支配计算、idom 计算、支配边界收集）。
-    // - 我们保留了输入/输出接口与核心调用骨架，细节请参考 TODO 注释与课堂资料。
+    // 计算支配/后支配信息：
+    // - 以虚拟源点连接所有入口（reverse 时为所有出口），用迭代式 Semi-NCA 求 idom
+    // - 不复制输入图，只建立一份转置的 CSR；工作数组为成员，多次 solve 之间复用
     void solve(const std::vector<std::vector<int>>& graph, const std::vector<int>& entry_points, bool reverse = false);
     void clear();
 
+    // 由 imm_dom 与前驱表重新计算支配边界，供增量更新后使用
+    void rebuildFrontier(const std::vector<std::vector<int>>& preds);
+
+  private:
+    const std::vector<std::vector<int>>* graph;
+    const std::vector<int>*              entries;
+    bool                                 reversed;
+    int                                  virtual_source;
+
+    // 输入图的转置：正向时为前驱，反向时为工作图的后继
+    std::vector<int>  trans_offset;
+    std::vector<int>  trans_edges;
+    std::vector<char> is_root;
+
+    // Semi-NCA 工作数组，除 dfn 外均以 DFS 前序编号为下标
+    std::vector<int>                 dfn;
+    std::vector<int>                 order;
+    std::vector<int>                 parent;
+    std::vector<int>                 semi;
+    std::vector<int>                 label;
+    std::vector<int>                 ancestor;
+    std::vector<int>                 idom;
+    std::vector<int>                 path;
+    std::vector<std::pair<int, int>> dfs_stack;
+    std::vector<std::pair<int, int>> frontier_pairs;
+
+    int  succCount(int u) const;
+    int  succAt(int u, int k) const;
+    template <typename F>
+    void forEachPred(int u, F&& f) const;
+
+    void buildTranspose(int node_count);
+    void buildTree(int node_count);
+
+    // 以下为 Semi-NCA 的通用部分，DomTreeUpdater 在子图上复用：
+    // - numberNodes: 从 root 做 DFS 编号，succ_at 返回 -1 表示跳过该边；要求被访问的节点 dfn 事先为 -1
+    // - computeIdom: for_each_pred 只需给出全部前驱，未编号的前驱自动忽略
+    template <typename SuccCount, typename SuccAt>
+    void numberNodes(int root, SuccCount&& succ_count, SuccAt&& succ_at);
+    int  eval(int v, int last_linked);
+    template <typename ForEachPred>
+    void computeIdom(ForEachPred&& for_each_pred);
+    template <typename ForEachPred>
+    void buildFrontier(int node_count, ForEachPred&& for_each_pred);
+};
+
+/*
+ * 正向支配树的增量维护（单入口），思路与 LLVM 的 SemiNCAInfo 相同：
+ * - 插入边 (x, y)：若 y 原本不可达，先在新可达的区域上求 Semi-NCA 并挂到 x 下，
+ *   再把该区域连向原可达节点的边逐条按可达插入处理；否则用按深度的搜索找出 idom 变为 NCA(x, y) 的节点
+ * - 删除边 (x, y)：若 y 仍可达，只需重建 NCA(x, y) 的支配子树；
+ *   否则 y 的整个支配子树变为不可达，再重建受其影响的最小子树
+ * - 重建子树时只在层数大于子树根的节点上做 DFS，代价与子树大小成正比
+ * - 一批更新较多时直接整体重算；支配边界在 flush() 时按需重算
+ *
+ * 更新器持有图的一份邻接表，调用方在修改 CFG 的同时以 Update 告知它边的变化。
+ */
+class DomTreeUpdater
+{
+  public:
+    enum class UpdateKind : uint8_t
+    {
+        Insert,
+        Delete
+    };
+
+    struct Update
+    {
+        UpdateKind kind;
+        int        from;
+        int        to;
+    };
+
   private:
-    // TODO(Lab 4): 按 LT 算法完成该函数的关键步骤：
-    // 1) DFS 编号与反图/父亲关系构建
-    // 2) 半支配者 semi_dom 计算（含 Eval/Link 结构/最小祖先维护）
-    // 3) 直接支配者 imm_dom 计算与压缩
-    // 4) 支配树与支配边界构建
-    void build(const std::vector<std::vector<int>>& working_graph, int node_count, int virtual_source,
-        const std::vector<int>& entry_points);
+    DomAnalyzer&                  dom;
+    int                           entry;
+    std::vector<std::vector<int>> succs;
+    std::vector<std::vector<int>> preds;
+    std::vector<int>              level;  // 支配树中的深度，不可达为 -1
+    bool                          frontier_stale;
+
+    // 子树重建与插入时搜索受影响节点的工作数组
+    std::vector<int>                 region;
+    std::vector<uint32_t>            region_mark;
+    uint32_t                         region_stamp;
+    std::vector<std::pair<int, int>> bucket;  // (深度, 节点) 的大根堆
+    std::vector<int>                 pending;
+    std::vector<int>                 affected;
+
+  public:
+    explicit DomTreeUpdater(DomAnalyzer& dom);
+
+    // 以 graph 为当前图初始化，dom 须已在 graph 上以 entry 为唯一入口求解过
+    void reset(std::vector<std::vector<int>> graph, int entry);
+
+    int  addNode();
+    void ensureNode(int node);
+
+    void applyUpdates(const std::vector<Update>& updates);
+    void insertEdge(int from, int to);
+    void deleteEdge(int from, int to);
+
+    int  nearestCommonDominator(int a, int b) const;
+    bool dominates(int a, int b) const;
+    bool isReachable(int node) const { return node >= 0 && node < nodeCount() && level[node] >= 0; }
+    int  nodeCount() const { return static_cast<int>(succs.size()); }
+
+    // 重算支配边界（若有未处理的更新）
+    void flush();
+
+  private:
+    void recalculate();
+    void insertReachable(int from, int to);
+    void insertUnreachable(int from, int to);
+    bool hasProperSupport(int node) const;
+    void makeUnreachable(int node);
+
+    // 重建以 root 为根的支配子树，root 本身的 idom 不变
+    void rebuildSubtree(int root);
+    // root 为入口时整体重算，否则重建子树
+    void rebuildAt(int root);
+    void updateLevels(int root);
 };
 
 #endif  // __UTILS_DOM_ANALYZER_H__
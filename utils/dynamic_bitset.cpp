@@ -1,7 +1,9 @@
 #include <dynamic_bitset.h>
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <cmath>
+#include <new>
 
 #ifdef __GNUC__
 #include <x86intrin.h>
@@ -47,50 +49,63 @@ namespace Cele
         }
     }
 
-    dynamic_bitset::dynamic_bitset() : m_blocks(nullptr), m_num_bits(0), m_num_blocks(0) {}
+    dynamic_bitset::block_type* dynamic_bitset::allocate(size_t num_blocks)
+    {
+        if (num_blocks <= inline_blocks) return m_inline;
 
-    dynamic_bitset::dynamic_bitset(size_t num_bits, unsigned long value)
-        : m_num_bits(num_bits), m_num_blocks(blocks_required(num_bits))
+#if defined(__GNUC__) && !defined(__MINGW32__)
+        const size_t alignment = 64;
+        void*        ptr       = nullptr;
+        if (posix_memalign(&ptr, alignment, num_blocks * sizeof(block_type)) != 0) throw std::bad_alloc();
+        return static_cast<block_type*>(ptr);
+#else
+        return new block_type[num_blocks];
+#endif
+    }
+
+    void dynamic_bitset::deallocate(block_type* blocks)
     {
-        if (m_num_blocks > 0)
-        {
+        if (blocks == m_inline) return;
+
+        // 使用与 allocate 匹配的释放方式
 #if defined(__GNUC__) && !defined(__MINGW32__)
-            const size_t alignment = 64;
-            void*        ptr       = nullptr;
-            if (posix_memalign(&ptr, alignment, m_num_blocks * sizeof(block_type)) == 0)
-            {
-                m_blocks = static_cast<block_type*>(ptr);
-                std::memset(m_blocks, 0, m_num_blocks * sizeof(block_type));
-            }
-            else
-                m_blocks = new block_type[m_num_blocks]();
+        free(blocks);
 #else
-            m_blocks = new block_type[m_num_blocks]();
+        delete[] blocks;
 #endif
+    }
 
+    dynamic_bitset::dynamic_bitset() : m_blocks(m_inline), m_num_bits(0), m_num_blocks(0), m_inline{} {}
+
+    dynamic_bitset::dynamic_bitset(size_t num_bits, unsigned long value)
+        : m_blocks(nullptr), m_num_bits(num_bits), m_num_blocks(blocks_required(num_bits)), m_inline{}
+    {
+        m_blocks = allocate(m_num_blocks);
+        if (m_num_blocks > 0)
+        {
+            std::memset(m_blocks, 0, m_num_blocks * sizeof(block_type));
             if (value != 0)
             {
                 m_blocks[0] = value;
                 sanitize();
             }
         }
-        else
-            m_blocks = nullptr;
     }
 
     dynamic_bitset::dynamic_bitset(const std::string& str, size_t pos, size_t n, char zero, char one)
-        : m_blocks(nullptr), m_num_bits(0), m_num_blocks(0)
+        : m_blocks(m_inline), m_num_bits(0), m_num_blocks(0), m_inline{}
     {
         if (pos >= str.size()) return;
 
-        if (n == std::string::npos) n = str.size() - pos;
+        if (n == std::string::npos || n > str.size() - pos) n = str.size() - pos;
 
         m_num_bits   = n;
         m_num_blocks = blocks_required(m_num_bits);
+        m_blocks     = allocate(m_num_blocks);
 
         if (m_num_blocks > 0)
         {
-            m_blocks = new block_type[m_num_blocks]();
+            std::memset(m_blocks, 0, m_num_blocks * sizeof(block_type));
 
             for (size_t i = 0; i < n; ++i)
             {
@@ -103,36 +118,31 @@ namespace Cele
                     m_blocks[block_idx] |= (block_type(1) << bit_offset);
                 }
                 else if (c != zero)
+                {
+                    deallocate(m_blocks);
                     throw std::invalid_argument("Invalid character in bitset initialization");
+                }
             }
         }
     }
 
     dynamic_bitset::dynamic_bitset(const dynamic_bitset& other)
-        : m_num_bits(other.m_num_bits), m_num_blocks(other.m_num_blocks)
+        : m_blocks(nullptr), m_num_bits(other.m_num_bits), m_num_blocks(other.m_num_blocks), m_inline{}
     {
-        if (m_num_blocks > 0)
-        {
-#if defined(__GNUC__) && !defined(__MINGW32__)
-            const size_t alignment = 64;
-            void*        ptr       = nullptr;
-            if (posix_memalign(&ptr, alignment, m_num_blocks * sizeof(block_type)) == 0)
-                m_blocks = static_cast<block_type*>(ptr);
-            else
-                m_blocks = new block_type[m_num_blocks];
-#else
-            m_blocks = new block_type[m_num_blocks];
-#endif
-
-            std::memcpy(m_blocks, other.m_blocks, m_num_blocks * sizeof(block_type));
-        }
-        else { m_blocks = nullptr; }
+        m_blocks = allocate(m_num_blocks);
+        if (m_num_blocks > 0) std::memcpy(m_blocks, other.m_blocks, m_num_blocks * sizeof(block_type));
     }
 
     dynamic_bitset::dynamic_bitset(dynamic_bitset&& other) noexcept
-        : m_blocks(other.m_blocks), m_num_bits(other.m_num_bits), m_num_blocks(other.m_num_blocks)
+        : m_blocks(other.m_blocks), m_num_bits(other.m_num_bits), m_num_blocks(other.m_num_blocks), m_inline{}
     {
-        other.m_blocks     = nullptr;
+        if (other.is_inline())
+        {
+            m_blocks = m_inline;
+            std::memcpy(m_inline, other.m_inline, sizeof(m_inline));
+        }
+
+        other.m_blocks     = other.m_inline;
         other.m_num_bits   = 0;
         other.m_num_blocks = 0;
     }
@@ -143,29 +153,10 @@ namespace Cele
         {
             if (m_num_blocks != other.m_num_blocks)
             {
-#if defined(__GNUC__) && !defined(__MINGW32__)
-                if (m_blocks) free(m_blocks);
-#else
-                delete[] m_blocks;
-#endif
-
+                block_type* blocks = allocate(other.m_num_blocks);
+                if (blocks != m_blocks) deallocate(m_blocks);
+                m_blocks     = blocks;
                 m_num_blocks = other.m_num_blocks;
-
-                if (m_num_blocks > 0)
-                {
-#if defined(__GNUC__) && !defined(__MINGW32__)
-                    const size_t alignment = 64;
-                    void*        ptr       = nullptr;
-                    if (posix_memalign(&ptr, alignment, m_num_blocks * sizeof(block_type)) == 0)
-                        m_blocks = static_cast<block_type*>(ptr);
-                    else
-                        m_blocks = new block_type[m_num_blocks];
-#else
-                    m_blocks = new block_type[m_num_blocks];
-#endif
-                }
-                else
-                    m_blocks = nullptr;
             }
 
             m_num_bits = other.m_num_bits;
@@ -180,36 +171,26 @@ namespace Cele
     {
         if (this != &other)
         {
-            // 使用与析构函数匹配的释放方式
-#if defined(__GNUC__) && !defined(__MINGW32__)
-            if (m_blocks) free(m_blocks);
-#else
-            delete[] m_blocks;
-#endif
+            deallocate(m_blocks);
 
-            m_blocks     = other.m_blocks;
             m_num_bits   = other.m_num_bits;
             m_num_blocks = other.m_num_blocks;
+            if (other.is_inline())
+            {
+                m_blocks = m_inline;
+                std::memcpy(m_inline, other.m_inline, sizeof(m_inline));
+            }
+            else
+                m_blocks = other.m_blocks;
 
-            other.m_blocks     = nullptr;
+            other.m_blocks     = other.m_inline;
             other.m_num_bits   = 0;
             other.m_num_blocks = 0;
         }
         return *this;
     }
 
-    dynamic_bitset::~dynamic_bitset()
-    {
-#if defined(__GNUC__) && !defined(__MINGW32__)
-        if (m_blocks)
-        {
-            free(m_blocks);
-            m_blocks = nullptr;
-        }
-#else
-        delete[] m_blocks;
-#endif
-    }
+    dynamic_bitset::~dynamic_bitset() { deallocate(m_blocks); }
 
     dynamic_bitset& dynamic_bitset::set(size_t pos, bool value)
     {
@@ -334,53 +315,30 @@ namespace Cele
     {
         if (num_bits == m_num_bits) return;
 
+        // 变长且以 1 填充时，原最后一块中超出旧长度的位也要置 1
+        if (num_bits > m_num_bits && value && m_num_blocks > 0)
+        {
+            size_t old_bits_in_last_block = m_num_bits % bits_per_block;
+            if (old_bits_in_last_block > 0) m_blocks[m_num_blocks - 1] |= (~block_type(0) << old_bits_in_last_block);
+        }
+
         size_t new_num_blocks = blocks_required(num_bits);
 
         if (new_num_blocks != m_num_blocks)
         {
-            block_type* new_blocks = nullptr;
-
-            if (new_num_blocks > 0)
-            {
-#if defined(__GNUC__) && !defined(__MINGW32__)
-                const size_t alignment = 64;
-                void*        ptr       = nullptr;
-                if (posix_memalign(&ptr, alignment, new_num_blocks * sizeof(block_type)) == 0)
-                {
-                    new_blocks = static_cast<block_type*>(ptr);
-                    std::memset(new_blocks, 0, new_num_blocks * sizeof(block_type));
-                }
-                else
-                    new_blocks = new block_type[new_num_blocks]();
-#else
-                new_blocks = new block_type[new_num_blocks]();
-#endif
-            }
+            block_type* new_blocks = allocate(new_num_blocks);
 
             size_t copy_blocks = std::min(m_num_blocks, new_num_blocks);
-            if (copy_blocks > 0) std::memcpy(new_blocks, m_blocks, copy_blocks * sizeof(block_type));
+            if (new_blocks != m_blocks && copy_blocks > 0)
+                std::memcpy(new_blocks, m_blocks, copy_blocks * sizeof(block_type));
 
-            if (value && new_num_blocks > m_num_blocks)
-                std::fill(new_blocks + m_num_blocks, new_blocks + new_num_blocks, ~block_type(0));
-            else if (new_num_blocks > m_num_blocks)
-                std::fill(new_blocks + m_num_blocks, new_blocks + new_num_blocks, block_type(0));
+            block_type fill_value = value ? ~block_type(0) : block_type(0);
+            if (new_num_blocks > m_num_blocks) std::fill(new_blocks + m_num_blocks, new_blocks + new_num_blocks, fill_value);
 
-                // 使用与析构函数匹配的释放方式
-#if defined(__GNUC__) && !defined(__MINGW32__)
-            if (m_blocks) free(m_blocks);
-#else
-            delete[] m_blocks;
-#endif
+            if (new_blocks != m_blocks) deallocate(m_blocks);
             m_blocks     = new_blocks;
             m_num_blocks = new_num_blocks;
         }
-        else if (num_bits > m_num_bits && value)
-        {
-            size_t old_bits_in_last_block = m_num_bits % bits_per_block;
-
-            if (old_bits_in_last_block > 0 && m_num_blocks > 0)
-                m_blocks[m_num_blocks - 1] |= (~block_type(0) << old_bits_in_last_block);
-        }
 
         m_num_bits = num_bits;
         sanitize();
@@ -423,20 +381,8 @@ namespace Cele
 
     size_t dynamic_bitset::count() const
     {
-        if (m_num_blocks == 0) return 0;
-
         size_t count = 0;
-
-        constexpr size_t UNROLL_COUNT = 8;
-        size_t           i            = 0;
-
-        for (; i + UNROLL_COUNT <= m_num_blocks; i += UNROLL_COUNT)
-            count += popcount(m_blocks[i]) + popcount(m_blocks[i + 1]) + popcount(m_blocks[i + 2]) +
-                     popcount(m_blocks[i + 3]) + popcount(m_blocks[i + 4]) + popcount(m_blocks[i + 5]) +
-                     popcount(m_blocks[i + 6]) + popcount(m_blocks[i + 7]);
-
-        for (; i < m_num_blocks; ++i) count += popcount(m_blocks[i]);
-
+        for (size_t i = 0; i < m_num_blocks; ++i) count += popcount(m_blocks[i]);
         return count;
     }
 
@@ -456,66 +402,155 @@ namespace Cele
         return result;
     }
 
-    dynamic_bitset& dynamic_bitset::operator&=(const dynamic_bitset& other)
+    size_t dynamic_bitset::find_first() const
     {
-        if (size() != other.size())
-            throw std::invalid_argument("Bitsets must have the same size for bitwise AND operation");
+        for (size_t i = 0; i < m_num_blocks; ++i)
+            if (m_blocks[i] != 0) return i * bits_per_block + ctz(m_blocks[i]);
+        return npos;
+    }
 
-        constexpr size_t UNROLL_COUNT = 4;
-        size_t           i            = 0;
+    size_t dynamic_bitset::find_next(size_t pos) const
+    {
+        if (pos == npos || pos + 1 >= m_num_bits) return npos;
 
-        for (; i + UNROLL_COUNT <= m_num_blocks; i += UNROLL_COUNT)
+        ++pos;
+        size_t     i     = pos >> BLOCK_SHIFT;
+        block_type block = m_blocks[i] & (~block_type(0) << (pos & BLOCK_MASK));
+        if (block != 0) return i * bits_per_block + ctz(block);
+
+        for (++i; i < m_num_blocks; ++i)
+            if (m_blocks[i] != 0) return i * bits_per_block + ctz(m_blocks[i]);
+        return npos;
+    }
+
+    /*
+     * 以下逐块运算都写成同一下标上读-算-写的简单循环，并把“是否改变”累积成按位或，
+     * 循环体内没有分支，便于编译器向量化。
+     * 参与运算的位集可以是同一个对象（如 a.union_with(a)），同下标读写不受别名影响。
+     */
+    bool dynamic_bitset::union_with(const dynamic_bitset& other)
+    {
+        check_same_size(other, "Bitsets must have the same size for union");
+
+        block_type*       dst     = m_blocks;
+        const block_type* src     = other.m_blocks;
+        block_type        changed = 0;
+        for (size_t i = 0; i < m_num_blocks; ++i)
         {
-            m_blocks[i] &= other.m_blocks[i];
-            m_blocks[i + 1] &= other.m_blocks[i + 1];
-            m_blocks[i + 2] &= other.m_blocks[i + 2];
-            m_blocks[i + 3] &= other.m_blocks[i + 3];
+            block_type v = dst[i] | src[i];
+            changed |= v ^ dst[i];
+            dst[i] = v;
         }
+        return changed != 0;
+    }
 
-        for (; i < m_num_blocks; ++i) m_blocks[i] &= other.m_blocks[i];
+    bool dynamic_bitset::intersect_with(const dynamic_bitset& other)
+    {
+        check_same_size(other, "Bitsets must have the same size for intersection");
 
-        return *this;
+        block_type*       dst     = m_blocks;
+        const block_type* src     = other.m_blocks;
+        block_type        changed = 0;
+        for (size_t i = 0; i < m_num_blocks; ++i)
+        {
+            block_type v = dst[i] & src[i];
+            changed |= v ^ dst[i];
+            dst[i] = v;
+        }
+        return changed != 0;
     }
 
-    dynamic_bitset& dynamic_bitset::operator|=(const dynamic_bitset& other)
+    bool dynamic_bitset::subtract(const dynamic_bitset& other)
     {
-        if (size() != other.size())
-            throw std::invalid_argument("Bitsets must have the same size for bitwise OR operation");
+        check_same_size(other, "Bitsets must have the same size for subtraction");
 
-        constexpr size_t UNROLL_COUNT = 4;
-        size_t           i            = 0;
+        block_type*       dst     = m_blocks;
+        const block_type* src     = other.m_blocks;
+        block_type        changed = 0;
+        for (size_t i = 0; i < m_num_blocks; ++i)
+        {
+            block_type v = dst[i] & ~src[i];
+            changed |= v ^ dst[i];
+            dst[i] = v;
+        }
+        return changed != 0;
+    }
 
-        for (; i + UNROLL_COUNT <= m_num_blocks; i += UNROLL_COUNT)
+    bool dynamic_bitset::union_with_difference(const dynamic_bitset& a, const dynamic_bitset& b)
+    {
+        check_same_size(a, "Bitsets must have the same size for union_with_difference");
+        check_same_size(b, "Bitsets must have the same size for union_with_difference");
+
+        block_type*       dst     = m_blocks;
+        const block_type* pa      = a.m_blocks;
+        const block_type* pb      = b.m_blocks;
+        block_type        changed = 0;
+        for (size_t i = 0; i < m_num_blocks; ++i)
         {
-            m_blocks[i] |= other.m_blocks[i];
-            m_blocks[i + 1] |= other.m_blocks[i + 1];
-            m_blocks[i + 2] |= other.m_blocks[i + 2];
-            m_blocks[i + 3] |= other.m_blocks[i + 3];
+            block_type v = dst[i] | (pa[i] & ~pb[i]);
+            changed |= v ^ dst[i];
+            dst[i] = v;
         }
+        return changed != 0;
+    }
 
-        for (; i < m_num_blocks; ++i) m_blocks[i] |= other.m_blocks[i];
+    bool dynamic_bitset::assign_union_difference(
+        const dynamic_bitset& gen, const dynamic_bitset& in, const dynamic_bitset& kill)
+    {
+        check_same_size(gen, "Bitsets must have the same size for assign_union_difference");
+        check_same_size(in, "Bitsets must have the same size for assign_union_difference");
+        check_same_size(kill, "Bitsets must have the same size for assign_union_difference");
+
+        block_type*       dst     = m_blocks;
+        const block_type* pg      = gen.m_blocks;
+        const block_type* pi      = in.m_blocks;
+        const block_type* pk      = kill.m_blocks;
+        block_type        changed = 0;
+        for (size_t i = 0; i < m_num_blocks; ++i)
+        {
+            block_type v = pg[i] | (pi[i] & ~pk[i]);
+            changed |= v ^ dst[i];
+            dst[i] = v;
+        }
+        return changed != 0;
+    }
 
-        return *this;
+    bool dynamic_bitset::is_subset_of(const dynamic_bitset& other) const
+    {
+        check_same_size(other, "Bitsets must have the same size for subset test");
+
+        block_type extra = 0;
+        for (size_t i = 0; i < m_num_blocks; ++i) extra |= m_blocks[i] & ~other.m_blocks[i];
+        return extra == 0;
     }
 
-    dynamic_bitset& dynamic_bitset::operator^=(const dynamic_bitset& other)
+    bool dynamic_bitset::intersects(const dynamic_bitset& other) const
     {
-        if (size() != other.size())
-            throw std::invalid_argument("Bitsets must have the same size for bitwise XOR operation");
+        check_same_size(other, "Bitsets must have the same size for intersection test");
 
-        constexpr size_t UNROLL_COUNT = 4;
-        size_t           i            = 0;
+        block_type common = 0;
+        for (size_t i = 0; i < m_num_blocks; ++i) common |= m_blocks[i] & other.m_blocks[i];
+        return common != 0;
+    }
 
-        for (; i + UNROLL_COUNT <= m_num_blocks; i += UNROLL_COUNT)
-        {
-            m_blocks[i] ^= other.m_blocks[i];
-            m_blocks[i + 1] ^= other.m_blocks[i + 1];
-            m_blocks[i + 2] ^= other.m_blocks[i + 2];
-            m_blocks[i + 3] ^= other.m_blocks[i + 3];
-        }
+    dynamic_bitset& dynamic_bitset::operator&=(const dynamic_bitset& other)
+    {
+        check_same_size(other, "Bitsets must have the same size for bitwise AND operation");
+        for (size_t i = 0; i < m_num_blocks; ++i) m_blocks[i] &= other.m_blocks[i];
+        return *this;
+    }
 
-        for (; i < m_num_blocks; ++i) m_blocks[i] ^= other.m_blocks[i];
+    dynamic_bitset& dynamic_bitset::operator|=(const dynamic_bitset& other)
+    {
+        check_same_size(other, "Bitsets must have the same size for bitwise OR operation");
+        for (size_t i = 0; i < m_num_blocks; ++i) m_blocks[i] |= other.m_blocks[i];
+        return *this;
+    }
 
+    dynamic_bitset& dynamic_bitset::operator^=(const dynamic_bitset& other)
+    {
+        check_same_size(other, "Bitsets must have the same size for bitwise XOR operation");
+        for (size_t i = 0; i < m_num_blocks; ++i) m_blocks[i] ^= other.m_blocks[i];
         return *this;
     }
 
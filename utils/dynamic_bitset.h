@@ -9,16 +9,27 @@
 
 namespace Cele
 {
+    /*
+     * 定长位集，主要用于活跃变量等数据流分析：
+     * - 不超过 inline_blocks 个块时存放在对象内部，不申请堆内存；更大时按 64 字节对齐申请
+     * - find_first / find_next / for_each_set 按块跳过全零区域，用 ctz 取出置位
+     * - union_with 等集合运算返回本对象是否改变，供迭代求解判断不动点；
+     *   assign_union_difference 一趟完成 gen | (in & ~kill) 这类传递函数
+     * - 逐块运算写成无分支的简单循环，便于编译器向量化
+     */
     class dynamic_bitset
     {
       public:
         using block_type                       = unsigned long;
         static constexpr size_t bits_per_block = sizeof(block_type) * CHAR_BIT;
+        static constexpr size_t inline_blocks  = 2;
+        static constexpr size_t npos           = static_cast<size_t>(-1);
 
       private:
         block_type* m_blocks;
         size_t      m_num_bits;
         size_t      m_num_blocks;
+        block_type  m_inline[inline_blocks];
 
       public:
         dynamic_bitset();
@@ -55,6 +66,23 @@ namespace Cele
         size_t      count() const;
         std::string to_string(char zero = '0', char one = '1') const;
 
+        // 置位遍历：没有（更多）置位时返回 npos
+        size_t find_first() const;
+        size_t find_next(size_t pos) const;
+        template <typename F>
+        void for_each_set(F&& f) const;
+
+        // 以下运算要求两侧大小相同，返回本对象是否改变
+        bool union_with(const dynamic_bitset& other);                                   // this |= other
+        bool intersect_with(const dynamic_bitset& other);                               // this &= other
+        bool subtract(const dynamic_bitset& other);                                     // this &= ~other
+        bool union_with_difference(const dynamic_bitset& a, const dynamic_bitset& b);  // this |= a & ~b
+        // this = gen | (in & ~kill)
+        bool assign_union_difference(const dynamic_bitset& gen, const dynamic_bitset& in, const dynamic_bitset& kill);
+
+        bool is_subset_of(const dynamic_bitset& other) const;
+        bool intersects(const dynamic_bitset& other) const;
+
         dynamic_bitset& operator&=(const dynamic_bitset& other);
         dynamic_bitset& operator|=(const dynamic_bitset& other);
         dynamic_bitset& operator^=(const dynamic_bitset& other);
@@ -79,10 +107,50 @@ namespace Cele
             if (pos >= m_num_bits) throw std::out_of_range("Position out of range");
         }
 
+        inline void check_same_size(const dynamic_bitset& other, const char* what) const
+        {
+            if (m_num_bits != other.m_num_bits) throw std::invalid_argument(what);
+        }
+
+        inline bool is_inline() const { return m_blocks == m_inline; }
+
+        // 申请能容纳 num_blocks 个块的存储（未初始化），小尺寸时返回 m_inline；deallocate 忽略 m_inline
+        block_type* allocate(size_t num_blocks);
+        void        deallocate(block_type* blocks);
+
         void          sanitize();
         static size_t popcount(block_type block);
+
+        static inline size_t ctz(block_type block)
+        {
+#if defined(__GNUC__)
+            return __builtin_ctzl(block);
+#else
+            size_t n = 0;
+            while (!(block & 1))
+            {
+                block >>= 1;
+                ++n;
+            }
+            return n;
+#endif
+        }
     };
 
+    template <typename F>
+    void dynamic_bitset::for_each_set(F&& f) const
+    {
+        for (size_t i = 0; i < m_num_blocks; ++i)
+        {
+            block_type block = m_blocks[i];
+            while (block)
+            {
+                f(i * bits_per_block + ctz(block));
+                block &= block - 1;
+            }
+        }
+    }
+
     dynamic_bitset operator&(const dynamic_bitset& lhs, const dynamic_bitset& rhs);
     dynamic_bitset operator|(const dynamic_bitset& lhs, const dynamic_bitset& rhs);
     dynamic_bitset operator^(const dynamic_bitset& lhs, const dynamic_bitset& rhs);
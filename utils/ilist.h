@@ -0,0 +1,271 @@
+#ifndef __UTILS_ILIST_H__
+#define __UTILS_ILIST_H__
+
+#include <debug.h>
+#include <cstddef>
+#include <iterator>
+
+template <typename T, typename ParentT>
+class IList;
+
+/*
+ * 侵入式双向链表结点：元素自己保存前驱、后继和所在链表的拥有者（如指令所属的基本块）
+ * 元素类型 T 需要公有继承 IListNode<T, ParentT>，同一时刻只能位于一个链表中
+ */
+template <typename T, typename ParentT>
+class IListNode
+{
+    friend class IList<T, ParentT>;
+
+  private:
+    T*       ilistPrev   = nullptr;
+    T*       ilistNext   = nullptr;
+    ParentT* ilistParent = nullptr;
+
+  public:
+    T*       getPrevNode() const { return ilistPrev; }
+    T*       getNextNode() const { return ilistNext; }
+    ParentT* getParent() const { return ilistParent; }
+    bool     isLinked() const { return ilistParent != nullptr; }
+};
+
+/*
+ * 侵入式双向链表：
+ * - insert/erase/replace 只修改相邻结点的指针，为 O(1)
+ * - splice 整段改链为 O(1)；拥有者记录在结点上，拥有者不同（或只移动部分元素需计数）时另需 O(移动的元素数)
+ * - 插入和删除不会使指向其他元素的迭代器失效
+ * - 链表不拥有元素：erase/clear 只摘下元素，元素的销毁由使用者负责
+ * 迭代器解引用得到元素指针，用法与原先的 std::deque<T*> 保持一致
+ */
+template <typename T, typename ParentT>
+class IList
+{
+    using Node = IListNode<T, ParentT>;
+
+  public:
+    template <bool Reverse>
+    class Iterator
+    {
+        friend class IList;
+
+      private:
+        const IList* list;
+        T*           cur;  // nullptr 表示 end()
+
+        Iterator(const IList* l, T* c) : list(l), cur(c) {}
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T*;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T* const*;
+        using reference         = T*;
+
+        Iterator() : list(nullptr), cur(nullptr) {}
+
+        T* operator*() const { return cur; }
+
+        Iterator& operator++()
+        {
+            cur = Reverse ? node(cur)->ilistPrev : node(cur)->ilistNext;
+            return *this;
+        }
+        Iterator& operator--()
+        {
+            if (!cur)
+                cur = Reverse ? list->head : list->tail;
+            else
+                cur = Reverse ? node(cur)->ilistNext : node(cur)->ilistPrev;
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+        Iterator operator--(int)
+        {
+            Iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const Iterator& other) const { return cur == other.cur; }
+        bool operator!=(const Iterator& other) const { return cur != other.cur; }
+    };
+
+    using iterator         = Iterator<false>;
+    using reverse_iterator = Iterator<true>;
+
+  private:
+    T*       head;
+    T*       tail;
+    size_t   count;
+    ParentT* owner;
+
+    static Node* node(T* p) { return static_cast<Node*>(p); }
+
+    void link(T* pos, T* p)
+    {
+        ASSERT(p && !node(p)->isLinked());
+        Node* n        = node(p);
+        n->ilistParent = owner;
+        n->ilistNext   = pos;
+        n->ilistPrev   = pos ? node(pos)->ilistPrev : tail;
+        if (n->ilistPrev)
+            node(n->ilistPrev)->ilistNext = p;
+        else
+            head = p;
+        if (pos)
+            node(pos)->ilistPrev = p;
+        else
+            tail = p;
+        ++count;
+    }
+    T* unlink(T* p)
+    {
+        Node* n    = node(p);
+        T*    next = n->ilistNext;
+        if (n->ilistPrev)
+            node(n->ilistPrev)->ilistNext = next;
+        else
+            head = next;
+        if (next)
+            node(next)->ilistPrev = n->ilistPrev;
+        else
+            tail = n->ilistPrev;
+        n->ilistPrev = n->ilistNext = nullptr;
+        n->ilistParent              = nullptr;
+        --count;
+        return next;
+    }
+
+  public:
+    explicit IList(ParentT* owner) : head(nullptr), tail(nullptr), count(0), owner(owner) {}
+    ~IList() { clear(); }
+
+    IList(const IList&)            = delete;
+    IList& operator=(const IList&) = delete;
+
+  public:
+    iterator         begin() const { return iterator(this, head); }
+    iterator         end() const { return iterator(this, nullptr); }
+    reverse_iterator rbegin() const { return reverse_iterator(this, tail); }
+    reverse_iterator rend() const { return reverse_iterator(this, nullptr); }
+    //由元素指针直接得到迭代器，元素必须在本链表中
+    iterator iteratorTo(T* p) const { return iterator(this, p); }
+
+    bool   empty() const { return count == 0; }
+    size_t size() const { return count; }
+    T*     front() const { return head; }
+    T*     back() const { return tail; }
+
+    void push_back(T* p) { link(nullptr, p); }
+    void push_front(T* p) { link(head, p); }
+    void pop_back() { unlink(tail); }
+    void pop_front() { unlink(head); }
+
+    //在pos之前插入，返回指向新元素的迭代器
+    iterator insert(iterator pos, T* p)
+    {
+        link(pos.cur, p);
+        return iterator(this, p);
+    }
+    //在pos之后插入，返回指向新元素的迭代器
+    iterator insertAfter(iterator pos, T* p)
+    {
+        link(node(pos.cur)->ilistNext, p);
+        return iterator(this, p);
+    }
+    //摘下pos处的元素（不销毁），返回其后一个元素的迭代器
+    iterator erase(iterator pos) { return iterator(this, unlink(pos.cur)); }
+    iterator erase(iterator first, iterator last)
+    {
+        while (first != last) first = erase(first);
+        return last;
+    }
+    //摘下元素p（不销毁）
+    void remove(T* p) { unlink(p); }
+    //用p替换pos处的元素，旧元素被摘下但不销毁，返回指向p的迭代器
+    iterator replace(iterator pos, T* p)
+    {
+        T* next = unlink(pos.cur);
+        link(next, p);
+        return iterator(this, p);
+    }
+
+    //把other中[first, last)的元素按原顺序移到pos之前
+    //整段链接只改动两端的指针；拥有者保存在每个结点上，两个链表拥有者不同时需逐个改写
+    void splice(iterator pos, IList& other, iterator first, iterator last)
+    {
+        if (first == last) return;
+        bool whole = first == other.begin() && last == other.end();
+        if (whole && &other == this) return;
+        T* firstNode = first.cur;
+        T* lastNode  = last.cur ? node(last.cur)->ilistPrev : other.tail;
+
+        size_t moved = 0;
+        if (whole)
+        {
+            moved = other.count;
+            if (owner != other.owner)
+                for (T* p = firstNode; p; p = node(p)->ilistNext) node(p)->ilistParent = owner;
+        }
+        else
+        {
+            for (T* p = firstNode;; p = node(p)->ilistNext)
+            {
+                node(p)->ilistParent = owner;
+                ++moved;
+                if (p == lastNode) break;
+            }
+        }
+
+        // 从other中摘下整段
+        T* before = node(firstNode)->ilistPrev;
+        if (before)
+            node(before)->ilistNext = last.cur;
+        else
+            other.head = last.cur;
+        if (last.cur)
+            node(last.cur)->ilistPrev = before;
+        else
+            other.tail = before;
+        other.count -= moved;
+
+        // 整段接到pos之前
+        T* prev = pos.cur ? node(pos.cur)->ilistPrev : tail;
+        node(firstNode)->ilistPrev = prev;
+        node(lastNode)->ilistNext  = pos.cur;
+        if (prev)
+            node(prev)->ilistNext = firstNode;
+        else
+            head = firstNode;
+        if (pos.cur)
+            node(pos.cur)->ilistPrev = lastNode;
+        else
+            tail = lastNode;
+        count += moved;
+    }
+    void splice(iterator pos, IList& other) { splice(pos, other, other.begin(), other.end()); }
+
+    //摘下全部元素（不销毁）
+    void clear()
+    {
+        while (head) unlink(head);
+    }
+    //摘下全部元素并逐个交给dispose销毁，dispose可以直接释放元素
+    template <typename F>
+    void clearAndDispose(F dispose)
+    {
+        while (head)
+        {
+            T* p = head;
+            unlink(p);
+            dispose(p);
+        }
+    }
+};
+
+#endif  // __UTILS_ILIST_H__
@@ -0,0 +1,76 @@
+#include <mapped_file.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MappedFile::open(const std::string& path, std::string& err)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        err = std::strerror(errno);
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        err = std::strerror(errno);
+        ::close(fd);
+        return false;
+    }
+
+    if (S_ISREG(st.st_mode) && st.st_size > 0)
+    {
+        void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED)
+        {
+            // 词法分析从头到尾顺序扫描一遍
+            ::madvise(p, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+            data_   = static_cast<const char*>(p);
+            size_   = static_cast<size_t>(st.st_size);
+            mapped_ = true;
+            ::close(fd);
+            return true;
+        }
+    }
+    else if (S_ISREG(st.st_mode))
+    {
+        ::close(fd);
+        return true;
+    }
+
+    char buf[64 * 1024];
+    for (;;)
+    {
+        ssize_t n = ::read(fd, buf, sizeof(buf));
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0)
+        {
+            err = std::strerror(errno);
+            ::close(fd);
+            fallback_.clear();
+            return false;
+        }
+        if (n == 0) break;
+        fallback_.append(buf, static_cast<size_t>(n));
+    }
+    ::close(fd);
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (mapped_) ::munmap(const_cast<char*>(data_), size_);
+    data_   = nullptr;
+    size_   = 0;
+    mapped_ = false;
+    fallback_.clear();
+}
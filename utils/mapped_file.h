@@ -0,0 +1,37 @@
+#ifndef __UTILS_MAPPED_FILE_H__
+#define __UTILS_MAPPED_FILE_H__
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/*
+ * 以只读方式把整个文件映射进内存，供词法分析直接在源文件字节上扫描：
+ * - 不经过 istream，也不把文件复制一份，view() 在对象存活期间一直有效
+ * - 空文件不做映射，view() 为空
+ * - 不能映射的文件（管道、设备等）退回到一次性读入内部的 std::string
+ */
+class MappedFile
+{
+  private:
+    const char* data_;
+    size_t      size_;
+    bool        mapped_;    // data_ 来自 mmap，析构时需要 munmap
+    std::string fallback_;  // 无法映射时的文件内容
+
+  public:
+    MappedFile() : data_(nullptr), size_(0), mapped_(false), fallback_() {}
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // 打开并映射 path，失败时返回 false 并在 err 中给出原因
+    bool open(const std::string& path, std::string& err);
+    void close();
+
+    std::string_view view() const { return std::string_view(data_ ? data_ : "", size_); }
+    size_t           size() const { return size_; }
+};
+
+#endif  // __UTILS_MAPPED_FILE_H__
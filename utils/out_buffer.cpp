@@ -0,0 +1,46 @@
+#include <out_buffer.h>
+#include <algorithm>
+#include <ostream>
+
+OutBuffer::OutBuffer(std::ostream& os, size_t capacity)
+    : os(&os), buf(new char[std::max<size_t>(capacity, 256)]), cap(std::max<size_t>(capacity, 256)), len(0)
+{}
+
+OutBuffer::~OutBuffer() { flush(); }
+
+void OutBuffer::flush()
+{
+    if (len == 0) return;
+    os->write(buf.get(), static_cast<std::streamsize>(len));
+    len = 0;
+}
+
+OutBuffer& OutBuffer::write(const char* s, size_t n)
+{
+    if (cap - len < n)
+    {
+        flush();
+        // 超过整个缓冲区的大段文本直接写入底层流
+        if (n >= cap)
+        {
+            os->write(s, static_cast<std::streamsize>(n));
+            return *this;
+        }
+    }
+    std::copy(s, s + n, buf.get() + len);
+    len += n;
+    return *this;
+}
+
+OutBuffer& OutBuffer::repeat(char c, size_t n)
+{
+    while (n > 0)
+    {
+        if (len == cap) flush();
+        size_t k = std::min(n, cap - len);
+        std::fill(buf.get() + len, buf.get() + len + k, c);
+        len += k;
+        n -= k;
+    }
+    return *this;
+}
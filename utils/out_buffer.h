@@ -0,0 +1,88 @@
+#ifndef __UTILS_OUT_BUFFER_H__
+#define __UTILS_OUT_BUFFER_H__
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*
+ * 文本输出缓冲区：
+ * - 文本先追加到一块可复用的连续缓冲区，缓冲区满、flush() 或析构时才整体写入底层 ostream，
+ *   不再逐段调用 ostream::operator<<，也不为每个片段构造临时 std::string
+ * - 整数与十六进制数用 std::to_chars 直接格式化进缓冲区
+ * - 用法与 ostream 相同：out << "add " << dt << " " << 42;
+ */
+class OutBuffer
+{
+  public:
+    static constexpr size_t defaultCapacity = 64 * 1024;
+
+    // out << OutBuffer::hex(v) 以不带前缀的小写十六进制输出 v
+    struct Hex
+    {
+        uint64_t value;
+    };
+    static Hex hex(uint64_t v) { return Hex{v}; }
+
+  private:
+    std::ostream*           os;
+    std::unique_ptr<char[]> buf;  // 不做零初始化，大缓冲区只有实际写到的页才会被占用
+    size_t                  cap;
+    size_t                  len;
+
+  public:
+    explicit OutBuffer(std::ostream& os, size_t capacity = defaultCapacity);
+    ~OutBuffer();
+
+    OutBuffer(const OutBuffer&)            = delete;
+    OutBuffer& operator=(const OutBuffer&) = delete;
+
+  public:
+    void flush();
+
+    OutBuffer& write(const char* s, size_t n);
+    // 连续输出 n 个字符 c
+    OutBuffer& repeat(char c, size_t n);
+
+    OutBuffer& operator<<(std::string_view s) { return write(s.data(), s.size()); }
+    OutBuffer& operator<<(const char* s) { return *this << std::string_view(s); }
+    OutBuffer& operator<<(const std::string& s) { return write(s.data(), s.size()); }
+    OutBuffer& operator<<(char c)
+    {
+        if (len == cap) flush();
+        buf[len++] = c;
+        return *this;
+    }
+    OutBuffer& operator<<(Hex h) { return writeNumber(h.value, 16); }
+
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, char> &&
+                                                      !std::is_same_v<T, bool>>>
+    OutBuffer& operator<<(T v)
+    {
+        return writeNumber(v, 10);
+    }
+
+  private:
+    // 保证缓冲区至少还有 n 字节空位
+    void reserve(size_t n)
+    {
+        if (cap - len < n) flush();
+    }
+
+    template <typename T>
+    OutBuffer& writeNumber(T v, int base)
+    {
+        constexpr size_t maxDigits = sizeof(T) * 8 + 1;  // 二进制位数加符号位，足以容纳任意进制的结果
+        reserve(maxDigits);
+        auto res = std::to_chars(buf.get() + len, buf.get() + cap, v, base);
+        len      = static_cast<size_t>(res.ptr - buf.get());
+        return *this;
+    }
+};
+
+#endif  // __UTILS_OUT_BUFFER_H__
@@ -0,0 +1,95 @@
+#include <thread_pool.h>
+
+ThreadPool::ThreadPool(size_t numThreads)
+    : workers(), threads(), queued(0), pending(0), nextWorker(0), stopping(false)
+{
+    if (numThreads == 0) numThreads = 1;
+    for (size_t i = 0; i < numThreads; ++i) workers.push_back(std::make_unique<Worker>());
+    for (size_t i = 0; i < numThreads; ++i) threads.emplace_back([this, i]() { workerLoop(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    taskCv.notify_all();
+    for (auto& t : threads) t.join();
+}
+
+void ThreadPool::submit(Task task)
+{
+    std::lock_guard<std::mutex> lock(mtx);
+    Worker&                     worker = *workers[nextWorker];
+    nextWorker                         = (nextWorker + 1) % workers.size();
+    {
+        std::lock_guard<std::mutex> workerLock(worker.mtx);
+        worker.tasks.push_back(std::move(task));
+    }
+    ++pending;
+    ++queued;
+    taskCv.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock(mtx);
+    doneCv.wait(lock, [this]() { return pending == 0; });
+}
+
+void ThreadPool::parallelFor(size_t n, const std::function<void(size_t workerId, size_t index)>& fn)
+{
+    for (size_t i = 0; i < n; ++i) submit([&fn, i](size_t workerId) { fn(workerId, i); });
+    wait();
+}
+
+bool ThreadPool::popTask(size_t self, Task& task)
+{
+    // 先取自己队列尾部最近放入的任务
+    {
+        Worker&                     own = *workers[self];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            --queued;
+            return true;
+        }
+    }
+    // 再从其他线程队列的头部窃取
+    for (size_t k = 1; k < workers.size(); ++k)
+    {
+        Worker&                     victim = *workers[(self + k) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            --queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t self)
+{
+    while (true)
+    {
+        Task task;
+        if (popTask(self, task))
+        {
+            task(self);
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--pending == 0) doneCv.notify_all();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mtx);
+        taskCv.wait(lock, [this]() { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+    }
+}
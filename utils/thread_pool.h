@@ -0,0 +1,65 @@
+#ifndef __UTILS_THREAD_POOL_H__
+#define __UTILS_THREAD_POOL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * 工作窃取线程池：
+ * - 每个工作线程有自己的任务队列，submit() 按轮转把任务放入各队列
+ * - 线程优先从自己队列的尾部取任务，自己的队列空了再从其他线程队列的头部窃取，
+ *   大小悬殊的任务（如一个巨大的函数和许多小函数）也能均衡地分摊到各线程
+ * - 任务接收执行它的线程编号，便于使用按线程划分的资源（如每个线程一份 Pass 实例）
+ */
+class ThreadPool
+{
+  public:
+    using Task = std::function<void(size_t workerId)>;
+
+  private:
+    struct Worker
+    {
+        std::mutex       mtx;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread>             threads;
+
+    std::mutex              mtx;
+    std::condition_variable taskCv;  // 有新任务或线程池关闭
+    std::condition_variable doneCv;  // 全部任务完成
+    std::atomic<size_t>     queued;  // 已提交但尚未被取走的任务数
+    size_t                  pending;  // 已提交但尚未执行完的任务数，受 mtx 保护
+    size_t                  nextWorker;
+    bool                    stopping;
+
+  public:
+    explicit ThreadPool(size_t numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+  public:
+    size_t size() const { return workers.size(); }
+
+    void submit(Task task);
+    // 阻塞直到已提交的任务全部执行完毕
+    void wait();
+    // 对 [0, n) 中的每个下标调用 fn(workerId, i)，返回时全部调用已完成
+    void parallelFor(size_t n, const std::function<void(size_t workerId, size_t index)>& fn);
+
+  private:
+    bool popTask(size_t self, Task& task);
+    void workerLoop(size_t self);
+};
+
+#endif  // __UTILS_THREAD_POOL_H__